@@ -109,10 +109,14 @@ function(bundle_static_library bundled_tgt_name)
       list(APPEND tgt_obj_globs ${tgt_obj_dir}/*${CMAKE_CXX_OUTPUT_EXTENSION})
     endforeach()
 
+    # depend on the static libraries themselves so that the bundle is rebuilt
+    # whenever any of them are, and start from an empty archive so that stale
+    # objects are not carried over
     add_custom_command(
+      COMMAND ${CMAKE_COMMAND} -E remove -f ${bundled_tgt_full_name}
       COMMAND ${ar_tool} -crs ${bundled_tgt_full_name} ${tgt_obj_globs}
       OUTPUT  ${bundled_tgt_full_name}
-      DEPENDS ${unpack_static_libs}
+      DEPENDS ${unpack_static_libs} ${static_libs}
       COMMENT "Bundling ${bundled_tgt_name}")
   elseif(MSVC)
     get_filename_component(bin_path ${CMAKE_LINKER} DIRECTORY)
@@ -0,0 +1,41 @@
+#ifndef TASTY_INT_TASTY_INT_BINARY_FORMAT_HPP
+#define TASTY_INT_TASTY_INT_BINARY_FORMAT_HPP
+
+#include <cstddef>
+
+#include <bit>
+
+
+namespace tasty_int {
+
+/**
+ * The order in which the words of a binary magnitude are laid out.
+ */
+enum class WordOrder
+{
+    LEAST_SIGNIFICANT_FIRST, ///< the least-significant word is first
+    MOST_SIGNIFICANT_FIRST   ///< the most-significant word is first
+}; // enum class WordOrder
+
+/**
+ * This struct describes the layout of a binary-encoded arbitrary-precision
+ * integer a la GMP's mpz_import()/mpz_export():
+ *
+ *     [sign byte][word]...
+ *
+ * where the sign byte is 0x00 for nonnegative values and 0x01 for negative
+ * values, and the magnitude is split into the fewest `word_size`-byte words
+ * that hold it (zero has no words).  The defaults match the in-memory layout
+ * of the digits of tasty_int::TastyInt on little-endian machines, permitting
+ * conversion by a plain copy.
+ */
+struct BinaryFormat
+{
+    std::size_t word_size  = 8;                     ///< bytes per word
+    WordOrder   word_order = WordOrder::LEAST_SIGNIFICANT_FIRST; ///< word order
+    std::endian byte_order = std::endian::little;   ///< byte order of words
+}; // struct BinaryFormat
+
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_BINARY_FORMAT_HPP
@@ -0,0 +1,61 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_BYTES_FROM_INTEGER_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_BYTES_FROM_INTEGER_HPP
+
+#include <cstddef>
+
+#include <span>
+
+#include "tasty_int/binary_format.hpp"
+#include "tasty_int/detail/integer.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+namespace conversions {
+
+/**
+ * @brief Determines the number of bytes required to encode @p integer in the
+ *     binary format @p format.
+ *
+ * @param[in] integer an arbitrary-precision integer
+ * @param[in] format  the layout of the encoding
+ * @return the exact number of bytes written by bytes_from_integer()
+ *
+ * @throw std::invalid_argument if @p format has a `word_size` of zero or a
+ *     `byte_order` other than `std::endian::little` or `std::endian::big`
+ *
+ * @pre @p integer has a valid sign and at least one digit
+ */
+std::size_t
+count_bytes_from_integer(const Integer      &integer,
+                         const BinaryFormat &format);
+
+/**
+ * @brief Encodes @p integer into the front of @p bytes in the binary format
+ *     @p format.
+ *
+ * @details The magnitude is copied directly from the digits of @p integer, so
+ *     the conversion is linear-time.  Layouts matching the digits in memory
+ *     reduce to a single memcpy().
+ *
+ * @param[in]  integer an arbitrary-precision integer
+ * @param[in]  format  the layout of the encoding
+ * @param[out] bytes   the destination buffer
+ * @return the number of bytes written
+ *
+ * @throw std::invalid_argument if @p format is invalid (see
+ *     count_bytes_from_integer())
+ * @throw std::invalid_argument if @p bytes is too small to hold the encoding
+ *
+ * @pre @p integer has a valid sign and at least one digit
+ */
+std::size_t
+bytes_from_integer(const Integer        &integer,
+                   const BinaryFormat   &format,
+                   std::span<std::byte>  bytes);
+
+} // namespace conversions
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_BYTES_FROM_INTEGER_HPP
@@ -0,0 +1,93 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_CHARS_FROM_INTEGER_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_CHARS_FROM_INTEGER_HPP
+
+#include <cstddef>
+
+#include <charconv>
+#include <functional>
+#include <string_view>
+
+#include "tasty_int/detail/integer_view.hpp"
+#include "tasty_int/detail/digits_view.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+namespace conversions {
+
+/**
+ * @brief Determines an upper bound on the number of characters required to
+ *     present @p integer in base @p base.
+ *
+ * @param[in] integer an arbitrary-precision integer
+ * @param[in] base    the desired numeric base/radix of the output
+ * @return the maximum number of characters written by chars_from_integer(),
+ *     exceeding the exact count `n` by at most `2 + n / 2^19`
+ *
+ * @throw std::invalid_argument if @p base is not a supported numeric
+ *     base/radix
+ *
+ * @pre @p integer has a valid sign and at least one digit
+ */
+std::size_t
+max_chars_from_integer(IntegerView  integer,
+                       unsigned int base);
+
+/**
+ * @brief Writes the string representation of @p integer to the character
+ *     range [@p first, @p last).
+ *
+ * @details The output matches that of string_from_integer(), but it is not
+ *     null-terminated.  The result is not allocated; scratch space used by
+ *     the conversion is retained by the calling thread for reuse.
+ *
+ * @param[in]  integer an arbitrary-precision integer
+ * @param[in]  base    the desired numeric base/radix of the output
+ * @param[out] first   the beginning of the destination range
+ * @param[out] last    the end of the destination range
+ * @return `{ one past the last character written, std::errc() }` on success,
+ *     otherwise `{ last, std::errc::value_too_large }` with the contents of
+ *     [@p first, @p last) unspecified
+ *
+ * @throw std::invalid_argument if @p base is not a supported numeric
+ *     base/radix
+ *
+ * @pre @p integer has a valid sign and at least one digit
+ */
+std::to_chars_result
+chars_from_integer(IntegerView   integer,
+                   unsigned int  base,
+                   char         *first,
+                   char         *last);
+
+/**
+ * @brief Presents the magnitude @p digits in base @p base, passing the
+ *     characters to @p consume most significant first in segments of bounded
+ *     length.
+ *
+ * @details The concatenation of the segments matches the unsigned output of
+ *     chars_from_integer().  The characters are never materialized in full,
+ *     such that arbitrarily large values may be written incrementally.
+ *
+ * @param[in] digits  a little-endian sequence of digits
+ * @param[in] base    the desired numeric base/radix of the output
+ * @param[in] consume the receiver of the segments of characters, each of which
+ *     is valid only for the duration of the call
+ *
+ * @throw std::invalid_argument if @p base is not a supported numeric
+ *     base/radix
+ *
+ * @pre @p digits is not empty
+ */
+void
+stream_chars_from_digits(
+    DigitsView                                    digits,
+    unsigned int                                  base,
+    const std::function<void (std::string_view)> &consume
+);
+
+} // namespace conversions
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_CHARS_FROM_INTEGER_HPP
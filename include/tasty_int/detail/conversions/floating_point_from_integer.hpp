@@ -3,6 +3,8 @@
 
 #include "tasty_int/detail/integer.hpp"
 
+#include "tasty_int/concepts.hpp"
+
 
 namespace tasty_int {
 namespace detail {
@@ -11,15 +13,19 @@ namespace conversions {
 /**
  * @brief Retrieves the floating-point value of @p integer.
  *
- * @details If the value of @p integer is larger than what can be represented by
- *    long double, the result is +/- infinity.
+ * @details The result is correctly rounded to nearest, ties to even, for
+ *    @p FloatingPointType, and is computed in constant time from the leading
+ *    digits of @p integer.  If the value of @p integer is larger than what can
+ *    be represented by @p FloatingPointType, the result is +/- infinity.
  *
+ * @tparam FloatingPointType one of `float`, `double`, or `long double`
  * @param[in] integer an arbitrary-precision integer
  * @return the floating-point value of @p integer
  *
  * @pre @p integer has a valid sign and at least one digit
  */
-long double
+template<FloatingPoint FloatingPointType = long double>
+FloatingPointType
 floating_point_from_integer(const Integer &integer);
 
 } // namespace conversions
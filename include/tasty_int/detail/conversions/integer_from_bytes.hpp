@@ -0,0 +1,41 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_INTEGER_FROM_BYTES_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_INTEGER_FROM_BYTES_HPP
+
+#include <cstddef>
+
+#include <span>
+
+#include "tasty_int/binary_format.hpp"
+#include "tasty_int/detail/integer.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+namespace conversions {
+
+/**
+ * @brief Decodes a tasty_int::detail::Integer from @p bytes, which are laid
+ *     out in the binary format @p format as written by bytes_from_integer().
+ *
+ * @details Words holding leading zero bytes are accepted, and a negative sign
+ *     byte preceding a zero magnitude decodes to zero.
+ *
+ * @param[in] bytes  the encoded integer
+ * @param[in] format the layout of the encoding
+ * @return the decoded integer
+ *
+ * @throw std::invalid_argument if @p format has a `word_size` of zero or a
+ *     `byte_order` other than `std::endian::little` or `std::endian::big`
+ * @throw std::invalid_argument if @p bytes is not a sign byte followed by a
+ *     whole number of words
+ * @throw std::invalid_argument if the sign byte is neither 0x00 nor 0x01
+ */
+Integer
+integer_from_bytes(std::span<const std::byte> bytes,
+                   const BinaryFormat         &format);
+
+} // namespace conversions
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_INTEGER_FROM_BYTES_HPP
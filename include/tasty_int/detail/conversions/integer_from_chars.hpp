@@ -0,0 +1,45 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_INTEGER_FROM_CHARS_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_INTEGER_FROM_CHARS_HPP
+
+#include <charconv>
+
+#include "tasty_int/detail/integer.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+namespace conversions {
+
+/**
+ * @brief Parses a tasty_int::detail::Integer from the longest prefix of the
+ *     character range [@p first, @p last) that forms a number in base
+ *     @p base.
+ *
+ * @details The prefix consists of an optional minus sign followed by one or
+ *     more tokens of base @p base, as written by chars_from_integer().
+ *     Unlike integer_from_string(), leading whitespace, a plus sign, and
+ *     base-specific prefixes are not accepted, and the base is never
+ *     deduced.
+ *
+ * @param[in]  first   the beginning of the source range
+ * @param[in]  last    the end of the source range
+ * @param[in]  base    the numeric base/radix in which the tokens are
+ *     interpretted
+ * @param[out] integer the parsed value, unmodified if no number was found
+ * @return `{ one past the last character consumed, std::errc() }` on success,
+ *     otherwise `{ first, std::errc::invalid_argument }`
+ *
+ * @throw std::invalid_argument if @p base is not a supported numeric
+ *     base/radix
+ */
+std::from_chars_result
+integer_from_chars(const char   *first,
+                   const char   *last,
+                   unsigned int  base,
+                   Integer      &integer);
+
+} // namespace conversions
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_INTEGER_FROM_CHARS_HPP
@@ -3,7 +3,7 @@
 
 #include <string>
 
-#include "tasty_int/detail/integer.hpp"
+#include "tasty_int/detail/integer_view.hpp"
 
 
 namespace tasty_int {
@@ -24,8 +24,8 @@ namespace conversions {
  * @pre @p base is a supported numeric base/radix
  */
 std::string
-string_from_integer(const Integer &integer,
-                    unsigned int   base);
+string_from_integer(IntegerView  integer,
+                    unsigned int base);
 
 } // namespace conversions
 } // namespace detail
@@ -1,9 +1,9 @@
 #ifndef TASTY_INT_TASTY_INT_DETAIL_DIGIT_TYPE_HPP
 #define TASTY_INT_TASTY_INT_DETAIL_DIGIT_TYPE_HPP
 
+#include <climits>
 #include <cstdint>
 
-#include <limits>
 #include <type_traits>
 
 
@@ -16,13 +16,32 @@ namespace detail {
  * DIGIT_TYPE_MAX<sup>DIGITS_PER_DIGIT_ACCUMULATOR</sup> but small enough s.t.
  * its maximum value may be stored in DIGITS_PER_DIGIT_ACCUMULATOR digit_type
  * instances.
+ *
+ * If the target supports the `unsigned __int128` extension, it is preferred
+ * over `std::uintmax_t` so that digits span a full machine word.  Defining
+ * TASTY_INT_DISABLE_INT128_ACCUMULATOR opts out of this extension.
+ *
+ * Under strict ISO modes (e.g. `-std=c++20`) the standard type traits do not
+ * recognize `__int128`, so neither this header nor its dependents may apply
+ * them to digit_accumulator_type.
+ */
+#if defined(__SIZEOF_INT128__) && !defined(TASTY_INT_DISABLE_INT128_ACCUMULATOR)
+#   define TASTY_INT_HAVE_INT128_ACCUMULATOR 1
+__extension__ typedef unsigned __int128 digit_accumulator_type;
+
+/**
+ * The signed version of digit_accumulator_type.
  */
+__extension__ typedef __int128 signed_digit_accumulator_type;
+#else
+#   define TASTY_INT_HAVE_INT128_ACCUMULATOR 0
 typedef std::uintmax_t digit_accumulator_type;
 
 /**
  * The signed version of digit_accumulator_type.
  */
-typedef std::make_signed_t<digit_accumulator_type> signed_digit_accumulator_type;
+typedef std::intmax_t signed_digit_accumulator_type;
+#endif
 
 
 /**
@@ -57,7 +76,7 @@ typedef std::conditional_t<(sizeof(unsigned char)      * DIGITS_PER_DIGIT_ACCUMU
  * Half the bit-size of digit_accumulator_type.  Used to size DIGIT_TYPE_MAX.
  */
 static constexpr unsigned int DIGIT_TYPE_BITS =
-    std::numeric_limits<digit_accumulator_type>::digits /
+    (sizeof(digit_accumulator_type) * CHAR_BIT) /
     DIGITS_PER_DIGIT_ACCUMULATOR;
 
 /**
@@ -0,0 +1,87 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_DIGITS_DIVISOR_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_DIGITS_DIVISOR_HPP
+
+#include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+
+struct DigitsDivisionResult;
+
+/**
+ * This class holds a divisor prepared for repeated division.  The divisor is
+ * normalized and its fixed-point reciprocal is computed once, on
+ * construction, so that each division by it applies Barrett reduction: two
+ * multiplications and a small correction per divisor-sized piece of the
+ * dividend, with no normalization of the divisor or Newton iteration.
+ *
+ * Divisors small enough for long division to be competitive do not store a
+ * reciprocal.  They are divided by long division with the stored normalized
+ * divisor, or, if they are a single digit, by multiplying with a precomputed
+ * single-digit reciprocal.
+ */
+class DigitsDivisor
+{
+public:
+    /**
+     * @brief Prepares @p digits for division.
+     *
+     * @param[in] digits a little-endian sequence of digits
+     *
+     * @pre `digits > 0`
+     * @pre @p digits may have no leading zeros
+     */
+    explicit
+    DigitsDivisor(const SmallVector<digit_type> &digits);
+
+    /**
+     * @return the digits of the original divisor
+     */
+    const SmallVector<digit_type> &
+    value() const
+    {
+        return divisor;
+    }
+
+    /**
+     * @brief Execute `dividend / divisor`.
+     *
+     * @param[in] dividend the value from which the divisor is divided
+     * @return the quotient and remainder
+     *
+     * @pre @p dividend may have no leading zeros
+     */
+    DigitsDivisionResult
+    divide(const SmallVector<digit_type> &dividend) const;
+
+    /**
+     * @brief Execute `dividend % divisor`.
+     *
+     * @param[in] dividend the value from which the divisor is divided
+     * @return the remainder
+     *
+     * @pre @p dividend may have no leading zeros
+     */
+    SmallVector<digit_type>
+    reduce(const SmallVector<digit_type> &dividend) const;
+
+private:
+    bool
+    have_reciprocal() const
+    {
+        return !reciprocal.empty();
+    }
+
+    SmallVector<digit_type> divisor;
+    unsigned int            normal_shift;
+    SmallVector<digit_type> normalized_divisor;
+    SmallVector<digit_type> reciprocal;
+    digit_type              digit_reciprocal;
+}; // class DigitsDivisor
+
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_DIGITS_DIVISOR_HPP
@@ -0,0 +1,106 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_DIGITS_MONTGOMERY_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_DIGITS_MONTGOMERY_HPP
+
+#include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/digits_divisor.hpp"
+#include "tasty_int/detail/small_vector.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+
+/**
+ * This class holds an odd modulus `m` of magnitude `n` prepared for modular
+ * multiplication in Montgomery form, where a residue `a` is represented by
+ * `a*R mod m` for `R = DIGIT_BASE^n`.
+ *
+ * Montgomery multiplication (REDC) replaces the division by `m` following
+ * each product with a division by `R`, which is a digit shift.  Products are
+ * computed by the Coarsely Integrated Operand Scanning (CIOS) method, which
+ * interleaves multiplication and reduction one digit of the multiplier at a
+ * time in a scratch buffer of `n + 2` digits.
+ *
+ * Unless noted otherwise, operands are little-endian sequences of digits with
+ * no leading zeros.
+ */
+class DigitsMontgomeryContext
+{
+public:
+    /**
+     * @brief Prepares @p digits for Montgomery multiplication.
+     *
+     * @param[in] digits the modulus
+     *
+     * @pre @p digits is odd
+     * @pre @p digits may have no leading zeros
+     */
+    explicit
+    DigitsMontgomeryContext(const SmallVector<digit_type> &digits);
+
+    /**
+     * @return the digits of the modulus
+     */
+    const SmallVector<digit_type> &
+    value() const
+    {
+        return divisor.value();
+    }
+
+    /**
+     * @param[in] digits an arbitrary value
+     * @return `digits*R mod m`
+     */
+    SmallVector<digit_type>
+    to_montgomery(const SmallVector<digit_type> &digits) const;
+
+    /**
+     * @param[in] digits a value in Montgomery form
+     * @return `digits*R^-1 mod m`
+     *
+     * @pre `digits < m`
+     */
+    SmallVector<digit_type>
+    from_montgomery(const SmallVector<digit_type> &digits) const;
+
+    /**
+     * @param[in] lhs a value in Montgomery form
+     * @param[in] rhs a value in Montgomery form
+     * @return `lhs*rhs*R^-1 mod m`, the Montgomery form of the product
+     *
+     * @pre `(lhs < m) && (rhs < m)`
+     */
+    SmallVector<digit_type>
+    multiply(const SmallVector<digit_type> &lhs,
+             const SmallVector<digit_type> &rhs) const;
+
+    /**
+     * @param[in] digits a value in Montgomery form
+     * @return `digits*digits*R^-1 mod m`, the Montgomery form of the square
+     *
+     * @pre `digits < m`
+     */
+    SmallVector<digit_type>
+    square(const SmallVector<digit_type> &digits) const;
+
+    /**
+     * @brief Computes `base^exponent mod m` by fixed-window exponentiation
+     *     in Montgomery form.
+     *
+     * @param[in] base     an arbitrary value (not in Montgomery form)
+     * @param[in] exponent an arbitrary value
+     * @return `base^exponent mod m` (not in Montgomery form)
+     */
+    SmallVector<digit_type>
+    pow_mod(const SmallVector<digit_type> &base,
+            const SmallVector<digit_type> &exponent) const;
+
+private:
+    DigitsDivisor           divisor;
+    digit_type              modulus_inverse;
+    SmallVector<digit_type> r_squared;
+}; // class DigitsMontgomeryContext
+
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_DIGITS_MONTGOMERY_HPP
@@ -0,0 +1,22 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_DIGITS_VIEW_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_DIGITS_VIEW_HPP
+
+#include <span>
+
+#include "tasty_int/detail/digit_type.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+
+/**
+ * A read-only, non-owning little-endian sequence of digits.  Any contiguous
+ * sequence of digits, such as a SmallVector<digit_type> or digits mapped from
+ * a file, may be viewed as a DigitsView without being copied.
+ */
+typedef std::span<const digit_type> DigitsView;
+
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_DIGITS_VIEW_HPP
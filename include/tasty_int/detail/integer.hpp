@@ -1,10 +1,9 @@
 #ifndef TASTY_INT_TASTY_INT_DETAIL_INTEGER_HPP
 #define TASTY_INT_TASTY_INT_DETAIL_INTEGER_HPP
 
-#include <vector>
-
 #include "tasty_int/detail/sign.hpp"
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 
 
 namespace tasty_int {
@@ -41,7 +40,7 @@ struct Integer
      * The little-endian positional notation representation of Integer's
      * absolute value.
      */
-    std::vector<digit_type> digits;
+    SmallVector<digit_type> digits;
 }; // struct Integer
 
 } // namespace detail
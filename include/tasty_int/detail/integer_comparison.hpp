@@ -5,6 +5,10 @@
 
 #include <cstdint>
 
+#include <compare>
+
+#include "tasty_int/detail/integer_view.hpp"
+
 
 namespace tasty_int {
 namespace detail {
@@ -156,6 +160,18 @@ operator>=(long double    lhs,
            const Integer &rhs);
 /// @}
 
+/**
+ * @brief Three-way compares two read-only integers with the same semantics as
+ *     @ref IntegerComparisonOperators.
+ *
+ * @param[in] lhs the left-hand integer
+ * @param[in] rhs the right-hand integer
+ * @return the ordering of @p lhs relative to @p rhs
+ */
+std::strong_ordering
+compare(IntegerView lhs,
+        IntegerView rhs);
+
 } // namespace detail
 } // namespace tasty_int
 
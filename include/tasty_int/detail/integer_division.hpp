@@ -5,6 +5,8 @@
 
 #include <cstdint>
 
+#include "tasty_int/detail/digits_divisor.hpp"
+
 
 namespace tasty_int {
 namespace detail {
@@ -199,6 +201,54 @@ div(long double    dividend,
     const Integer &divisor);
 /// @}
 
+
+/**
+ * This class holds a tasty_int::detail::Integer divisor prepared for
+ * repeated division.  Quotients and remainders follow the same sign rules as
+ * the division and modulo operators.
+ */
+class IntegerDivisor
+{
+public:
+    /**
+     * @brief Prepares @p integer for division.
+     *
+     * @param[in] integer the divisor
+     *
+     * @pre `integer.sign != Sign::ZERO`
+     */
+    explicit
+    IntegerDivisor(const Integer &integer);
+
+    /**
+     * @return a copy of the original divisor
+     */
+    Integer
+    value() const;
+
+    /**
+     * @brief Execute `dividend / divisor`.
+     */
+    Integer
+    divide(const Integer &dividend) const;
+
+    /**
+     * @brief Execute `dividend % divisor`.
+     */
+    Integer
+    reduce(const Integer &dividend) const;
+
+    /**
+     * @brief Execute `div(dividend, divisor)`.
+     */
+    IntegerDivisionResult<Integer>
+    div(const Integer &dividend) const;
+
+private:
+    Sign          sign;
+    DigitsDivisor digits_divisor;
+}; // class IntegerDivisor
+
 } // namespace detail
 } // namespace tasty_int
 
@@ -0,0 +1,136 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_INTEGER_FILE_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_INTEGER_FILE_HPP
+
+#include "tasty_int/detail/integer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <filesystem>
+
+#include "tasty_int/detail/integer_view.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+
+/**
+ * @defgroup IntegerFile Integer File
+ *
+ * Integers are stored in files of the following versioned format, in which
+ * every multi-byte field is little-endian:
+ *
+ *     | offset | size                | field                            |
+ *     | ------ | ------------------- | -------------------------------- |
+ *     | 0      | 8                   | magic bytes `TASTYINT`           |
+ *     | 8      | 4                   | format version                   |
+ *     | 12     | 1                   | sign: -1, 0, or +1               |
+ *     | 13     | 1                   | limb width in bytes              |
+ *     | 14     | 2                   | reserved, zero                   |
+ *     | 16     | 8                   | limb count                       |
+ *     | 24     | 8                   | reserved, zero                   |
+ *     | 32     | count * limb width  | limbs, least significant first   |
+ *
+ * The limbs are the digits of the absolute value, laid out exactly as
+ * `digit_type`s in memory on a little-endian host, so that a mapped file may
+ * be read without copying.  The limb width is therefore `sizeof(digit_type)`:
+ * a file written by a build with 32-bit digits is rejected by a build with
+ * 64-bit digits, and the other way round.
+ */
+/// @{
+/// The bytes at the beginning of every integer file.
+constexpr char INTEGER_FILE_MAGIC[8] = {
+    'T', 'A', 'S', 'T', 'Y', 'I', 'N', 'T'
+};
+
+/// The version of the integer file format written by write_integer_file().
+constexpr std::uint32_t INTEGER_FILE_VERSION = 1;
+
+/// The size in bytes of the integer file header preceding the limbs.
+constexpr std::size_t INTEGER_FILE_HEADER_SIZE = 32;
+
+/**
+ * @brief Writes @p integer to the file at @p path, replacing its contents.
+ *
+ * @param[in] integer an arbitrary-precision integer
+ * @param[in] path    the destination file path
+ *
+ * @throw std::ios_base::failure if the file could not be written
+ *
+ * @pre @p integer has a valid sign and at least one digit
+ */
+void
+write_integer_file(const Integer               &integer,
+                   const std::filesystem::path &path);
+
+/**
+ * This class maps an integer file into memory read-only and views its
+ * integer in place.
+ */
+class MappedIntegerFile
+{
+public:
+    /**
+     * @brief Maps the integer file at @p path.
+     *
+     * @param[in] path the integer file path
+     *
+     * @throw std::system_error      if the file could not be opened or mapped
+     * @throw std::invalid_argument  if the file is not a valid integer file
+     * @throw std::runtime_error     if the host is not little-endian
+     */
+    explicit
+    MappedIntegerFile(const std::filesystem::path &path);
+
+    MappedIntegerFile(const MappedIntegerFile &) = delete;
+
+    MappedIntegerFile &
+    operator=(const MappedIntegerFile &) = delete;
+
+    /**
+     * @brief Takes ownership of @p other's mapping, leaving @p other empty.
+     *
+     * @param[in,out] other a mapped integer file
+     */
+    MappedIntegerFile(MappedIntegerFile &&other) noexcept;
+
+    /**
+     * @brief Replaces the mapping of `this` with @p other's, leaving @p other
+     *     empty.
+     *
+     * @param[in,out] other a mapped integer file
+     * @return a reference to `this`
+     */
+    MappedIntegerFile &
+    operator=(MappedIntegerFile &&other) noexcept;
+
+    /**
+     * @brief Unmaps the file.
+     */
+    ~MappedIntegerFile();
+
+    /**
+     * @brief Views the mapped integer.
+     *
+     * @return a view of the mapped integer, valid for the lifetime of the
+     *     mapping
+     *
+     * @pre `this` has not been moved from
+     */
+    IntegerView
+    view() const;
+
+private:
+    void
+    unmap() noexcept;
+
+    void        *mapping;
+    std::size_t  mapping_size;
+    IntegerView  integer;
+}; // class MappedIntegerFile
+/// @}
+
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_INTEGER_FILE_HPP
@@ -0,0 +1,90 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_INTEGER_MONTGOMERY_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_INTEGER_MONTGOMERY_HPP
+
+#include "tasty_int/detail/integer.hpp"
+#include "tasty_int/detail/digits_montgomery.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+
+/**
+ * This class holds a positive, odd tasty_int::detail::Integer modulus `m`
+ * prepared for modular multiplication in Montgomery form (see
+ * tasty_int::detail::DigitsMontgomeryContext).
+ *
+ * Residues are least nonnegative: results lie in `[0, m)`, and negative
+ * arguments are first reduced into that range.
+ */
+class IntegerMontgomeryContext
+{
+public:
+    /**
+     * @brief Prepares @p integer for Montgomery multiplication.
+     *
+     * @param[in] integer the modulus
+     *
+     * @pre `integer > 0` and @p integer is odd
+     */
+    explicit
+    IntegerMontgomeryContext(const Integer &integer);
+
+    /**
+     * @return a copy of the modulus
+     */
+    Integer
+    value() const;
+
+    /**
+     * @return `integer*R mod m`
+     */
+    Integer
+    to_montgomery(const Integer &integer) const;
+
+    /**
+     * @return `integer*R^-1 mod m`
+     *
+     * @pre `(integer >= 0) && (integer < m)`
+     */
+    Integer
+    from_montgomery(const Integer &integer) const;
+
+    /**
+     * @return the Montgomery form of the product of Montgomery forms @p lhs
+     *     and @p rhs
+     *
+     * @pre `(lhs >= 0) && (lhs < m) && (rhs >= 0) && (rhs < m)`
+     */
+    Integer
+    multiply(const Integer &lhs,
+             const Integer &rhs) const;
+
+    /**
+     * @return the Montgomery form of the square of Montgomery form
+     *     @p integer
+     *
+     * @pre `(integer >= 0) && (integer < m)`
+     */
+    Integer
+    square(const Integer &integer) const;
+
+    /**
+     * @return `base^exponent mod m`
+     *
+     * @pre `exponent >= 0`
+     */
+    Integer
+    pow_mod(const Integer &base,
+            const Integer &exponent) const;
+
+private:
+    Integer
+    negate(const Integer &residue) const;
+
+    DigitsMontgomeryContext digits_context;
+}; // class IntegerMontgomeryContext
+
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_INTEGER_MONTGOMERY_HPP
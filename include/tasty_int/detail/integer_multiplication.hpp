@@ -5,6 +5,8 @@
 
 #include <cstdint>
 
+#include "tasty_int/detail/integer_view.hpp"
+
 
 namespace tasty_int {
 namespace detail {
@@ -86,6 +88,21 @@ operator*(long double    lhs,
           const Integer &rhs);
 /// @}
 
+/**
+ * @brief Multiplies two read-only integers.
+ *
+ * Unlike `operator*`, the operands' digits need not be owned by an Integer,
+ * so that integers borrowed from other storage may be multiplied without
+ * first being copied.
+ *
+ * @param[in] lhs the left-hand multiplicand
+ * @param[in] rhs the right-hand multiplicand
+ * @return the product
+ */
+Integer
+multiply_integers(IntegerView lhs,
+                  IntegerView rhs);
+
 } // namespace detail
 } // namespace tasty_int
 
@@ -0,0 +1,56 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_INTEGER_VIEW_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_INTEGER_VIEW_HPP
+
+#include "tasty_int/detail/integer.hpp"
+#include "tasty_int/detail/digits_view.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+
+/**
+ * This struct is a read-only, non-owning counterpart of
+ * tasty_int::detail::Integer.  Its fields hold the same values as those of
+ * Integer, but its digits may be stored anywhere, e.g. in a memory-mapped
+ * file.
+ */
+struct IntegerView
+{
+    /**
+     * @brief Views @p integer.
+     *
+     * @param[in] integer the viewed integer, which must outlive `this`
+     */
+    IntegerView(const Integer &integer)
+        : sign(integer.sign)
+        , digits(integer.digits)
+    {}
+
+    /**
+     * @brief Views the integer with the provided fields.
+     *
+     * @param[in] integer_sign   the integer sign
+     * @param[in] integer_digits the little-endian digits of the absolute value
+     */
+    IntegerView(Sign       integer_sign,
+                DigitsView integer_digits)
+        : sign(integer_sign)
+        , digits(integer_digits)
+    {}
+
+    /**
+     * The integer sign.
+     */
+    Sign       sign;
+
+    /**
+     * The little-endian positional notation representation of the absolute
+     * value.
+     */
+    DigitsView digits;
+}; // struct IntegerView
+
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_INTEGER_VIEW_HPP
@@ -0,0 +1,682 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_SMALL_VECTOR_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_SMALL_VECTOR_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+
+namespace tasty_int {
+namespace detail {
+
+/**
+ * This class template provides a contiguous, dynamically-sized sequence of
+ * trivially-copyable values with the interface of std::vector.  The first
+ * INLINE_CAPACITY values are stored within the object itself, so sequences no
+ * longer than INLINE_CAPACITY are constructed, copied, and resized without
+ * touching the allocator.  Longer sequences spill to the heap.
+ *
+ * The default INLINE_CAPACITY of 2 spans a std::uintmax_t regardless of the
+ * width of digit_type, which covers the majority of values in practice.
+ *
+ * @tparam T               the value type
+ * @tparam INLINE_CAPACITY the number of values stored without allocation
+ */
+template<typename T, std::size_t INLINE_CAPACITY = 2>
+class SmallVector
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "SmallVector values must be trivially copyable.");
+    static_assert(INLINE_CAPACITY > 0,
+                  "SmallVector must store at least one value inline.");
+
+public:
+    typedef T                                     value_type;
+    typedef std::size_t                           size_type;
+    typedef std::ptrdiff_t                        difference_type;
+    typedef T                                    &reference;
+    typedef const T                              &const_reference;
+    typedef T                                    *pointer;
+    typedef const T                              *const_pointer;
+    typedef T                                    *iterator;
+    typedef const T                              *const_iterator;
+    typedef std::reverse_iterator<iterator>       reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    /**
+     * @brief Constructs an empty SmallVector.
+     */
+    SmallVector() noexcept
+        : values(inline_values)
+        , count(0)
+        , allocated(INLINE_CAPACITY)
+    {}
+
+    /**
+     * @brief Constructs a SmallVector of @p size value-initialized values.
+     *
+     * @param[in] size the initial size
+     */
+    explicit SmallVector(size_type size)
+        : SmallVector()
+    {
+        resize(size);
+    }
+
+    /**
+     * @brief Constructs a SmallVector of @p size copies of @p value.
+     *
+     * @param[in] size  the initial size
+     * @param[in] value the value to be copied
+     */
+    SmallVector(size_type  size,
+                const T   &value)
+        : SmallVector()
+    {
+        assign(size, value);
+    }
+
+    /**
+     * @brief Constructs a SmallVector from the values in [@p first, @p last).
+     *
+     * @param[in] first the beginning of the source range
+     * @param[in] last  the end of the source range
+     */
+    template<std::input_iterator InputIterator>
+    SmallVector(InputIterator first,
+                InputIterator last)
+        : SmallVector()
+    {
+        assign(first, last);
+    }
+
+    /**
+     * @brief Constructs a SmallVector from the values in @p init.
+     *
+     * @param[in] init the initial values
+     */
+    SmallVector(std::initializer_list<T> init)
+        : SmallVector(init.begin(), init.end())
+    {}
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param[in] other the SmallVector to be copied
+     */
+    SmallVector(const SmallVector &other)
+        : SmallVector(other.begin(), other.end())
+    {}
+
+    /**
+     * @brief Move constructor.  Heap storage is stolen from @p other, which is
+     *     left empty.
+     *
+     * @param[in] other the SmallVector to be moved
+     */
+    SmallVector(SmallVector &&other) noexcept
+        : SmallVector()
+    {
+        take(other);
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~SmallVector()
+    {
+        release();
+    }
+
+    /**
+     * @brief Copy assignment.
+     *
+     * @param[in] other the SmallVector to be copied
+     * @return a reference to this
+     */
+    SmallVector &
+    operator=(const SmallVector &other)
+    {
+        if (this != &other)
+            assign(other.begin(), other.end());
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment.  Heap storage is stolen from @p other, which is
+     *     left empty.
+     *
+     * @param[in] other the SmallVector to be moved
+     * @return a reference to this
+     */
+    SmallVector &
+    operator=(SmallVector &&other) noexcept
+    {
+        if (this != &other) {
+            release();
+            values    = inline_values;
+            count     = 0;
+            allocated = INLINE_CAPACITY;
+            take(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Initializer list assignment.
+     *
+     * @param[in] init the new values
+     * @return a reference to this
+     */
+    SmallVector &
+    operator=(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the contents with @p size copies of @p value.
+     *
+     * @param[in] size  the new size
+     * @param[in] value the value to be copied
+     */
+    void
+    assign(size_type  size,
+           const T   &value)
+    {
+        T copy = value;
+        count = 0;
+        reserve(size);
+        std::fill_n(values, size, copy);
+        count = size;
+    }
+
+    /**
+     * @brief Replaces the contents with the values in [@p first, @p last).
+     *
+     * @param[in] first the beginning of the source range
+     * @param[in] last  the end of the source range
+     */
+    template<std::input_iterator InputIterator>
+    void
+    assign(InputIterator first,
+           InputIterator last)
+    {
+        count = 0;
+
+        if constexpr (std::forward_iterator<InputIterator>) {
+            auto size = static_cast<size_type>(std::distance(first, last));
+            reserve(size);
+            std::copy(first, last, values);
+            count = size;
+        } else {
+            for (; first != last; ++first)
+                push_back(*first);
+        }
+    }
+
+    /**
+     * @brief Replaces the contents with the values in @p init.
+     *
+     * @param[in] init the new values
+     */
+    void
+    assign(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    reference
+    operator[](size_type index)
+    {
+        assert(index < count);
+        return values[index];
+    }
+
+    const_reference
+    operator[](size_type index) const
+    {
+        assert(index < count);
+        return values[index];
+    }
+
+    reference
+    at(size_type index)
+    {
+        check_index(index);
+        return values[index];
+    }
+
+    const_reference
+    at(size_type index) const
+    {
+        check_index(index);
+        return values[index];
+    }
+
+    reference
+    front()
+    {
+        return (*this)[0];
+    }
+
+    const_reference
+    front() const
+    {
+        return (*this)[0];
+    }
+
+    reference
+    back()
+    {
+        return (*this)[count - 1];
+    }
+
+    const_reference
+    back() const
+    {
+        return (*this)[count - 1];
+    }
+
+    pointer
+    data() noexcept
+    {
+        return values;
+    }
+
+    const_pointer
+    data() const noexcept
+    {
+        return values;
+    }
+
+    iterator
+    begin() noexcept
+    {
+        return values;
+    }
+
+    const_iterator
+    begin() const noexcept
+    {
+        return values;
+    }
+
+    const_iterator
+    cbegin() const noexcept
+    {
+        return values;
+    }
+
+    iterator
+    end() noexcept
+    {
+        return values + count;
+    }
+
+    const_iterator
+    end() const noexcept
+    {
+        return values + count;
+    }
+
+    const_iterator
+    cend() const noexcept
+    {
+        return values + count;
+    }
+
+    reverse_iterator
+    rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator
+    rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator
+    crbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    reverse_iterator
+    rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator
+    rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator
+    crend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    bool
+    empty() const noexcept
+    {
+        return count == 0;
+    }
+
+    size_type
+    size() const noexcept
+    {
+        return count;
+    }
+
+    size_type
+    capacity() const noexcept
+    {
+        return allocated;
+    }
+
+    /**
+     * @brief Query whether the values are stored within the object itself.
+     *
+     * @return true if no heap storage is held
+     */
+    bool
+    is_inline() const noexcept
+    {
+        return values == inline_values;
+    }
+
+    /**
+     * @brief Ensures that at least @p new_capacity values may be stored
+     *     without reallocation.
+     *
+     * @param[in] new_capacity the minimum capacity
+     */
+    void
+    reserve(size_type new_capacity)
+    {
+        if (new_capacity > allocated)
+            reallocate(new_capacity);
+    }
+
+    void
+    clear() noexcept
+    {
+        count = 0;
+    }
+
+    /**
+     * @brief Inserts @p value before @p position.
+     *
+     * @param[in] position the insertion point
+     * @param[in] value    the value to be inserted
+     * @return an iterator to the inserted value
+     */
+    iterator
+    insert(const_iterator  position,
+           const T        &value)
+    {
+        return insert(position, 1, value);
+    }
+
+    /**
+     * @brief Inserts @p size copies of @p value before @p position.
+     *
+     * @param[in] position the insertion point
+     * @param[in] size     the number of copies
+     * @param[in] value    the value to be copied
+     * @return an iterator to the first inserted value
+     */
+    iterator
+    insert(const_iterator  position,
+           size_type       size,
+           const T        &value)
+    {
+        T copy = value;
+        auto gap = open_gap(position, size);
+        std::fill_n(gap, size, copy);
+
+        return gap;
+    }
+
+    /**
+     * @brief Inserts the values in [@p first, @p last) before @p position.
+     *     As with std::vector, the source range may not refer to this.
+     *
+     * @param[in] position the insertion point
+     * @param[in] first    the beginning of the source range
+     * @param[in] last     the end of the source range
+     * @return an iterator to the first inserted value
+     */
+    template<std::forward_iterator ForwardIterator>
+    iterator
+    insert(const_iterator  position,
+           ForwardIterator first,
+           ForwardIterator last)
+    {
+        auto size = static_cast<size_type>(std::distance(first, last));
+        auto gap  = open_gap(position, size);
+        std::copy(first, last, gap);
+
+        return gap;
+    }
+
+    /**
+     * @brief Inserts the values in @p init before @p position.
+     *
+     * @param[in] position the insertion point
+     * @param[in] init     the values to be inserted
+     * @return an iterator to the first inserted value
+     */
+    iterator
+    insert(const_iterator           position,
+           std::initializer_list<T> init)
+    {
+        return insert(position, init.begin(), init.end());
+    }
+
+    /**
+     * @brief Removes the value at @p position.
+     *
+     * @param[in] position the value to be removed
+     * @return an iterator following the removed value
+     */
+    iterator
+    erase(const_iterator position)
+    {
+        return erase(position, position + 1);
+    }
+
+    /**
+     * @brief Removes the values in [@p first, @p last).
+     *
+     * @param[in] first the beginning of the range to be removed
+     * @param[in] last  the end of the range to be removed
+     * @return an iterator following the removed values
+     */
+    iterator
+    erase(const_iterator first,
+          const_iterator last)
+    {
+        auto erase_begin = values + (first - values);
+        std::copy(last, cend(), erase_begin);
+        count -= static_cast<size_type>(last - first);
+
+        return erase_begin;
+    }
+
+    void
+    push_back(const T &value)
+    {
+        T copy = value;
+        grow_by_one();
+        values[count++] = copy;
+    }
+
+    template<typename ...Args>
+    reference
+    emplace_back(Args &&...args)
+    {
+        T value(std::forward<Args>(args)...);
+        grow_by_one();
+
+        return values[count++] = value;
+    }
+
+    void
+    pop_back()
+    {
+        assert(count > 0);
+        --count;
+    }
+
+    /**
+     * @brief Resizes to @p size values, value-initializing any new values.
+     *
+     * @param[in] size the new size
+     */
+    void
+    resize(size_type size)
+    {
+        resize(size, T());
+    }
+
+    /**
+     * @brief Resizes to @p size values, copying @p value into any new values.
+     *
+     * @param[in] size  the new size
+     * @param[in] value the value to be copied
+     */
+    void
+    resize(size_type  size,
+           const T   &value)
+    {
+        if (size > count) {
+            T copy = value;
+            reserve(size);
+            std::fill(values + count, values + size, copy);
+        }
+
+        count = size;
+    }
+
+    void
+    swap(SmallVector &other) noexcept
+    {
+        SmallVector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    friend void
+    swap(SmallVector &lhs,
+         SmallVector &rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    friend bool
+    operator==(const SmallVector &lhs,
+               const SmallVector &rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+private:
+    void
+    check_index(size_type index) const
+    {
+        if (index >= count)
+            throw std::out_of_range("SmallVector index out of range.");
+    }
+
+    void
+    take(SmallVector &other) noexcept
+    {
+        if (other.is_inline()) {
+            std::memcpy(inline_values, other.inline_values,
+                        other.count * sizeof(T));
+        } else {
+            values    = other.values;
+            allocated = other.allocated;
+        }
+        count = other.count;
+
+        other.values    = other.inline_values;
+        other.count     = 0;
+        other.allocated = INLINE_CAPACITY;
+    }
+
+    void
+    release() noexcept
+    {
+        if (!is_inline())
+            std::allocator<T>().deallocate(values, allocated);
+    }
+
+    void
+    reallocate(size_type new_capacity)
+    {
+        auto new_values = std::allocator<T>().allocate(new_capacity);
+        if (count > 0)
+            std::memcpy(new_values, values, count * sizeof(T));
+
+        release();
+        values    = new_values;
+        allocated = new_capacity;
+    }
+
+    void
+    grow_to(size_type min_capacity)
+    {
+        if (min_capacity > allocated)
+            reallocate(std::max(min_capacity, allocated * 2));
+    }
+
+    void
+    grow_by_one()
+    {
+        grow_to(count + 1);
+    }
+
+    iterator
+    open_gap(const_iterator position,
+             size_type      size)
+    {
+        auto offset = static_cast<size_type>(position - values);
+        grow_to(count + size);
+
+        auto gap = values + offset;
+        std::memmove(gap + size, gap, (count - offset) * sizeof(T));
+        count += size;
+
+        return gap;
+    }
+
+    T         *values;
+    size_type  count;
+    size_type  allocated;
+    T          inline_values[INLINE_CAPACITY];
+}; // class SmallVector
+
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_SMALL_VECTOR_HPP
@@ -0,0 +1,183 @@
+#ifndef TASTY_INT_MAPPED_TASTY_INT_HPP
+#define TASTY_INT_MAPPED_TASTY_INT_HPP
+
+#include <compare>
+#include <filesystem>
+#include <string>
+
+#include "tasty_int/tasty_int.hpp"
+#include "tasty_int/detail/integer_file.hpp"
+#include "tasty_int/detail/integer_view.hpp"
+
+
+namespace tasty_int {
+
+/**
+ * @brief Writes @p value to the file at @p path in the integer file format,
+ *     replacing its contents.
+ *
+ * @details The file may be reopened without parsing as a
+ *     tasty_int::MappedTastyInt.  Its limbs are copied to disk verbatim, so
+ *     writing runs in linear time.
+ *
+ * @param[in] value an arbitrary-precision integer
+ * @param[in] path  the destination file path
+ *
+ * @throw std::ios_base::failure if the file could not be written
+ */
+inline void
+write_to_file(const TastyInt              &value,
+              const std::filesystem::path &path)
+{
+    detail::write_integer_file(prepare_operand(value), path);
+}
+
+/**
+ * This class is a read-only tasty_int::TastyInt whose digits reside in a
+ * file written by write_to_file(), mapped into memory rather than parsed.
+ * Opening a file costs the same regardless of its size; the pages holding the
+ * digits are only read as they are accessed.
+ *
+ * A MappedTastyInt may be compared, multiplied, and converted to string
+ * without copying its digits.  to_tasty_int() produces a mutable copy for any
+ * other operation.
+ */
+class MappedTastyInt
+{
+public:
+    /**
+     * @brief Maps the integer file at @p path.
+     *
+     * @param[in] path a file written by write_to_file()
+     *
+     * @throw std::system_error     if the file could not be opened or mapped
+     * @throw std::invalid_argument if the file is not a valid integer file
+     * @throw std::runtime_error    if the host is not little-endian
+     */
+    explicit
+    MappedTastyInt(const std::filesystem::path &path)
+        : file(path)
+    {}
+
+    /**
+     * @param[in] base the desired base of the output value.
+     *
+     * @details The output matches that of TastyInt::to_string().
+     *
+     * @throw std::invalid_argument if @p base is unsupported
+     */
+    std::string
+    to_string(unsigned int base = 10) const
+    {
+        return detail::conversions::string_from_integer(file.view(), base);
+    }
+
+    /**
+     * @return a copy of the mapped value
+     */
+    TastyInt
+    to_tasty_int() const
+    {
+        auto integer_view = file.view();
+
+        TastyInt copy;
+        auto &integer  = prepare_operand(copy);
+        integer.sign   = integer_view.sign;
+        integer.digits.assign(integer_view.digits.begin(),
+                              integer_view.digits.end());
+
+        return copy;
+    }
+
+private:
+    friend detail::IntegerView
+    prepare_operand(const MappedTastyInt &operand)
+    {
+        return operand.file.view();
+    }
+
+    /**
+     * @defgroup MappedTastyIntComparisonOperators MappedTastyInt Comparison
+     *     Operators
+     *
+     * These operators compare tasty_int::MappedTastyInt and
+     * tasty_int::TastyInt like TastyIntComparisonOperators.
+     */
+    /// @{
+    friend bool
+    operator==(const MappedTastyInt &lhs,
+               const MappedTastyInt &rhs)
+    {
+        return detail::compare(prepare_operand(lhs), prepare_operand(rhs))
+            == 0;
+    }
+
+    friend bool
+    operator==(const MappedTastyInt &lhs,
+               const TastyInt       &rhs)
+    {
+        return detail::compare(prepare_operand(lhs), prepare_operand(rhs))
+            == 0;
+    }
+
+    friend std::strong_ordering
+    operator<=>(const MappedTastyInt &lhs,
+                const MappedTastyInt &rhs)
+    {
+        return detail::compare(prepare_operand(lhs), prepare_operand(rhs));
+    }
+
+    friend std::strong_ordering
+    operator<=>(const MappedTastyInt &lhs,
+                const TastyInt       &rhs)
+    {
+        return detail::compare(prepare_operand(lhs), prepare_operand(rhs));
+    }
+    /// @}
+
+    /**
+     * @defgroup MappedTastyIntMultiplicationOperators MappedTastyInt
+     *     Multiplication Operators
+     *
+     * These operators multiply tasty_int::MappedTastyInt and
+     * tasty_int::TastyInt, producing a tasty_int::TastyInt.
+     */
+    /// @{
+    friend TastyInt
+    operator*(const MappedTastyInt &lhs,
+              const MappedTastyInt &rhs)
+    {
+        return multiply(prepare_operand(lhs), prepare_operand(rhs));
+    }
+
+    friend TastyInt
+    operator*(const MappedTastyInt &lhs,
+              const TastyInt       &rhs)
+    {
+        return multiply(prepare_operand(lhs), prepare_operand(rhs));
+    }
+
+    friend TastyInt
+    operator*(const TastyInt       &lhs,
+              const MappedTastyInt &rhs)
+    {
+        return multiply(prepare_operand(lhs), prepare_operand(rhs));
+    }
+    /// @}
+
+    static TastyInt
+    multiply(detail::IntegerView lhs,
+             detail::IntegerView rhs)
+    {
+        TastyInt product;
+        prepare_operand(product) = detail::multiply_integers(lhs, rhs);
+
+        return product;
+    }
+
+    detail::MappedIntegerFile file;
+}; // class MappedTastyInt
+
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_MAPPED_TASTY_INT_HPP
@@ -1,14 +1,20 @@
 #ifndef TASTY_INT_TASTY_INT_HPP
 #define TASTY_INT_TASTY_INT_HPP
 
+#include <cstddef>
+
+#include <charconv>
 #include <functional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 /// @todo: TODO: GenerateExportHeader
 #include "tasty_int/concepts.hpp"
+#include "tasty_int/binary_format.hpp"
 #include "tasty_int/detail/integer.hpp"
 #include "tasty_int/detail/integer_comparison.hpp"
 #include "tasty_int/detail/integer_addition.hpp"
@@ -21,10 +27,14 @@
 #include "tasty_int/detail/conversions/integer_from_signed_integral.hpp"
 #include "tasty_int/detail/conversions/integer_from_unsigned_integral.hpp"
 #include "tasty_int/detail/conversions/integer_from_string.hpp"
+#include "tasty_int/detail/conversions/integer_from_chars.hpp"
 #include "tasty_int/detail/conversions/floating_point_from_integer.hpp"
 #include "tasty_int/detail/conversions/signed_integral_from_integer.hpp"
 #include "tasty_int/detail/conversions/unsigned_integral_from_integer.hpp"
 #include "tasty_int/detail/conversions/string_from_integer.hpp"
+#include "tasty_int/detail/conversions/chars_from_integer.hpp"
+#include "tasty_int/detail/conversions/integer_from_bytes.hpp"
+#include "tasty_int/detail/conversions/bytes_from_integer.hpp"
 
 
 namespace tasty_int {
@@ -99,7 +109,8 @@ prepare_operand(UnsignedIntegralType operand)
  * tasty_int::TastyInt instance may be intialized from any primitive arithmetic
  * type as well as operate with them and other TastyInt instances through the
  * expected operator overloads.  Its value may also be initialized from or
- * be converted to an ASCII string of numerical digits.
+ * be converted to an ASCII string of numerical digits or a compact binary
+ * encoding.
  */
 class TastyInt
 {
@@ -214,17 +225,17 @@ public:
      */
     /// @{
     /**
-     * @details The result is truncated towards zero.  If the result is too
-     *     big, a hardware overflow trap may occur.  In the case that a trap
-     *     does not occur, an appropriately-signed infinity will be returned.
+     * @details The result is rounded to the nearest representable value, ties
+     *     to even, in constant time.  If the result is too big, an
+     *     appropriately-signed infinity will be returned.
      */
     template<FloatingPoint FloatingPointType>
     FloatingPointType
     to_number() const
     {
-        return static_cast<FloatingPointType>(
-            detail::conversions::floating_point_from_integer(integer)
-        );
+        return detail::conversions::floating_point_from_integer<
+            FloatingPointType
+        >(integer);
     }
 
     /**
@@ -274,6 +285,90 @@ public:
         return detail::conversions::string_from_integer(integer, base);
     }
 
+    /**
+     * @param[in] base the desired base of the output value.
+     *
+     * @return an upper bound on the number of characters written by
+     *     to_chars(), exceeding the exact count `n` by at most
+     *     `2 + n / 2^19`
+     *
+     * @throw std::invalid_argument if @p base is unsupported
+     */
+    std::size_t
+    max_chars(unsigned int base = 10) const
+    {
+        return detail::conversions::max_chars_from_integer(integer, base);
+    }
+
+    /**
+     * @defgroup TastyIntBinary TastyInt Binary Conversions
+     *
+     * @brief Encode or decode a tasty_int::TastyInt as a sign byte followed by
+     *     the words of its magnitude a la GMP's mpz_export()/mpz_import().
+     *
+     * @details The layout of the encoding is described by a
+     *     tasty_int::BinaryFormat.  Unlike to_string(), these conversions copy
+     *     the magnitude directly and run in linear time.
+     *
+     * @throw std::invalid_argument if @p format has a `word_size` of zero or
+     *     an unsupported `byte_order`
+     */
+    /// @{
+    /**
+     * @param[in] format the layout of the encoding
+     * @return the exact number of bytes written by to_binary()
+     */
+    std::size_t
+    binary_size(const BinaryFormat &format = BinaryFormat()) const
+    {
+        return detail::conversions::count_bytes_from_integer(integer, format);
+    }
+
+    /**
+     * @param[out] bytes  the destination buffer, which may be sized with
+     *     binary_size()
+     * @param[in]  format the layout of the encoding
+     * @return the number of bytes written to the front of @p bytes
+     *
+     * @throw std::invalid_argument if @p bytes is too small
+     */
+    std::size_t
+    to_binary(std::span<std::byte>  bytes,
+              const BinaryFormat   &format = BinaryFormat()) const
+    {
+        return detail::conversions::bytes_from_integer(integer, format, bytes);
+    }
+
+    /**
+     * @param[in] format the layout of the encoding
+     * @return the encoding of `this`
+     */
+    std::vector<std::byte>
+    to_binary(const BinaryFormat &format = BinaryFormat()) const
+    {
+        std::vector<std::byte> bytes(binary_size(format));
+
+        to_binary(bytes, format);
+
+        return bytes;
+    }
+
+    /**
+     * @param[in] bytes  an encoding written by to_binary() with @p format
+     * @param[in] format the layout of the encoding
+     * @return the decoded value
+     *
+     * @throw std::invalid_argument if @p bytes is not a sign byte of 0x00 or
+     *     0x01 followed by a whole number of words
+     */
+    static TastyInt
+    from_binary(std::span<const std::byte>  bytes,
+                const BinaryFormat         &format = BinaryFormat())
+    {
+        return detail::conversions::integer_from_bytes(bytes, format);
+    }
+    /// @}
+
 
     /**
      * @defgroup TastyIntUnaryOperators TastyInt Unary Operators
@@ -505,6 +600,62 @@ private:
         return output << prepare_operand(tasty_int);
     }
 
+    /**
+     * @brief Writes @p tasty_int to the character range [@p first, @p last) a
+     *     la std::to_chars().
+     *
+     * @details The characters written match those of to_string().  No
+     *     null-terminator is appended and no memory is allocated for the
+     *     result; TastyInt::max_chars() may be used to size the range.
+     *
+     * @param[out] first     the beginning of the destination range
+     * @param[out] last      the end of the destination range
+     * @param[in]  tasty_int an arbitrary-precision integer
+     * @param[in]  base      the desired base of the output value
+     * @return `{ one past the last character written, std::errc() }` on
+     *     success, otherwise `{ last, std::errc::value_too_large }`
+     *
+     * @throw std::invalid_argument if @p base is unsupported
+     */
+    friend std::to_chars_result
+    to_chars(char           *first,
+             char           *last,
+             const TastyInt &tasty_int,
+             unsigned int    base = 10)
+    {
+        return detail::conversions::chars_from_integer(
+            prepare_operand(tasty_int), base, first, last
+        );
+    }
+
+    /**
+     * @brief Parses @p tasty_int from the character range [@p first, @p last)
+     *     a la std::from_chars().
+     *
+     * @details An optional minus sign followed by the longest run of tokens
+     *     valid in base @p base is consumed.  Leading whitespace, a plus sign,
+     *     and base-specific prefixes are not accepted.
+     *
+     * @param[in]  first     the beginning of the source range
+     * @param[in]  last      the end of the source range
+     * @param[out] tasty_int the parsed value, unmodified if no number was found
+     * @param[in]  base      the base of the input tokens
+     * @return `{ one past the last character consumed, std::errc() }` on
+     *     success, otherwise `{ first, std::errc::invalid_argument }`
+     *
+     * @throw std::invalid_argument if @p base is unsupported
+     */
+    friend std::from_chars_result
+    from_chars(const char   *first,
+               const char   *last,
+               TastyInt     &tasty_int,
+               unsigned int  base = 10)
+    {
+        return detail::conversions::integer_from_chars(
+            first, last, base, prepare_operand(tasty_int)
+        );
+    }
+
     TastyInt(detail::Integer &&result)
         : integer(std::move(result))
     {}
@@ -0,0 +1,96 @@
+#ifndef TASTY_INT_TASTY_INT_DIVISOR_HPP
+#define TASTY_INT_TASTY_INT_DIVISOR_HPP
+
+#include <utility>
+
+#include "tasty_int/tasty_int.hpp"
+#include "tasty_int/detail/integer_division.hpp"
+
+
+namespace tasty_int {
+
+/**
+ * This class is a tasty_int::TastyInt divisor (or modulus) prepared once for
+ * many divisions.  Construction normalizes the divisor and computes its
+ * reciprocal, so that dividing by a large divisor repeatedly, as when
+ * reducing many values by a fixed modulus, costs only a few multiplications
+ * per division.
+ *
+ * Results are identical to those of the TastyInt division operators and
+ * tasty_int::div().
+ */
+class TastyIntDivisor
+{
+public:
+    /**
+     * @brief Prepares @p divisor for division.
+     *
+     * @param[in] divisor the divisor
+     *
+     * @pre `divisor != 0`
+     */
+    explicit
+    TastyIntDivisor(const TastyInt &divisor)
+        : integer_divisor(prepare_operand(divisor))
+    {}
+
+    /**
+     * @return a copy of the original divisor
+     */
+    TastyInt
+    value() const
+    {
+        return from_integer(integer_divisor.value());
+    }
+
+    /**
+     * @return `dividend / divisor`
+     */
+    TastyInt
+    divide(const TastyInt &dividend) const
+    {
+        return from_integer(integer_divisor.divide(prepare_operand(dividend)));
+    }
+
+    /**
+     * @return `dividend % divisor`
+     */
+    TastyInt
+    reduce(const TastyInt &dividend) const
+    {
+        return from_integer(integer_divisor.reduce(prepare_operand(dividend)));
+    }
+
+    /**
+     * @return `div(dividend, divisor)`
+     */
+    TastyIntDivisionResult<TastyInt>
+    div(const TastyInt &dividend) const
+    {
+        auto integer_division_result =
+            integer_divisor.div(prepare_operand(dividend));
+
+        return {
+            .quotient  =
+                from_integer(std::move(integer_division_result.quotient)),
+            .remainder =
+                from_integer(std::move(integer_division_result.remainder))
+        };
+    }
+
+private:
+    static TastyInt
+    from_integer(detail::Integer &&integer)
+    {
+        TastyInt result;
+        prepare_operand(result) = std::move(integer);
+
+        return result;
+    }
+
+    detail::IntegerDivisor integer_divisor;
+}; // class TastyIntDivisor
+
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DIVISOR_HPP
@@ -0,0 +1,128 @@
+#ifndef TASTY_INT_TASTY_INT_MONTGOMERY_HPP
+#define TASTY_INT_TASTY_INT_MONTGOMERY_HPP
+
+#include <utility>
+
+#include "tasty_int/tasty_int.hpp"
+#include "tasty_int/detail/integer_montgomery.hpp"
+
+
+namespace tasty_int {
+
+/**
+ * This class is an odd tasty_int::TastyInt modulus `m` prepared for modular
+ * arithmetic in Montgomery form.  A residue `a` is represented in Montgomery
+ * form by `a*R mod m` for a power of two `R > m` fixed by the modulus, and the
+ * product of two values in Montgomery form is reduced by a digit shift rather
+ * than a division.
+ *
+ * Convert operands with to_montgomery(), combine them with multiply() and
+ * square(), and convert the result back with from_montgomery().  pow_mod()
+ * does all three.  Results lie in `[0, m)`.
+ */
+class TastyIntMontgomeryContext
+{
+public:
+    /**
+     * @brief Prepares @p modulus for Montgomery arithmetic.
+     *
+     * @param[in] modulus the modulus
+     *
+     * @pre `modulus > 0` and @p modulus is odd
+     */
+    explicit
+    TastyIntMontgomeryContext(const TastyInt &modulus)
+        : integer_context(prepare_operand(modulus))
+    {}
+
+    /**
+     * @return a copy of the modulus
+     */
+    TastyInt
+    value() const
+    {
+        return from_integer(integer_context.value());
+    }
+
+    /**
+     * @return the Montgomery form of `value mod m`
+     */
+    TastyInt
+    to_montgomery(const TastyInt &value) const
+    {
+        return from_integer(
+            integer_context.to_montgomery(prepare_operand(value))
+        );
+    }
+
+    /**
+     * @return the residue represented by Montgomery form @p value
+     *
+     * @pre `(value >= 0) && (value < m)`
+     */
+    TastyInt
+    from_montgomery(const TastyInt &value) const
+    {
+        return from_integer(
+            integer_context.from_montgomery(prepare_operand(value))
+        );
+    }
+
+    /**
+     * @return the Montgomery form of the product of Montgomery forms @p lhs
+     *     and @p rhs
+     *
+     * @pre `(lhs >= 0) && (lhs < m) && (rhs >= 0) && (rhs < m)`
+     */
+    TastyInt
+    multiply(const TastyInt &lhs,
+             const TastyInt &rhs) const
+    {
+        return from_integer(
+            integer_context.multiply(prepare_operand(lhs),
+                                     prepare_operand(rhs))
+        );
+    }
+
+    /**
+     * @return the Montgomery form of the square of Montgomery form @p value
+     *
+     * @pre `(value >= 0) && (value < m)`
+     */
+    TastyInt
+    square(const TastyInt &value) const
+    {
+        return from_integer(integer_context.square(prepare_operand(value)));
+    }
+
+    /**
+     * @return `base^exponent mod m`
+     *
+     * @pre `exponent >= 0`
+     */
+    TastyInt
+    pow_mod(const TastyInt &base,
+            const TastyInt &exponent) const
+    {
+        return from_integer(
+            integer_context.pow_mod(prepare_operand(base),
+                                    prepare_operand(exponent))
+        );
+    }
+
+private:
+    static TastyInt
+    from_integer(detail::Integer &&integer)
+    {
+        TastyInt result;
+        prepare_operand(result) = std::move(integer);
+
+        return result;
+    }
+
+    detail::IntegerMontgomeryContext integer_context;
+}; // class TastyIntMontgomeryContext
+
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_MONTGOMERY_HPP
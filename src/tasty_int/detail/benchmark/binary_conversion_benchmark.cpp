@@ -0,0 +1,147 @@
+#include <cstddef>
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tasty_int/detail/benchmark/digits_benchmark.hpp"
+#include "tasty_int/detail/conversions/bytes_from_integer.hpp"
+#include "tasty_int/detail/conversions/integer_from_bytes.hpp"
+#include "tasty_int/detail/conversions/string_from_integer.hpp"
+
+
+namespace {
+
+using tasty_int::BinaryFormat;
+using tasty_int::WordOrder;
+using tasty_int::detail::Integer;
+using tasty_int::detail::Sign;
+using tasty_int::detail::conversions::bytes_from_integer;
+using tasty_int::detail::conversions::count_bytes_from_integer;
+using tasty_int::detail::conversions::integer_from_bytes;
+using tasty_int::detail::conversions::string_from_integer;
+using digits_benchmark::DigitsBenchmark;
+
+
+/**
+ * Compares the binary conversions of an Integer against its hexadecimal
+ * string conversion, the most compact text form, in the default format and
+ * in the big-endian format of most wire protocols.
+ */
+class BinaryConversionBenchmark : public DigitsBenchmark
+{
+public:
+    static constexpr int RANGE_MULTIPLIER           = 8;
+    static constexpr int RANGE_FIRST                = 8;
+    static constexpr int RANGE_LAST                 = RANGE_FIRST << 12;
+    static constexpr benchmark::TimeUnit TIME_UNITS = benchmark::kMicrosecond;
+
+    static constexpr BinaryFormat BIG_ENDIAN_FORMAT = {
+        .word_size  = 4,
+        .word_order = WordOrder::MOST_SIGNIFICANT_FIRST,
+        .byte_order = std::endian::big
+    };
+
+    void SetUp(benchmark::State &state) override
+    {
+        DigitsBenchmark::SetUp(state);
+
+        integer = { .sign = Sign::POSITIVE, .digits = digits };
+    }
+
+protected:
+    void
+    run_bytes_from_integer(benchmark::State   &state,
+                           const BinaryFormat &format)
+    {
+        std::vector<std::byte> bytes(count_bytes_from_integer(integer, format));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(bytes.data());
+
+            bytes_from_integer(integer, format, bytes);
+
+            benchmark::ClobberMemory();
+        }
+    }
+
+    void
+    run_integer_from_bytes(benchmark::State   &state,
+                           const BinaryFormat &format)
+    {
+        std::vector<std::byte> bytes(count_bytes_from_integer(integer, format));
+        bytes_from_integer(integer, format, bytes);
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(integer_from_bytes(bytes, format));
+    }
+
+    Integer integer;
+}; // class BinaryConversionBenchmark
+
+BENCHMARK_DEFINE_F(BinaryConversionBenchmark, StringFromIntegerHex)(
+    benchmark::State &state
+)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(string_from_integer(integer, 16));
+}
+BENCHMARK_REGISTER_F(BinaryConversionBenchmark, StringFromIntegerHex)
+    ->RangeMultiplier(BinaryConversionBenchmark::RANGE_MULTIPLIER)
+    ->Range(BinaryConversionBenchmark::RANGE_FIRST,
+            BinaryConversionBenchmark::RANGE_LAST)
+    ->Unit(BinaryConversionBenchmark::TIME_UNITS);
+
+BENCHMARK_DEFINE_F(BinaryConversionBenchmark, BytesFromIntegerDefault)(
+    benchmark::State &state
+)
+{
+    run_bytes_from_integer(state, BinaryFormat());
+}
+BENCHMARK_REGISTER_F(BinaryConversionBenchmark, BytesFromIntegerDefault)
+    ->RangeMultiplier(BinaryConversionBenchmark::RANGE_MULTIPLIER)
+    ->Range(BinaryConversionBenchmark::RANGE_FIRST,
+            BinaryConversionBenchmark::RANGE_LAST)
+    ->Unit(BinaryConversionBenchmark::TIME_UNITS);
+
+BENCHMARK_DEFINE_F(BinaryConversionBenchmark, BytesFromIntegerBigEndian)(
+    benchmark::State &state
+)
+{
+    run_bytes_from_integer(state, BIG_ENDIAN_FORMAT);
+}
+BENCHMARK_REGISTER_F(BinaryConversionBenchmark, BytesFromIntegerBigEndian)
+    ->RangeMultiplier(BinaryConversionBenchmark::RANGE_MULTIPLIER)
+    ->Range(BinaryConversionBenchmark::RANGE_FIRST,
+            BinaryConversionBenchmark::RANGE_LAST)
+    ->Unit(BinaryConversionBenchmark::TIME_UNITS);
+
+BENCHMARK_DEFINE_F(BinaryConversionBenchmark, IntegerFromBytesDefault)(
+    benchmark::State &state
+)
+{
+    run_integer_from_bytes(state, BinaryFormat());
+}
+BENCHMARK_REGISTER_F(BinaryConversionBenchmark, IntegerFromBytesDefault)
+    ->RangeMultiplier(BinaryConversionBenchmark::RANGE_MULTIPLIER)
+    ->Range(BinaryConversionBenchmark::RANGE_FIRST,
+            BinaryConversionBenchmark::RANGE_LAST)
+    ->Unit(BinaryConversionBenchmark::TIME_UNITS);
+
+BENCHMARK_DEFINE_F(BinaryConversionBenchmark, IntegerFromBytesBigEndian)(
+    benchmark::State &state
+)
+{
+    run_integer_from_bytes(state, BIG_ENDIAN_FORMAT);
+}
+BENCHMARK_REGISTER_F(BinaryConversionBenchmark, IntegerFromBytesBigEndian)
+    ->RangeMultiplier(BinaryConversionBenchmark::RANGE_MULTIPLIER)
+    ->Range(BinaryConversionBenchmark::RANGE_FIRST,
+            BinaryConversionBenchmark::RANGE_LAST)
+    ->Unit(BinaryConversionBenchmark::TIME_UNITS);
+
+} // namespace
+
+
+// Run the benchmark
+BENCHMARK_MAIN();
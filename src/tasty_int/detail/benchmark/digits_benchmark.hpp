@@ -1,8 +1,8 @@
-#include <vector>
 
 #include "benchmark/benchmark.h"
 
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 
 
 namespace digits_benchmark {
@@ -26,7 +26,7 @@ public:
     }
 
 protected:
-    std::vector<tasty_int::detail::digit_type> digits;
+    tasty_int::detail::SmallVector<tasty_int::detail::digit_type> digits;
 }; // class DigitsBenchmark
 
 } // namespace digits_benchmark
@@ -7,6 +7,7 @@
 
 namespace {
 
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 using digits_benchmark::DigitsBenchmark;
 
@@ -25,7 +26,7 @@ BENCHMARK_DEFINE_F(LeftShiftBySingleDigitBenchmark, ResizeThenCopy)(
 )
 {
     for (auto _ : state) {
-        std::vector<digit_type> result(digits.size() + 1);
+        SmallVector<digit_type> result(digits.size() + 1);
 
         benchmark::DoNotOptimize(result.data());
 
@@ -47,7 +48,7 @@ BENCHMARK_DEFINE_F(LeftShiftBySingleDigitBenchmark, ReserveThenInsert)(
 )
 {
     for (auto _ : state) {
-        std::vector<digit_type> result;
+        SmallVector<digit_type> result;
         result.reserve(digits.size() + 1);
 
         benchmark::DoNotOptimize(result.data());
@@ -12,6 +12,11 @@ namespace {
 
 using tasty_int::detail::long_divide;
 using tasty_int::detail::divide_and_conquer_divide;
+using tasty_int::detail::newton_divide;
+using tasty_int::detail::long_divide_remainder;
+using tasty_int::detail::divide_and_conquer_divide_remainder;
+using tasty_int::detail::newton_divide_remainder;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 using tasty_int::detail::DIGIT_TYPE_MAX;
 using tasty_int::detail::DIGIT_TYPE_BITS;
@@ -54,7 +59,7 @@ public:
     }
 
 protected:
-    std::vector<digit_type> divisor;
+    SmallVector<digit_type> divisor;
 }; // class DigitsDivisionBenchmark
 
 BENCHMARK_DEFINE_F(DigitsDivisionBenchmark, LongDivide)(benchmark::State &state)
@@ -77,6 +82,52 @@ BENCHMARK_REGISTER_F(DigitsDivisionBenchmark, DivideAndConquerDivide)
     ->Apply(DigitsDivisionBenchmark::make_arguments)
     ->Unit(DigitsDivisionBenchmark::TIME_UNITS);
 
+BENCHMARK_DEFINE_F(DigitsDivisionBenchmark, NewtonDivide)(
+    benchmark::State &state
+)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(newton_divide(digits, divisor));
+}
+BENCHMARK_REGISTER_F(DigitsDivisionBenchmark, NewtonDivide)
+    ->Apply(DigitsDivisionBenchmark::make_arguments)
+    ->Unit(DigitsDivisionBenchmark::TIME_UNITS);
+
+BENCHMARK_DEFINE_F(DigitsDivisionBenchmark, LongDivideRemainder)(
+    benchmark::State &state
+)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(long_divide_remainder(digits, divisor));
+}
+BENCHMARK_REGISTER_F(DigitsDivisionBenchmark, LongDivideRemainder)
+    ->Apply(DigitsDivisionBenchmark::make_arguments)
+    ->Unit(DigitsDivisionBenchmark::TIME_UNITS);
+
+BENCHMARK_DEFINE_F(DigitsDivisionBenchmark, DivideAndConquerDivideRemainder)(
+    benchmark::State &state
+)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(
+            divide_and_conquer_divide_remainder(digits, divisor)
+        );
+}
+BENCHMARK_REGISTER_F(DigitsDivisionBenchmark, DivideAndConquerDivideRemainder)
+    ->Apply(DigitsDivisionBenchmark::make_arguments)
+    ->Unit(DigitsDivisionBenchmark::TIME_UNITS);
+
+BENCHMARK_DEFINE_F(DigitsDivisionBenchmark, NewtonDivideRemainder)(
+    benchmark::State &state
+)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(newton_divide_remainder(digits, divisor));
+}
+BENCHMARK_REGISTER_F(DigitsDivisionBenchmark, NewtonDivideRemainder)
+    ->Apply(DigitsDivisionBenchmark::make_arguments)
+    ->Unit(DigitsDivisionBenchmark::TIME_UNITS);
+
 
 class DigitsAndIntegralDivisionBenchmark : public DigitsBenchmark
 {
@@ -122,6 +173,17 @@ BENCHMARK_REGISTER_F(DigitsAndIntegralDivisionBenchmark, LongDivide)
     ->Apply(DigitsAndIntegralDivisionBenchmark::make_arguments)
     ->Unit(DigitsAndIntegralDivisionBenchmark::TIME_UNITS);
 
+BENCHMARK_DEFINE_F(DigitsAndIntegralDivisionBenchmark, LongDivideRemainder)(
+    benchmark::State &state
+)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(long_divide_remainder(digits, divisor));
+}
+BENCHMARK_REGISTER_F(DigitsAndIntegralDivisionBenchmark, LongDivideRemainder)
+    ->Apply(DigitsAndIntegralDivisionBenchmark::make_arguments)
+    ->Unit(DigitsAndIntegralDivisionBenchmark::TIME_UNITS);
+
 BENCHMARK_DEFINE_F(DigitsAndIntegralDivisionBenchmark, ConvertThenLongDivide)(
     benchmark::State &state
 )
@@ -9,7 +9,16 @@ namespace {
 
 using tasty_int::detail::long_multiply;
 using tasty_int::detail::karatsuba_multiply;
+using tasty_int::detail::toom_3_multiply;
+using tasty_int::detail::number_theoretic_transform_multiply;
+using tasty_int::detail::unbalanced_multiply;
+using tasty_int::detail::long_square;
+using tasty_int::detail::karatsuba_square;
+using tasty_int::detail::toom_3_square;
+using tasty_int::detail::number_theoretic_transform_square;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
+using tasty_int::detail::DIGIT_TYPE_MAX;
 using digits_benchmark::DigitsBenchmark;
 
 
@@ -25,7 +34,9 @@ public:
     {
         DigitsBenchmark::SetUp(state);
 
-        multiplier = digits;
+        // distinct from digits so that multiplication is not routed to
+        // squaring
+        multiplier.assign(digits.size(), DIGIT_TYPE_MAX - 1);
     }
 
     void TearDown(benchmark::State &state) override
@@ -36,7 +47,7 @@ public:
     }
 
 protected:
-    std::vector<digit_type> multiplier;
+    SmallVector<digit_type> multiplier;
 }; // class DigitsMultiplicationBenchmark
 
 BENCHMARK_DEFINE_F(DigitsMultiplicationBenchmark, LongMultiply)(
@@ -65,6 +76,145 @@ BENCHMARK_REGISTER_F(DigitsMultiplicationBenchmark, KaratsubaMultiply)
             DigitsMultiplicationBenchmark::RANGE_LAST) 
     ->Unit(DigitsMultiplicationBenchmark::TIME_UNITS);
 
+BENCHMARK_DEFINE_F(DigitsMultiplicationBenchmark, Toom3Multiply)(
+    benchmark::State &state
+)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(toom_3_multiply(digits, multiplier));
+}
+BENCHMARK_REGISTER_F(DigitsMultiplicationBenchmark, Toom3Multiply)
+    ->RangeMultiplier(DigitsMultiplicationBenchmark::RANGE_MULTIPLIER)
+    ->Range(DigitsMultiplicationBenchmark::RANGE_FIRST,
+            DigitsMultiplicationBenchmark::RANGE_LAST) 
+    ->Unit(DigitsMultiplicationBenchmark::TIME_UNITS);
+
+BENCHMARK_DEFINE_F(DigitsMultiplicationBenchmark,
+                   NumberTheoreticTransformMultiply)(
+    benchmark::State &state
+)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(
+            number_theoretic_transform_multiply(digits, multiplier)
+        );
+}
+BENCHMARK_REGISTER_F(DigitsMultiplicationBenchmark,
+                     NumberTheoreticTransformMultiply)
+    ->RangeMultiplier(DigitsMultiplicationBenchmark::RANGE_MULTIPLIER)
+    ->Range(DigitsMultiplicationBenchmark::RANGE_FIRST,
+            DigitsMultiplicationBenchmark::RANGE_LAST) 
+    ->Unit(DigitsMultiplicationBenchmark::TIME_UNITS);
+
+BENCHMARK_DEFINE_F(DigitsMultiplicationBenchmark, LongSquare)(
+    benchmark::State &state
+)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(long_square(digits));
+}
+BENCHMARK_REGISTER_F(DigitsMultiplicationBenchmark, LongSquare)
+    ->RangeMultiplier(DigitsMultiplicationBenchmark::RANGE_MULTIPLIER)
+    ->Range(DigitsMultiplicationBenchmark::RANGE_FIRST,
+            DigitsMultiplicationBenchmark::RANGE_LAST) 
+    ->Unit(DigitsMultiplicationBenchmark::TIME_UNITS);
+
+BENCHMARK_DEFINE_F(DigitsMultiplicationBenchmark, KaratsubaSquare)(
+    benchmark::State &state
+)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(karatsuba_square(digits));
+}
+BENCHMARK_REGISTER_F(DigitsMultiplicationBenchmark, KaratsubaSquare)
+    ->RangeMultiplier(DigitsMultiplicationBenchmark::RANGE_MULTIPLIER)
+    ->Range(DigitsMultiplicationBenchmark::RANGE_FIRST,
+            DigitsMultiplicationBenchmark::RANGE_LAST) 
+    ->Unit(DigitsMultiplicationBenchmark::TIME_UNITS);
+
+BENCHMARK_DEFINE_F(DigitsMultiplicationBenchmark, Toom3Square)(
+    benchmark::State &state
+)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(toom_3_square(digits));
+}
+BENCHMARK_REGISTER_F(DigitsMultiplicationBenchmark, Toom3Square)
+    ->RangeMultiplier(DigitsMultiplicationBenchmark::RANGE_MULTIPLIER)
+    ->Range(DigitsMultiplicationBenchmark::RANGE_FIRST,
+            DigitsMultiplicationBenchmark::RANGE_LAST) 
+    ->Unit(DigitsMultiplicationBenchmark::TIME_UNITS);
+
+BENCHMARK_DEFINE_F(DigitsMultiplicationBenchmark,
+                   NumberTheoreticTransformSquare)(
+    benchmark::State &state
+)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(number_theoretic_transform_square(digits));
+}
+BENCHMARK_REGISTER_F(DigitsMultiplicationBenchmark,
+                     NumberTheoreticTransformSquare)
+    ->RangeMultiplier(DigitsMultiplicationBenchmark::RANGE_MULTIPLIER)
+    ->Range(DigitsMultiplicationBenchmark::RANGE_FIRST,
+            DigitsMultiplicationBenchmark::RANGE_LAST) 
+    ->Unit(DigitsMultiplicationBenchmark::TIME_UNITS);
+
+class DigitsUnbalancedMultiplicationBenchmark : public DigitsBenchmark
+{
+public:
+    static constexpr int RANGE_MULTIPLIER           = 4;
+    static constexpr int RANGE_FIRST                = 1 << 10;
+    static constexpr int RANGE_LAST                 = RANGE_FIRST << 8;
+    static constexpr int MULTIPLIER_SIZE            = 500;
+    static constexpr benchmark::TimeUnit TIME_UNITS = benchmark::kMillisecond;
+
+    void SetUp(benchmark::State &state) override
+    {
+        DigitsBenchmark::SetUp(state);
+
+        multiplier.assign(MULTIPLIER_SIZE, DIGIT_TYPE_MAX - 1);
+    }
+
+    void TearDown(benchmark::State &state) override
+    {
+        DigitsBenchmark::TearDown(state);
+
+        multiplier.clear();
+    }
+
+protected:
+    SmallVector<digit_type> multiplier;
+}; // class DigitsUnbalancedMultiplicationBenchmark
+
+BENCHMARK_DEFINE_F(DigitsUnbalancedMultiplicationBenchmark, KaratsubaMultiply)(
+    benchmark::State &state
+)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(karatsuba_multiply(digits, multiplier));
+}
+BENCHMARK_REGISTER_F(DigitsUnbalancedMultiplicationBenchmark, KaratsubaMultiply)
+    ->RangeMultiplier(DigitsUnbalancedMultiplicationBenchmark::RANGE_MULTIPLIER)
+    ->Range(DigitsUnbalancedMultiplicationBenchmark::RANGE_FIRST,
+            DigitsUnbalancedMultiplicationBenchmark::RANGE_LAST)
+    ->Unit(DigitsUnbalancedMultiplicationBenchmark::TIME_UNITS);
+
+BENCHMARK_DEFINE_F(DigitsUnbalancedMultiplicationBenchmark,
+                   UnbalancedMultiply)(
+    benchmark::State &state
+)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(unbalanced_multiply(digits, multiplier));
+}
+BENCHMARK_REGISTER_F(DigitsUnbalancedMultiplicationBenchmark,
+                     UnbalancedMultiply)
+    ->RangeMultiplier(DigitsUnbalancedMultiplicationBenchmark::RANGE_MULTIPLIER)
+    ->Range(DigitsUnbalancedMultiplicationBenchmark::RANGE_FIRST,
+            DigitsUnbalancedMultiplicationBenchmark::RANGE_LAST)
+    ->Unit(DigitsUnbalancedMultiplicationBenchmark::TIME_UNITS);
+
 } // namespace
 
 
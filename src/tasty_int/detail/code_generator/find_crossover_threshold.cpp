@@ -0,0 +1,51 @@
+#include "tasty_int/detail/code_generator/find_crossover_threshold.hpp"
+
+#include <cassert>
+
+#include <algorithm>
+
+
+namespace tasty_int {
+namespace detail {
+namespace code_generator {
+namespace {
+
+std::size_t
+next_sweep_size(std::size_t size)
+{
+    return size + std::max<std::size_t>(1, size / 8);
+}
+
+} // namespace
+
+
+std::size_t
+find_crossover_threshold(const CrossoverSweep &sweep,
+                         const AlgorithmTimer &time_lower,
+                         const AlgorithmTimer &time_higher)
+{
+    assert(sweep.first_size > 0);
+    assert(sweep.first_size <= sweep.last_size);
+
+    constexpr unsigned int REQUIRED_CONSECUTIVE_WINS = 2;
+
+    std::size_t  last_lower_win_size = sweep.first_size;
+    unsigned int higher_wins         = 0;
+
+    for (auto size = sweep.first_size; size <= sweep.last_size;
+         size = next_sweep_size(size)) {
+        if (time_higher(size) < time_lower(size)) {
+            if (++higher_wins == REQUIRED_CONSECUTIVE_WINS)
+                return last_lower_win_size;
+        } else {
+            last_lower_win_size = size;
+            higher_wins         = 0;
+        }
+    }
+
+    return sweep.last_size;
+}
+
+} // namespace code_generator
+} // namespace detail
+} // namespace tasty_int
@@ -0,0 +1,56 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_CODE_GENERATOR_FIND_CROSSOVER_THRESHOLD_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_CODE_GENERATOR_FIND_CROSSOVER_THRESHOLD_HPP
+
+#include <cstddef>
+
+#include <functional>
+
+
+namespace tasty_int {
+namespace detail {
+namespace code_generator {
+
+/**
+ * This struct defines the range of operand sizes searched for a crossover
+ * threshold.
+ */
+struct CrossoverSweep
+{
+    std::size_t first_size; ///< the smallest operand size timed
+    std::size_t last_size;  ///< the largest operand size timed
+}; // struct CrossoverSweep
+
+/**
+ * A function that returns the duration, in seconds, of an algorithm applied
+ * to operands of the provided size.
+ */
+typedef std::function<double (std::size_t size)> AlgorithmTimer;
+
+/**
+ * @brief Finds the largest operand size for which a lower-tier algorithm is
+ *     still preferable to its asymptotically faster successor.
+ *
+ * @details Operand sizes are swept from `sweep.first_size` to
+ *     `sweep.last_size` in steps of one eighth.  The crossover is the last
+ *     size at which the lower tier won before the higher tier won at two
+ *     consecutive sizes, so that a single noisy measurement does not end the
+ *     search early.
+ *
+ * @param[in] sweep       the range of operand sizes to search
+ * @param[in] time_lower  times the lower-tier algorithm
+ * @param[in] time_higher times the higher-tier algorithm
+ * @return the threshold, in `[sweep.first_size, sweep.last_size]`, at or below
+ *     which the lower-tier algorithm should be used
+ *
+ * @pre `0 < sweep.first_size <= sweep.last_size`
+ */
+std::size_t
+find_crossover_threshold(const CrossoverSweep &sweep,
+                         const AlgorithmTimer &time_lower,
+                         const AlgorithmTimer &time_higher);
+
+} // namespace code_generator
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_CODE_GENERATOR_FIND_CROSSOVER_THRESHOLD_HPP
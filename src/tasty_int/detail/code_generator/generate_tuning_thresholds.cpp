@@ -0,0 +1,361 @@
+/**
+ * @file generate_tuning_thresholds.cpp
+ * This program generates a header defining the operand sizes at which the
+ * arithmetic algorithms delegate to their lower-tier counterparts.  If
+ * MEASURE_TUNING_THRESHOLDS is nonzero, each threshold is found by timing the
+ * competing algorithms on the build machine; otherwise, the defaults are
+ * emitted as-is.
+ */
+#include <cstddef>
+#include <ctime>
+
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <ostream>
+#include <string_view>
+
+#include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
+#include "tasty_int/detail/tuning_thresholds.hpp"
+#include "tasty_int/detail/digits_multiplication.hpp"
+#include "tasty_int/detail/digits_division.hpp"
+#include "tasty_int/detail/code_generator/find_crossover_threshold.hpp"
+#include "tasty_int/detail/conversions/code_generator/parse_code_generator_arguments.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+namespace codegen {
+
+std::size_t LONG_MULTIPLY_THRESHOLD_MAGNITUDE       = 100;
+std::size_t LONG_SQUARE_THRESHOLD_MAGNITUDE         = 100;
+std::size_t KARATSUBA_MULTIPLY_THRESHOLD_MAGNITUDE  = 300;
+std::size_t KARATSUBA_SQUARE_THRESHOLD_MAGNITUDE    = 300;
+std::size_t TOOM_3_MULTIPLY_THRESHOLD_MAGNITUDE     = 8192;
+std::size_t TOOM_3_SQUARE_THRESHOLD_MAGNITUDE       = 8192;
+std::size_t LONG_DIVIDE_THRESHOLD_DIVISOR_MAGNITUDE = 32;
+std::size_t DIVIDE_AND_CONQUER_DIVIDE_THRESHOLD_DIVISOR_MAGNITUDE = 32768;
+
+} // namespace codegen
+} // namespace detail
+} // namespace tasty_int
+
+
+namespace {
+
+using tasty_int::detail::SmallVector;
+using tasty_int::detail::digit_type;
+using tasty_int::detail::digit_accumulator_type;
+using tasty_int::detail::DIGIT_TYPE_MAX;
+using tasty_int::detail::code_generator::CrossoverSweep;
+using tasty_int::detail::code_generator::AlgorithmTimer;
+using tasty_int::detail::code_generator::find_crossover_threshold;
+
+constexpr std::size_t UNLIMITED_THRESHOLD =
+    std::numeric_limits<std::size_t>::max();
+
+/**
+ * A prepared invocation of an algorithm on operands of a particular size.
+ */
+typedef std::function<void ()> Operation;
+
+/**
+ * A function that prepares an Operation for operands of the provided size.
+ */
+typedef std::function<Operation (std::size_t size)> OperationFactory;
+
+/**
+ * This struct describes a threshold and how to find its crossover point.
+ */
+struct TuningThreshold
+{
+    std::string_view name;              ///< the name of the constant
+    std::string_view description;       ///< a description of the constant
+    std::size_t     &value;             ///< the threshold variable
+    CrossoverSweep   sweep;             ///< the operand sizes to search
+    OperationFactory make_operation;    ///< prepares the higher-tier operation
+}; // struct TuningThreshold
+
+volatile std::size_t result_sink;
+
+SmallVector<digit_type>
+make_operand(std::size_t            size,
+             digit_accumulator_type seed)
+{
+    SmallVector<digit_type> digits(size);
+
+    digit_accumulator_type state = seed;
+    for (auto &digit : digits) {
+        state = (state * 6364136223846793005U) + 1442695040888963407U;
+        digit = static_cast<digit_type>((state >> 17) & DIGIT_TYPE_MAX);
+    }
+
+    digits.back() |= 1;
+
+    return digits;
+}
+
+template<typename Algorithm>
+OperationFactory
+make_multiply_operation_factory(Algorithm algorithm)
+{
+    return [algorithm](std::size_t size) -> Operation {
+        return [algorithm,
+                lhs = make_operand(size, 1),
+                rhs = make_operand(size, 2)]() {
+            result_sink = algorithm(lhs, rhs).size();
+        };
+    };
+}
+
+template<typename Algorithm>
+OperationFactory
+make_square_operation_factory(Algorithm algorithm)
+{
+    return [algorithm](std::size_t size) -> Operation {
+        return [algorithm, digits = make_operand(size, 3)]() {
+            result_sink = algorithm(digits).size();
+        };
+    };
+}
+
+template<typename Algorithm>
+OperationFactory
+make_divide_operation_factory(Algorithm algorithm)
+{
+    return [algorithm](std::size_t size) -> Operation {
+        return [algorithm,
+                dividend = make_operand(size * 2, 4),
+                divisor  = make_operand(size,     5)]() {
+            result_sink = algorithm(dividend, divisor).quotient.size();
+        };
+    };
+}
+
+double
+seconds_per_call(const Operation &operation)
+{
+    constexpr auto         MIN_DURATION = std::chrono::milliseconds(5);
+    constexpr unsigned int REPETITIONS  = 3;
+
+    auto best = std::numeric_limits<double>::infinity();
+
+    for (unsigned int repetition = 0; repetition < REPETITIONS; ++repetition) {
+        std::size_t calls = 0;
+        auto start        = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::duration elapsed;
+
+        do {
+            operation();
+            ++calls;
+            elapsed = std::chrono::steady_clock::now() - start;
+        } while (elapsed < MIN_DURATION);
+
+        auto seconds = std::chrono::duration<double>(elapsed).count();
+
+        best = std::min(best, seconds / static_cast<double>(calls));
+    }
+
+    return best;
+}
+
+void
+tune(TuningThreshold &threshold)
+{
+    auto time_with_threshold = [&](std::size_t value,
+                                   std::size_t size) {
+        auto operation = threshold.make_operation(size);
+
+        threshold.value = value;
+
+        return seconds_per_call(operation);
+    };
+
+    // With an unlimited threshold, the operation delegates to the lower tier
+    // outright.  With a threshold of one less than the operand size, the
+    // operation takes a single higher-tier step before delegating.
+    AlgorithmTimer time_lower = [&](std::size_t size) {
+        return time_with_threshold(UNLIMITED_THRESHOLD, size);
+    };
+    AlgorithmTimer time_higher = [&](std::size_t size) {
+        return time_with_threshold(size - 1, size);
+    };
+
+    threshold.value = find_crossover_threshold(threshold.sweep,
+                                               time_lower,
+                                               time_higher);
+}
+
+void
+put_timestamp(std::ostream &output)
+{
+    auto time_now  = std::chrono::system_clock::now();
+    auto timestamp = std::chrono::system_clock::to_time_t(time_now);
+
+    output << std::ctime(&timestamp); // terminated with \n
+}
+
+void
+put_generated_header(std::ostream &output)
+{
+    output <<
+        "// The operand sizes at or below which arithmetic algorithms "
+            "delegate to their lower-tier counterparts.\n"
+        "//\n"
+        "// generated on: ";
+
+    put_timestamp(output);
+
+    output <<
+        "// measured:     " << (MEASURE_TUNING_THRESHOLDS ? "yes" : "no") << "\n"
+        "// =============================================================================\n";
+}
+
+template<std::size_t COUNT_THRESHOLDS>
+void
+generate_header(const std::array<TuningThreshold, COUNT_THRESHOLDS> &thresholds,
+                std::ostream                                       &output)
+{
+    put_generated_header(output);
+
+    output <<
+        "#ifndef TASTY_INT_TASTY_INT_DETAIL_CODEGEN_TUNING_THRESHOLDS_HPP\n"
+        "#define TASTY_INT_TASTY_INT_DETAIL_CODEGEN_TUNING_THRESHOLDS_HPP\n"
+        "\n"
+        "#include <cstddef>\n"
+        "\n"
+        "\n"
+        "namespace tasty_int {\n"
+        "namespace detail {\n"
+        "namespace codegen {\n";
+
+    for (const auto &threshold : thresholds)
+        output <<
+            "\n"
+            "/// " << threshold.description << "\n"
+            "constexpr std::size_t " << threshold.name << " = "
+                << threshold.value << ";\n";
+
+    output <<
+        "\n"
+        "} // namespace codegen\n"
+        "} // namespace detail\n"
+        "} // namespace tasty_int\n"
+        "\n"
+        "#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_CODEGEN_TUNING_THRESHOLDS_HPP\n";
+}
+
+} // namespace
+
+
+int
+main(int   argc,
+     char *argv[])
+{
+    using tasty_int::detail::conversions::code_generator::parse_code_generator_arguments;
+    using tasty_int::detail::karatsuba_multiply;
+    using tasty_int::detail::karatsuba_square;
+    using tasty_int::detail::toom_3_multiply;
+    using tasty_int::detail::toom_3_square;
+    using tasty_int::detail::number_theoretic_transform_multiply;
+    using tasty_int::detail::number_theoretic_transform_square;
+    using tasty_int::detail::divide_and_conquer_divide;
+    using tasty_int::detail::newton_divide;
+    namespace codegen = tasty_int::detail::codegen;
+
+    auto args = parse_code_generator_arguments(argc, argv);
+
+    // ordered such that each threshold is tuned after those of the tiers
+    // beneath it
+    std::array<TuningThreshold, 8> thresholds = {{
+        {
+            .name           = "LONG_MULTIPLY_THRESHOLD_MAGNITUDE",
+            .description    = "long_multiply() -> karatsuba_multiply()",
+            .value          = codegen::LONG_MULTIPLY_THRESHOLD_MAGNITUDE,
+            .sweep          = { .first_size = 8, .last_size = 512 },
+            .make_operation = make_multiply_operation_factory(
+                karatsuba_multiply
+            )
+        },
+        {
+            .name           = "LONG_SQUARE_THRESHOLD_MAGNITUDE",
+            .description    = "long_square() -> karatsuba_square()",
+            .value          = codegen::LONG_SQUARE_THRESHOLD_MAGNITUDE,
+            .sweep          = { .first_size = 8, .last_size = 512 },
+            .make_operation = make_square_operation_factory(karatsuba_square)
+        },
+        {
+            .name           = "KARATSUBA_MULTIPLY_THRESHOLD_MAGNITUDE",
+            .description    = "karatsuba_multiply() -> toom_3_multiply()",
+            .value          = codegen::KARATSUBA_MULTIPLY_THRESHOLD_MAGNITUDE,
+            .sweep          = { .first_size = 32, .last_size = 4096 },
+            .make_operation = make_multiply_operation_factory(toom_3_multiply)
+        },
+        {
+            .name           = "KARATSUBA_SQUARE_THRESHOLD_MAGNITUDE",
+            .description    = "karatsuba_square() -> toom_3_square()",
+            .value          = codegen::KARATSUBA_SQUARE_THRESHOLD_MAGNITUDE,
+            .sweep          = { .first_size = 32, .last_size = 4096 },
+            .make_operation = make_square_operation_factory(toom_3_square)
+        },
+        {
+            .name           = "TOOM_3_MULTIPLY_THRESHOLD_MAGNITUDE",
+            .description    = "toom_3_multiply() -> "
+                              "number_theoretic_transform_multiply()",
+            .value          = codegen::TOOM_3_MULTIPLY_THRESHOLD_MAGNITUDE,
+            .sweep          = { .first_size = 256, .last_size = 32768 },
+            .make_operation = make_multiply_operation_factory(
+                number_theoretic_transform_multiply
+            )
+        },
+        {
+            .name           = "TOOM_3_SQUARE_THRESHOLD_MAGNITUDE",
+            .description    = "toom_3_square() -> "
+                              "number_theoretic_transform_square()",
+            .value          = codegen::TOOM_3_SQUARE_THRESHOLD_MAGNITUDE,
+            .sweep          = { .first_size = 256, .last_size = 32768 },
+            .make_operation = make_square_operation_factory(
+                number_theoretic_transform_square
+            )
+        },
+        {
+            .name           = "LONG_DIVIDE_THRESHOLD_DIVISOR_MAGNITUDE",
+            .description    = "long_divide() -> divide_and_conquer_divide()",
+            .value          = codegen::LONG_DIVIDE_THRESHOLD_DIVISOR_MAGNITUDE,
+            .sweep          = { .first_size = 32, .last_size = 2048 },
+            .make_operation = make_divide_operation_factory(
+                divide_and_conquer_divide
+            )
+        },
+        {
+            .name           = "DIVIDE_AND_CONQUER_DIVIDE_THRESHOLD_DIVISOR_MAGNITUDE",
+            .description    = "divide_and_conquer_divide() -> newton_divide()",
+            .value          =
+                codegen::DIVIDE_AND_CONQUER_DIVIDE_THRESHOLD_DIVISOR_MAGNITUDE,
+            .sweep          = { .first_size = 1024, .last_size = 32768 },
+            .make_operation = make_divide_operation_factory(newton_divide)
+        }
+    }};
+
+    if (MEASURE_TUNING_THRESHOLDS) {
+        // higher tiers must not interfere with the tuning of lower tiers
+        for (auto &threshold : thresholds)
+            threshold.value = UNLIMITED_THRESHOLD;
+
+        for (auto &threshold : thresholds)
+            tune(threshold);
+    }
+
+    std::filesystem::path path(args.output_directory);
+    path /= args.target_name;
+    path += ".hpp";
+
+    std::ofstream header(path);
+    generate_header(thresholds, header);
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include "tasty_int/detail/code_generator/find_crossover_threshold.hpp"
+
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using tasty_int::detail::code_generator::find_crossover_threshold;
+using tasty_int::detail::code_generator::CrossoverSweep;
+using tasty_int::detail::code_generator::AlgorithmTimer;
+
+
+constexpr CrossoverSweep SWEEP = { .first_size = 8, .last_size = 64 };
+
+const AlgorithmTimer TIME_LOWER = [](std::size_t size) noexcept {
+    return static_cast<double>(size);
+};
+
+AlgorithmTimer
+make_time_higher(std::size_t first_win_size,
+                 std::size_t noisy_win_size = 0)
+{
+    return [=](std::size_t size) noexcept {
+        bool higher_wins = (size >= first_win_size) || (size == noisy_win_size);
+
+        return static_cast<double>(size) + (higher_wins ? -1.0 : 1.0);
+    };
+}
+
+
+TEST(FindCrossoverThresholdTest,
+     ReturnsLastSizeAtWhichLowerTierWon)
+{
+    EXPECT_EQ(18U,
+              find_crossover_threshold(SWEEP, TIME_LOWER, make_time_higher(20)));
+}
+
+TEST(FindCrossoverThresholdTest,
+     IgnoresSingleHigherTierWin)
+{
+    EXPECT_EQ(18U,
+              find_crossover_threshold(SWEEP,
+                                       TIME_LOWER,
+                                       make_time_higher(20, 12)));
+}
+
+TEST(FindCrossoverThresholdTest,
+     ReturnsFirstSizeIfHigherTierAlwaysWins)
+{
+    EXPECT_EQ(SWEEP.first_size,
+              find_crossover_threshold(SWEEP, TIME_LOWER, make_time_higher(0)));
+}
+
+TEST(FindCrossoverThresholdTest,
+     ReturnsLastSizeIfHigherTierNeverWins)
+{
+    EXPECT_EQ(SWEEP.last_size,
+              find_crossover_threshold(SWEEP,
+                                       TIME_LOWER,
+                                       make_time_higher(SWEEP.last_size + 1)));
+}
+
+} // namespace
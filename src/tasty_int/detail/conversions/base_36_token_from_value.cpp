@@ -1,9 +1,12 @@
 #include "tasty_int/detail/conversions/base_36_token_from_value.hpp"
 
 #include <cassert>
+#include <cstddef>
 
 #include <array>
 
+#include "tasty_int/detail/conversions/token_word.hpp"
+
 
 namespace tasty_int {
 namespace detail {
@@ -26,6 +29,22 @@ base_36_token_from_value(unsigned int value)
     return BASE_36_TOKENS[value];
 }
 
+/**
+ * Converts TOKENS_PER_WORD values at a time, followed by any that remain.
+ */
+void
+base_36_tokens_from_values(char *first,
+                           char *last)
+{
+    for (; (last - first) >= static_cast<std::ptrdiff_t>(TOKENS_PER_WORD);
+         first += TOKENS_PER_WORD)
+        store_token_word(base_36_token_word_from_values(load_token_word(first)),
+                         first);
+
+    for (; first != last; ++first)
+        *first = base_36_token_from_value(static_cast<unsigned char>(*first));
+}
+
 } // namespace conversions
 } // namespace detail
 } // namespace tasty_int
@@ -16,6 +16,19 @@ namespace conversions {
 char
 base_36_token_from_value(unsigned int value);
 
+/**
+ * @brief Converts a range of Base36 values into their associated ASCII
+ *     characters in place.
+ *
+ * @param[in,out] first the first value of the range
+ * @param[in,out] last  one past the last value of the range
+ *
+ * @pre every value in [@p first, @p last) is in the range [0, 36)
+ */
+void
+base_36_tokens_from_values(char *first,
+                           char *last);
+
 } // namespace conversions
 } // namespace detail
 } // namespace tasty_int
@@ -29,6 +29,14 @@ base_64_token_from_value(unsigned int value)
     return BASE_64_TOKENS[value];
 }
 
+void
+base_64_tokens_from_values(char *first,
+                           char *last)
+{
+    for (; first != last; ++first)
+        *first = base_64_token_from_value(static_cast<unsigned char>(*first));
+}
+
 } // namespace conversions
 } // namespace detail
 } // namespace tasty_int
@@ -0,0 +1,31 @@
+#include "tasty_int/detail/conversions/binary_layout.hpp"
+
+#include <stdexcept>
+
+
+namespace tasty_int {
+namespace detail {
+namespace conversions {
+
+void
+ensure_binary_format_is_supported(const BinaryFormat &format)
+{
+    if (format.word_size == 0)
+        throw std::invalid_argument(
+            "tasty_int::detail::conversions::"
+            "ensure_binary_format_is_supported - invalid word_size (0): Words"
+            " must span at least one byte."
+        );
+
+    if ((format.byte_order != std::endian::little) &&
+        (format.byte_order != std::endian::big))
+        throw std::invalid_argument(
+            "tasty_int::detail::conversions::"
+            "ensure_binary_format_is_supported - invalid byte_order: Byte"
+            " order is neither little- nor big-endian."
+        );
+}
+
+} // namespace conversions
+} // namespace detail
+} // namespace tasty_int
@@ -0,0 +1,125 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_BINARY_LAYOUT_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_BINARY_LAYOUT_HPP
+
+#include <cstddef>
+
+#include <bit>
+
+#include "tasty_int/binary_format.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+namespace conversions {
+
+/// The sign byte of a nonnegative binary-encoded integer.
+constexpr std::byte NONNEGATIVE_SIGN_BYTE{0x00};
+
+/// The sign byte of a negative binary-encoded integer.
+constexpr std::byte NEGATIVE_SIGN_BYTE{0x01};
+
+/**
+ * @brief checks that @p format describes a supported binary layout
+ *
+ * @throw std::invalid_argument if @p format has a `word_size` of zero or a
+ *     `byte_order` other than `std::endian::little` or `std::endian::big`
+ */
+void
+ensure_binary_format_is_supported(const BinaryFormat &format);
+
+/**
+ * This class maps the bytes of a magnitude, least significant first, to their
+ * offsets within the words of a binary encoding.
+ */
+class BinaryLayout
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] format      a supported binary format
+     * @param[in] count_words the number of words in the encoding
+     */
+    BinaryLayout(const BinaryFormat &format,
+                 std::size_t         count_words)
+        : word_size(format.word_size)
+        , size_words(count_words)
+        , is_most_significant_word_first(
+              format.word_order == WordOrder::MOST_SIGNIFICANT_FIRST
+          )
+        , is_big_endian(format.byte_order == std::endian::big)
+    {}
+
+    /**
+     * @return the number of bytes spanned by the words of the encoding
+     */
+    std::size_t
+    size() const
+    {
+        return word_size * size_words;
+    }
+
+    /**
+     * @return true if the magnitude bytes are laid out least significant
+     *     first, as are those of digits on a little-endian machine
+     */
+    bool
+    is_little_endian_sequence() const
+    {
+        return !is_most_significant_word_first && !is_big_endian;
+    }
+
+    /**
+     * @return true if the magnitude bytes are laid out most significant first
+     */
+    bool
+    is_big_endian_sequence() const
+    {
+        return is_most_significant_word_first && is_big_endian;
+    }
+
+    /**
+     * @param[in] word_index the index of a word, least significant first
+     * @return the offset of the first byte of word @p word_index
+     */
+    std::size_t
+    word_offset(std::size_t word_index) const
+    {
+        return word_size * (is_most_significant_word_first
+                            ? (size_words - 1 - word_index)
+                            : word_index);
+    }
+
+    /**
+     * @param[in] byte_index the index of a byte within a word, least
+     *     significant first
+     * @return the offset of byte @p byte_index from the start of its word
+     */
+    std::size_t
+    byte_offset(std::size_t byte_index) const
+    {
+        return is_big_endian ? (word_size - 1 - byte_index)
+                             : byte_index;
+    }
+
+    /**
+     * @return the number of bytes per word
+     */
+    std::size_t
+    bytes_per_word() const
+    {
+        return word_size;
+    }
+
+private:
+    std::size_t word_size;
+    std::size_t size_words;
+    bool        is_most_significant_word_first;
+    bool        is_big_endian;
+}; // class BinaryLayout
+
+} // namespace conversions
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_BINARY_LAYOUT_HPP
@@ -0,0 +1,170 @@
+#include "tasty_int/detail/conversions/bytes_from_integer.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <string>
+
+#include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
+#include "tasty_int/detail/conversions/binary_layout.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+namespace conversions {
+namespace {
+
+constexpr std::size_t BYTES_PER_DIGIT = sizeof(digit_type);
+
+std::size_t
+count_magnitude_bytes(const SmallVector<digit_type> &digits)
+{
+    auto count_most_significant_bytes =
+        (std::bit_width(digits.back()) + 7) / 8;
+
+    return ((digits.size() - 1) * BYTES_PER_DIGIT)
+         + count_most_significant_bytes;
+}
+
+std::size_t
+count_words(std::size_t count_bytes,
+            std::size_t word_size)
+{
+    return (count_bytes + word_size - 1) / word_size;
+}
+
+std::byte
+magnitude_byte(const SmallVector<digit_type> &digits,
+               std::size_t                    count_bytes,
+               std::size_t                    byte_index)
+{
+    if (byte_index >= count_bytes)
+        return std::byte(0);
+
+    auto digit = digits[byte_index / BYTES_PER_DIGIT];
+    auto shift = (byte_index % BYTES_PER_DIGIT) * 8;
+
+    return static_cast<std::byte>((digit >> shift) & 0xFF);
+}
+
+/**
+ * Stores @p digit to @p bytes most significant byte first, a pattern which
+ * compilers reduce to a byte swap and a single store.
+ */
+void
+store_big_endian_digit(digit_type  digit,
+                       std::byte  *bytes)
+{
+    for (std::size_t byte_index = 0; byte_index < BYTES_PER_DIGIT;
+         ++byte_index)
+        bytes[byte_index] = static_cast<std::byte>(
+            (digit >> ((BYTES_PER_DIGIT - 1 - byte_index) * 8)) & 0xFF
+        );
+}
+
+void
+write_big_endian_sequence(const SmallVector<digit_type> &digits,
+                          std::size_t                    count_bytes,
+                          std::span<std::byte>           words)
+{
+    auto *magnitude_end = words.data() + words.size();
+    auto count_whole_digits = count_bytes / BYTES_PER_DIGIT;
+
+    for (std::size_t digit_index = 0; digit_index < count_whole_digits;
+         ++digit_index) {
+        magnitude_end -= BYTES_PER_DIGIT;
+        store_big_endian_digit(digits[digit_index], magnitude_end);
+    }
+
+    for (auto byte_index = count_whole_digits * BYTES_PER_DIGIT;
+         byte_index < count_bytes; ++byte_index)
+        *--magnitude_end = magnitude_byte(digits, count_bytes, byte_index);
+
+    std::fill(words.data(), magnitude_end, std::byte(0));
+}
+
+/**
+ * Layouts that store the magnitude as one contiguous run of bytes are copied
+ * a digit at a time (or straight from memory where the machine is
+ * little-endian); all others are scattered a byte at a time.
+ */
+void
+write_magnitude(const SmallVector<digit_type> &digits,
+                std::size_t                    count_bytes,
+                const BinaryLayout            &layout,
+                std::span<std::byte>           words)
+{
+    if (layout.is_big_endian_sequence()) {
+        write_big_endian_sequence(digits, count_bytes, words);
+        return;
+    }
+
+    if constexpr (std::endian::native == std::endian::little) {
+        if (layout.is_little_endian_sequence()) {
+            const auto *digit_bytes =
+                reinterpret_cast<const std::byte *>(digits.data());
+            auto padding = std::copy_n(digit_bytes, count_bytes,
+                                       words.begin());
+            std::fill(padding, words.end(), std::byte(0));
+            return;
+        }
+    }
+
+    auto word_size   = layout.bytes_per_word();
+    auto count_words = words.size() / word_size;
+
+    for (std::size_t word_index = 0; word_index < count_words; ++word_index) {
+        auto *word = words.data() + layout.word_offset(word_index);
+        auto first_byte_index = word_index * word_size;
+
+        for (std::size_t byte_index = 0; byte_index < word_size; ++byte_index)
+            word[layout.byte_offset(byte_index)] =
+                magnitude_byte(digits, count_bytes,
+                               first_byte_index + byte_index);
+    }
+}
+
+} // namespace
+
+
+std::size_t
+count_bytes_from_integer(const Integer      &integer,
+                         const BinaryFormat &format)
+{
+    ensure_binary_format_is_supported(format);
+
+    auto count_bytes = count_magnitude_bytes(integer.digits);
+
+    return 1 + (count_words(count_bytes, format.word_size) * format.word_size);
+}
+
+std::size_t
+bytes_from_integer(const Integer        &integer,
+                   const BinaryFormat   &format,
+                   std::span<std::byte>  bytes)
+{
+    auto count_bytes = count_bytes_from_integer(integer, format);
+
+    if (bytes.size() < count_bytes)
+        throw std::invalid_argument(
+            "tasty_int::detail::conversions::bytes_from_integer - buffer too"
+            " small (" + std::to_string(bytes.size()) + " bytes): Encoding"
+            " requires " + std::to_string(count_bytes) + " bytes."
+        );
+
+    bytes[0] = (integer.sign == Sign::NEGATIVE) ? NEGATIVE_SIGN_BYTE
+                                               : NONNEGATIVE_SIGN_BYTE;
+
+    auto words = bytes.subspan(1, count_bytes - 1);
+    BinaryLayout layout(format, words.size() / format.word_size);
+
+    write_magnitude(integer.digits, count_magnitude_bytes(integer.digits),
+                    layout, words);
+
+    return count_bytes;
+}
+
+} // namespace conversions
+} // namespace detail
+} // namespace tasty_int
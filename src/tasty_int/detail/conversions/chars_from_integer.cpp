@@ -0,0 +1,285 @@
+#include "tasty_int/detail/conversions/chars_from_integer.hpp"
+
+#include <cassert>
+#include <cmath>
+
+#include <algorithm>
+#include <bit>
+#include <string>
+
+#include "tasty_int/detail/conversions/base_36_token_from_value.hpp"
+#include "tasty_int/detail/conversions/base_64_token_from_value.hpp"
+#include "tasty_int/detail/conversions/codegen/digits_per_token_table.hpp"
+#include "tasty_int/detail/conversions/ensure_base_is_supported.hpp"
+#include "tasty_int/detail/conversions/token_values_from_digits.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+namespace conversions {
+namespace {
+
+/**
+ * The capacity beyond which the per-thread token value buffer is released
+ * once a conversion completes, so that converting one huge value does not pin
+ * its token values for the life of the thread.
+ */
+constexpr std::string::size_type RETAINED_TOKEN_VALUES_CAPACITY = 1 << 16;
+
+/**
+ * This class writes a tasty_int::detail::Integer to a range of characters
+ * presented according to the provided base.
+ */
+class CharsConverter
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] base the numeric base/radix in which the output to
+     *     convert_to_chars() is presented
+     *
+     * @pre @p base is a supported numeric base
+     */
+    CharsConverter(unsigned int base);
+
+    /**
+     * @brief Determines an upper bound on the number of characters required
+     *     to present @p integer.
+     *
+     * @param[in] integer an arbitrary-precision integer
+     * @return the maximum number of characters written by convert_to_chars()
+     */
+    std::size_t
+    max_count_chars(IntegerView integer) const;
+
+    /**
+     * @brief Writes @p integer to the character range [@p first, @p last).
+     *
+     * @param[in]  integer an arbitrary-precision integer
+     * @param[out] first   the beginning of the destination range
+     * @param[out] last    the end of the destination range
+     * @return the std::to_chars_result of the conversion
+     */
+    std::to_chars_result
+    convert_to_chars(IntegerView  integer,
+                     char        *first,
+                     char        *last) const;
+
+private:
+    static double
+    get_token_values_per_bit(unsigned int base,
+                             double       rounding_padding);
+
+    static double
+    count_bits(DigitsView digits);
+
+    std::string::size_type
+    min_count_token_values(DigitsView digits) const;
+
+    std::string::size_type
+    max_count_token_values(DigitsView digits) const;
+
+    std::to_chars_result
+    copy_token_values(const std::string &token_values,
+                      bool               integer_is_negative,
+                      char              *first,
+                      char              *last) const;
+
+    const double         min_token_values_per_bit;
+    const double         token_values_per_bit;
+    const unsigned int   token_base;
+    void         (*const tokens_from_values)(char *, char *);
+}; // class CharsConverter
+
+
+CharsConverter::CharsConverter(unsigned int base)
+    : min_token_values_per_bit(get_token_values_per_bit(base, 1.0 - 0x1p-20))
+    , token_values_per_bit(get_token_values_per_bit(base, 1.0 + 0x1p-20))
+    , token_base(base)
+    , tokens_from_values((base <= 36) ? base_36_tokens_from_values
+                                      : base_64_tokens_from_values)
+{}
+
+/**
+ * DIGITS_PER_TOKEN_TABLE holds single-precision logarithms, so the reciprocal
+ * is padded up to ensure max_count_token_values() never underestimates, and
+ * down to ensure min_count_token_values() never overestimates.  The padding is
+ * relative, so the upper estimate may exceed the exact count by up to one part
+ * in 2^19 in addition to the slack of rounding to whole tokens.
+ */
+double
+CharsConverter::get_token_values_per_bit(unsigned int base,
+                                         double       rounding_padding)
+{
+    assert(base >= 2);
+    assert(base <= 64);
+
+    return rounding_padding
+         / (codegen::DIGITS_PER_TOKEN_TABLE[base] * DIGIT_TYPE_BITS);
+}
+
+std::size_t
+CharsConverter::max_count_chars(IntegerView integer) const
+{
+    std::size_t length_prefix = (integer.sign == Sign::NEGATIVE);
+
+    return length_prefix + max_count_token_values(integer.digits);
+}
+
+double
+CharsConverter::count_bits(DigitsView digits)
+{
+    return static_cast<double>(
+        ((digits.size() - 1) * DIGIT_TYPE_BITS)
+      + static_cast<unsigned int>(std::bit_width(digits.back()))
+    );
+}
+
+/**
+ * A value of `n > 0` bits requires at least `floor((n - 1) / log2(base)) + 1`
+ * tokens.  Zero requires a single token.
+ */
+std::string::size_type
+CharsConverter::min_count_token_values(DigitsView digits) const
+{
+    double count_lower_bits = std::max(count_bits(digits) - 1.0, 0.0);
+
+    return static_cast<std::string::size_type>(
+        std::floor(min_token_values_per_bit * count_lower_bits)
+    ) + 1;
+}
+
+/**
+ * A value of `n` bits requires at most `floor(n / log2(base)) + 1` tokens.
+ */
+std::string::size_type
+CharsConverter::max_count_token_values(DigitsView digits) const
+{
+    return static_cast<std::string::size_type>(
+        std::floor(token_values_per_bit * count_bits(digits))
+    ) + 1;
+}
+
+/**
+ * Destinations too small for even the fewest tokens @p integer may require
+ * are rejected before converting.  Otherwise, token values are produced least
+ * significant first in a per-thread scratch buffer, then copied in reverse
+ * into the destination and converted to tokens in bulk.
+ */
+std::to_chars_result
+CharsConverter::convert_to_chars(IntegerView  integer,
+                                 char        *first,
+                                 char        *last) const
+{
+    thread_local std::string token_values;
+
+    bool integer_is_negative = (integer.sign == Sign::NEGATIVE);
+    auto min_count_chars     = integer_is_negative
+                             + min_count_token_values(integer.digits);
+
+    if (static_cast<std::size_t>(last - first) < min_count_chars)
+        return { last, std::errc::value_too_large };
+
+    token_values.clear();
+    token_values_from_digits(integer.digits, token_base, token_values);
+
+    // ensure the sizing estimates hold
+    assert(token_values.size() >= min_count_token_values(integer.digits));
+    assert(token_values.size() <= max_count_token_values(integer.digits));
+
+    auto result = copy_token_values(token_values, integer_is_negative, first,
+                                    last);
+
+    if (token_values.capacity() > RETAINED_TOKEN_VALUES_CAPACITY)
+        token_values = std::string();
+
+    return result;
+}
+
+std::to_chars_result
+CharsConverter::copy_token_values(const std::string &token_values,
+                                  bool               integer_is_negative,
+                                  char              *first,
+                                  char              *last) const
+{
+    auto count_chars = integer_is_negative + token_values.size();
+
+    if (static_cast<std::size_t>(last - first) < count_chars)
+        return { last, std::errc::value_too_large };
+
+    if (integer_is_negative)
+        *first++ = '-';
+
+    char *end = std::reverse_copy(token_values.begin(), token_values.end(),
+                                  first);
+
+    tokens_from_values(first, end);
+
+    return { end, std::errc() };
+}
+
+} // namespace
+
+
+std::size_t
+max_chars_from_integer(IntegerView  integer,
+                       unsigned int base)
+{
+    assert((integer.sign == Sign::NEGATIVE) ||
+           (integer.sign == Sign::ZERO)     ||
+           (integer.sign == Sign::POSITIVE));
+    assert(!integer.digits.empty());
+
+    ensure_base_is_supported(base);
+
+    CharsConverter chars_converter(base);
+
+    return chars_converter.max_count_chars(integer);
+}
+
+std::to_chars_result
+chars_from_integer(IntegerView   integer,
+                   unsigned int  base,
+                   char         *first,
+                   char         *last)
+{
+    assert((integer.sign == Sign::NEGATIVE) ||
+           (integer.sign == Sign::ZERO)     ||
+           (integer.sign == Sign::POSITIVE));
+    assert(!integer.digits.empty());
+    assert(first <= last);
+
+    ensure_base_is_supported(base);
+
+    CharsConverter chars_converter(base);
+
+    return chars_converter.convert_to_chars(integer, first, last);
+}
+
+void
+stream_chars_from_digits(
+    DigitsView                                    digits,
+    unsigned int                                  base,
+    const std::function<void (std::string_view)> &consume
+)
+{
+    assert(!digits.empty());
+
+    ensure_base_is_supported(base);
+
+    auto tokens_from_values = (base <= 36) ? base_36_tokens_from_values
+                                           : base_64_tokens_from_values;
+
+    stream_token_values_from_digits(
+        digits, base,
+        [&](char *first, char *last) {
+            tokens_from_values(first, last);
+            consume(std::string_view(first, last - first));
+        }
+    );
+}
+
+} // namespace conversions
+} // namespace detail
+} // namespace tasty_int
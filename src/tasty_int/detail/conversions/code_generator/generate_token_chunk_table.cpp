@@ -0,0 +1,79 @@
+/**
+ * @file generate_token_chunk_table.cpp
+ * This program generates the source code for a lookup table used for
+ * converting between strings of tokens and arrays of digits several tokens at
+ * a time.
+ */
+#include <ostream>
+
+#include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/conversions/token_chunk.hpp"
+#include "tasty_int/detail/conversions/code_generator/parse_code_generator_arguments.hpp"
+#include "tasty_int/detail/conversions/code_generator/generate_table_files.hpp"
+
+
+namespace {
+
+using tasty_int::detail::conversions::TokenChunk;
+
+TokenChunk
+calculate_token_chunk(std::size_t base)
+{
+    using tasty_int::detail::digit_type;
+    using tasty_int::detail::DIGIT_TYPE_MAX;
+
+    TokenChunk token_chunk = {
+        .count_tokens = 1,
+        .radix_power  = static_cast<digit_type>(base)
+    };
+
+    while (token_chunk.radix_power <= (DIGIT_TYPE_MAX / base)) {
+        token_chunk.radix_power *= static_cast<digit_type>(base);
+        ++token_chunk.count_tokens;
+    }
+
+    return token_chunk;
+}
+
+void
+print_entry(std::size_t   entry,
+            std::ostream &output)
+{
+    TokenChunk token_chunk = {}; // default for invalid entries
+
+    if (entry >= 2)
+        token_chunk = calculate_token_chunk(entry);
+
+    output << "TokenChunk { " << token_chunk.count_tokens << ", "
+           << token_chunk.radix_power << "U }";
+}
+
+} // namespace
+
+
+int
+main(int   argc,
+     char *argv[])
+{
+    using tasty_int::detail::conversions::code_generator::parse_code_generator_arguments;
+    using tasty_int::detail::conversions::code_generator::TableGenerator;
+    using tasty_int::detail::conversions::code_generator::generate_table_files;
+
+    auto args = parse_code_generator_arguments(argc, argv);
+
+    TableGenerator token_chunk_table_generator({
+        .name        = args.target_name,
+        .type        = "TokenChunkTable",
+        .type_header = "\"tasty_int/detail/conversions/token_chunk.hpp\"",
+        .description = "This table provides the number of tokens that fit "
+                       "within a single digit and their radix power, so that "
+                       "tokens may be converted to and from digits a chunk at "
+                       "a time.",
+        .num_entries = 65,
+        .mapper      = print_entry
+    });
+
+    generate_table_files(token_chunk_table_generator, args.output_directory);
+
+    return 0;
+}
@@ -3,45 +3,33 @@
 #include <cassert>
 #include <cmath>
 
-#include "tasty_int/detail/floating_point_digits_iterator.hpp"
-#include "tasty_int/detail/size_digits_from_nonnegative_floating_point.hpp"
-#include "tasty_int/detail/trailing_zero.hpp"
+#include "tasty_int/detail/floating_point_decomposition.hpp"
 
 
 namespace tasty_int {
 namespace detail {
 namespace conversions {
-namespace {
 
-void
-fill_digits(long double              value,
-            std::vector<digit_type> &result)
-{
-    FloatingPointDigitsIterator value_cursor(value);
-    auto result_cursor = result.begin();
-    auto result_end    = result.end();
-    do {
-        *result_cursor = *value_cursor;
-        ++value_cursor;
-    } while (++result_cursor != result_end);
-}
-
-} // namespace
-
-
-std::vector<digit_type>
+/**
+ * The mantissa bits of @p value are placed with a single shift into the top
+ * digits of the result.  Every digit below them is zero.
+ */
+SmallVector<digit_type>
 digits_from_floating_point(long double value)
 {
     assert(std::isfinite(value));
     assert(value >= 0.0L);
 
-    std::vector<digit_type> result(
-        size_digits_from_nonnegative_floating_point(value)
-    );
+    auto decomposition = decompose_nonnegative_floating_point(value);
 
-    fill_digits(value, result);
+    SmallVector<digit_type> result(
+        count_digits_from_decomposition(decomposition)
+    );
 
-    trim_trailing_zero(result);
+    for (auto digit_index = decomposition.exponent / DIGIT_TYPE_BITS;
+         digit_index < result.size(); ++digit_index)
+        result[digit_index] = digit_from_decomposition(decomposition,
+                                                       digit_index);
 
     return result;
 }
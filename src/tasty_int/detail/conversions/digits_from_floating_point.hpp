@@ -1,9 +1,8 @@
 #ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_DIGITS_FROM_FLOATING_POINT_HPP
 #define TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_DIGITS_FROM_FLOATING_POINT_HPP
 
-#include <vector>
-
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 
 
 namespace tasty_int {
@@ -18,7 +17,7 @@ namespace conversions {
  *
  * @pre `std::isfinite(value) && (value >= 0.0)`
  */
-std::vector<digit_type>
+SmallVector<digit_type>
 digits_from_floating_point(long double value);
 
 } // namespace conversions
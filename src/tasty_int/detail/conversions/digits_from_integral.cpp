@@ -7,15 +7,17 @@ namespace tasty_int {
 namespace detail {
 namespace conversions {
 
-std::vector<digit_type>
+SmallVector<digit_type>
 digits_from_integral(std::uintmax_t value)
 {
-    std::vector<digit_type> digits;
+    SmallVector<digit_type> digits;
     digits.reserve(DIGITS_PER_DIGIT_ACCUMULATOR);
     digits.emplace_back(digit_from_nonnegative_value(value));
     if (value > DIGIT_TYPE_MAX)
         digits.emplace_back(
-            digit_from_nonnegative_value(value >> DIGIT_TYPE_BITS)
+            digit_from_nonnegative_value(
+                digit_accumulator_type(value) >> DIGIT_TYPE_BITS
+            )
         );
 
     return digits;
@@ -3,9 +3,8 @@
 
 #include <cstdint>
 
-#include <vector>
-
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 
 
 namespace tasty_int {
@@ -18,7 +17,7 @@ namespace conversions {
  * @param[in] value an unsigned integer value
  * @return little-endian representation of @p value in `digit_type`s
  */
-std::vector<digit_type>
+SmallVector<digit_type>
 digits_from_integral(std::uintmax_t value);
 
 } // namespace conversions
@@ -4,15 +4,20 @@
 #include <cmath>
 
 #include <array>
+#include <bit>
 #include <stdexcept>
 #include <string>
-#include <utility>
 
 #include "tasty_int/detail/conversions/codegen/digits_per_token_table.hpp"
+#include "tasty_int/detail/conversions/codegen/token_chunk_table.hpp"
 #include "tasty_int/detail/conversions/ensure_base_is_supported.hpp"
+#include "tasty_int/detail/conversions/radix_powers.hpp"
+#include "tasty_int/detail/conversions/token_word.hpp"
 #include "tasty_int/detail/conversions/value_from_base_36_token.hpp"
 #include "tasty_int/detail/conversions/value_from_base_64_token.hpp"
 #include "tasty_int/detail/digit_from_nonnegative_value.hpp"
+#include "tasty_int/detail/digits_addition.hpp"
+#include "tasty_int/detail/digits_multiplication.hpp"
 
 
 namespace tasty_int {
@@ -20,6 +25,12 @@ namespace detail {
 namespace conversions {
 namespace {
 
+/**
+ * The token string length at or below which tokens are parsed by repeated
+ * multiplication rather than by divide-and-conquer.
+ */
+constexpr std::string_view::size_type DIVIDE_AND_CONQUER_THRESHOLD_LENGTH = 512;
+
 /**
  * This class parses a little-endian sequence of digits from an input string of
  * tokens and base.
@@ -48,43 +59,59 @@ public:
      *
      * @pre @p tokens is not empty
      */
-    std::vector<digit_type>
+    SmallVector<digit_type>
     parse_digits(std::string_view tokens) const;
 
 private:
     static float
     get_digits_per_token(unsigned int base);
 
-    std::pair<std::string_view::iterator, std::vector<digit_type>>
-    parse_most_significant_token(std::string_view tokens) const;
+    static TokenChunk
+    get_token_chunk(unsigned int base);
 
-    void
-    accumulate_token(std::vector<digit_type> &digits,
-                     char                     token) const;
+    static unsigned int
+    count_bits_per_token(unsigned int base);
 
-    void
-    accumulate_value(std::vector<digit_type> &digits,
-                     digit_accumulator_type   value) const;
+    SmallVector<digit_type>
+    bitwise_parse(std::string_view tokens) const;
 
-    std::pair<std::string_view::iterator, digit_accumulator_type>
-    find_most_significant_value(std::string_view tokens) const; 
+    SmallVector<digit_type>
+    divide_and_conquer_parse(std::string_view tokens) const;
 
-    std::vector<digit_type>
+    SmallVector<digit_type>
+    multiply_parse(std::string_view tokens) const;
+
+    std::string_view
+    skip_leading_zeros(std::string_view tokens) const;
+
+    SmallVector<digit_type>
     allocate_digits(std::string_view::size_type count_significant_tokens) const;
 
-    std::vector<digit_type>::size_type
+    SmallVector<digit_type>::size_type
     size_digits(std::string_view::size_type count_significant_tokens) const;
 
+    void
+    accumulate_chunk(SmallVector<digit_type> &digits,
+                     digit_type               value) const;
+
     digit_accumulator_type
-    multiply_base_accumulate(std::vector<digit_type> &digits,
-                             digit_accumulator_type   addend) const;
+    multiply_chunk_radix_accumulate(SmallVector<digit_type> &digits,
+                                    digit_accumulator_type   addend) const;
+
+    digit_type
+    get_value_from_chunk(std::string_view chunk) const;
 
     digit_accumulator_type
     get_value_from_token(char token) const; 
 
+    void
+    validate_tokens(std::string_view tokens) const;
+
     unsigned int          (*const value_from_token)(char);
     const digit_accumulator_type  token_base;
     const float                   digits_per_token;
+    const TokenChunk              token_chunk;
+    const unsigned int            bits_per_token;
 }; // class DigitsParser
 
 
@@ -93,6 +120,8 @@ DigitsParser::DigitsParser(unsigned int base)
                                     : value_from_base_64_token)
     , token_base(base)
     , digits_per_token(get_digits_per_token(base))
+    , token_chunk(get_token_chunk(base))
+    , bits_per_token(count_bits_per_token(base))
 {}
 
 float
@@ -104,88 +133,210 @@ DigitsParser::get_digits_per_token(unsigned int base)
     return codegen::DIGITS_PER_TOKEN_TABLE[base];
 }
 
-std::vector<digit_type>
+TokenChunk
+DigitsParser::get_token_chunk(unsigned int base)
+{
+    assert(base >= 2);
+    assert(base <= 64);
+
+    return codegen::TOKEN_CHUNK_TABLE[base];
+}
+
+/**
+ * Each token of a power-of-two base maps onto a fixed group of bits, which is
+ * counted here.  Other bases have no such mapping and are assigned zero bits.
+ */
+unsigned int
+DigitsParser::count_bits_per_token(unsigned int base)
+{
+    return std::has_single_bit(base) ? std::countr_zero(base) : 0;
+}
+
+SmallVector<digit_type>
 DigitsParser::parse_digits(std::string_view tokens) const
 {
     assert(!tokens.empty());
 
-    auto [cursor, digits] = parse_most_significant_token(tokens);
+    if (bits_per_token > 0)
+        return bitwise_parse(tokens);
+
+    if (tokens.size() <= DIVIDE_AND_CONQUER_THRESHOLD_LENGTH)
+        return multiply_parse(tokens);
+
+    return divide_and_conquer_parse(tokens);
+}
+
+/**
+ * Packs the bits of each significant token, from least to most significant,
+ * directly into the digits in linear time.  Since the tokens are scanned
+ * right to left, an invalid token prompts a rescan from the left, so that the
+ * leftmost invalid token is reported as by the other parsers.
+ */
+SmallVector<digit_type>
+DigitsParser::bitwise_parse(std::string_view tokens) const
+{
+    auto significant_tokens = skip_leading_zeros(tokens);
+    if (significant_tokens.empty())
+        return { 0 };
+
+    auto digits = allocate_digits(significant_tokens.size());
+
+    digit_accumulator_type accumulator = 0;
+    unsigned int           count_bits  = 0;
+
+    auto append_bits = [&](digit_accumulator_type value,
+                           unsigned int           count_value_bits) {
+        accumulator |= value << count_bits;
+        count_bits  += count_value_bits;
+
+        if (count_bits >= DIGIT_TYPE_BITS) {
+            digits.emplace_back(digit_from_nonnegative_value(accumulator));
+            accumulator >>= DIGIT_TYPE_BITS;
+            count_bits   -= DIGIT_TYPE_BITS;
+        }
+    };
+
+    auto count_remaining_tokens = significant_tokens.size();
+    while (count_remaining_tokens > 0) {
+        if ((token_base == 16) && (count_remaining_tokens >= TOKENS_PER_WORD)) {
+            auto word = load_token_word(
+                &significant_tokens[count_remaining_tokens - TOKENS_PER_WORD]
+            );
+
+            // otherwise, the scalar path below locates the invalid token
+            if (is_hexadecimal_token_word(word)) {
+                append_bits(value_from_hexadecimal_token_word(word),
+                            TOKENS_PER_WORD * 4);
+                count_remaining_tokens -= TOKENS_PER_WORD;
+                continue;
+            }
+        }
+
+        --count_remaining_tokens;
+        auto value =
+            value_from_token(significant_tokens[count_remaining_tokens]);
+        if (value >= token_base)
+            validate_tokens(significant_tokens);
+
+        append_bits(value, bits_per_token);
+    }
 
-    for (auto tokens_end = tokens.end(); cursor != tokens_end; ++cursor)
-        accumulate_token(digits, *cursor);
+    // the bits of the most significant token may straddle a digit boundary
+    // with none set beyond it
+    if (accumulator > 0)
+        digits.emplace_back(static_cast<digit_type>(accumulator));
 
     // ensure the initial sizing was correct
-    assert(
-        (size_digits(tokens.end() - find_most_significant_value(tokens).first)
-         + 1 - digits.size()) <= 1
-    );
+    assert(digits.size() <= size_digits(significant_tokens.size()));
 
     return digits;
 }
 
-std::pair<std::string_view::iterator, std::vector<digit_type>>
-DigitsParser::parse_most_significant_token(std::string_view tokens) const
+/**
+ * Splits @p tokens into a `high` prefix and a `low` suffix spanning the
+ * largest radix power, `base^(k * 2^level)`, that covers no more than half of
+ * @p tokens, then combines the independently parsed halves as
+ * `high * radix_power(base, level) + low`.
+ */
+SmallVector<digit_type>
+DigitsParser::divide_and_conquer_parse(std::string_view tokens) const
 {
-    auto [cursor, most_sig_value] = find_most_significant_value(tokens);
+    auto count_tokens_in_level = [&](std::size_t level) {
+        return static_cast<std::string_view::size_type>(
+            token_chunk.count_tokens
+        ) << level;
+    };
+
+    assert((count_tokens_in_level(0) * 2) <= tokens.size());
 
-    auto count_rem_sig_tokens = tokens.end() - cursor;
-    auto count_sig_tokens     = 1 + count_rem_sig_tokens;
+    std::size_t level = 0;
+    while ((count_tokens_in_level(level + 1) * 2) <= tokens.size())
+        ++level;
 
-    auto digits = allocate_digits(count_sig_tokens);
-    digits.emplace_back(static_cast<digit_type>(most_sig_value));
+    auto count_high_tokens = tokens.size() - count_tokens_in_level(level);
 
-    return { cursor, std::move(digits) };
+    auto digits = parse_digits(tokens.substr(0, count_high_tokens));
+    digits = digits * radix_power(static_cast<unsigned int>(token_base), level);
+    digits += parse_digits(tokens.substr(count_high_tokens));
+
+    return digits;
 }
 
-std::pair<std::string_view::iterator, digit_accumulator_type>
-DigitsParser::find_most_significant_value(std::string_view tokens) const
+/**
+ * Accumulates the significant tokens of @p tokens a TokenChunk at a time,
+ * such that each digit is multiplied once per chunk rather than once per
+ * token.  The most significant chunk is the remainder left over from dividing
+ * the significant tokens into whole chunks.
+ */
+SmallVector<digit_type>
+DigitsParser::multiply_parse(std::string_view tokens) const
 {
-    auto cursor     = tokens.begin();
-    auto tokens_end = tokens.end();
+    auto significant_tokens = skip_leading_zeros(tokens);
+    if (significant_tokens.empty())
+        return { 0 };
+
+    auto count_leading_tokens =
+        ((significant_tokens.size() - 1) % token_chunk.count_tokens) + 1;
+
+    auto digits = allocate_digits(significant_tokens.size());
+    digits.emplace_back(
+        get_value_from_chunk(significant_tokens.substr(0, count_leading_tokens))
+    );
 
-    digit_accumulator_type most_significant_value;
-    do {
-        most_significant_value = get_value_from_token(*cursor);
-    } while ((++cursor != tokens_end) && (most_significant_value == 0));
+    for (auto offset = count_leading_tokens;
+         offset < significant_tokens.size();
+         offset += token_chunk.count_tokens)
+        accumulate_chunk(
+            digits,
+            get_value_from_chunk(
+                significant_tokens.substr(offset, token_chunk.count_tokens)
+            )
+        );
 
-    return { cursor, most_significant_value };
+    // ensure the initial sizing was correct
+    assert(digits.size() <= size_digits(significant_tokens.size()));
+
+    return digits;
 }
 
-std::vector<digit_type>
+std::string_view
+DigitsParser::skip_leading_zeros(std::string_view tokens) const
+{
+    std::string_view::size_type offset = 0;
+    while ((offset < tokens.size()) &&
+           (get_value_from_token(tokens[offset]) == 0))
+        ++offset;
+
+    return tokens.substr(offset);
+}
+
+SmallVector<digit_type>
 DigitsParser::allocate_digits(
     std::string_view::size_type count_significant_tokens
 ) const
 {
-    std::vector<digit_type> digits;
+    SmallVector<digit_type> digits;
     digits.reserve(size_digits(count_significant_tokens));
 
     return digits;
 }
 
-std::vector<digit_type>::size_type
+SmallVector<digit_type>::size_type
 DigitsParser::size_digits(
     std::string_view::size_type count_significant_tokens
 ) const
 {
-    return static_cast<std::vector<digit_type>::size_type>(
+    return static_cast<SmallVector<digit_type>::size_type>(
         std::floor(digits_per_token * count_significant_tokens)
     ) + 1;
 }
 
 void
-DigitsParser::accumulate_token(std::vector<digit_type> &digits,
-                               char                     token) const
+DigitsParser::accumulate_chunk(SmallVector<digit_type> &digits,
+                               digit_type               value) const
 {
-    digit_accumulator_type value = get_value_from_token(token);
-
-    accumulate_value(digits, value);
-}
-
-void
-DigitsParser::accumulate_value(std::vector<digit_type> &digits,
-                               digit_accumulator_type   value) const
-{
-    digit_accumulator_type carry = multiply_base_accumulate(digits, value);
+    digit_accumulator_type carry = multiply_chunk_radix_accumulate(digits,
+                                                                   value);
 
     if (carry > 0) {
         // carry from the last multiplication => do not need to truncate
@@ -195,12 +346,14 @@ DigitsParser::accumulate_value(std::vector<digit_type> &digits,
 }
 
 digit_accumulator_type
-DigitsParser::multiply_base_accumulate(std::vector<digit_type> &digits,
-                                       digit_accumulator_type   addend) const
+DigitsParser::multiply_chunk_radix_accumulate(
+    SmallVector<digit_type> &digits,
+    digit_accumulator_type   addend
+) const
 {
     for (digit_type &digit : digits) {
         digit_accumulator_type accumulator = digit;
-        accumulator *= token_base;
+        accumulator *= token_chunk.radix_power;
         accumulator += addend;
         digit = digit_from_nonnegative_value(accumulator);
         addend = accumulator >> DIGIT_TYPE_BITS;
@@ -209,6 +362,41 @@ DigitsParser::multiply_base_accumulate(std::vector<digit_type> &digits,
     return addend;
 }
 
+/**
+ * Evaluates a run of at most TokenChunk::count_tokens tokens, which always
+ * fits within a single digit.  Decimal tokens are evaluated TOKENS_PER_WORD at
+ * a time where possible.
+ */
+digit_type
+DigitsParser::get_value_from_chunk(std::string_view chunk) const
+{
+    assert(chunk.size() <= token_chunk.count_tokens);
+
+    constexpr digit_accumulator_type DECIMAL_WORD_RADIX = 100000000;
+
+    digit_accumulator_type      value  = 0;
+    std::string_view::size_type offset = 0;
+
+    if (token_base == 10) {
+        for (; (chunk.size() - offset) >= TOKENS_PER_WORD;
+             offset += TOKENS_PER_WORD) {
+            auto word = load_token_word(&chunk[offset]);
+
+            // otherwise, the scalar path below locates the invalid token
+            if (!is_decimal_token_word(word))
+                break;
+
+            value = (value * DECIMAL_WORD_RADIX)
+                  + value_from_decimal_token_word(word);
+        }
+    }
+
+    for (; offset < chunk.size(); ++offset)
+        value = (value * token_base) + get_value_from_token(chunk[offset]);
+
+    return static_cast<digit_type>(value);
+}
+
 digit_accumulator_type
 DigitsParser::get_value_from_token(char token) const
 {
@@ -222,14 +410,25 @@ DigitsParser::get_value_from_token(char token) const
             " ('"
         )
       + token + "'): Token is not within the set of characters for specified "
-        "base (" + std::to_string(token_base) + ")."
+        "base ("
+      + std::to_string(static_cast<unsigned int>(token_base)) + ")."
     );
 }
 
+/**
+ * @throw std::invalid_argument for the leftmost invalid token of @p tokens
+ */
+void
+DigitsParser::validate_tokens(std::string_view tokens) const
+{
+    for (char token : tokens)
+        (void) get_value_from_token(token);
+}
+
 } // namespace
 
 
-std::vector<digit_type>
+SmallVector<digit_type>
 digits_from_string(std::string_view tokens,
                    unsigned int     base)
 {
@@ -237,7 +436,8 @@ digits_from_string(std::string_view tokens,
 
     ensure_base_is_supported(base);
 
-    DigitsParser digits_parser(base);
+    DigitsParser     digits_parser(base);
+    RadixPowersScope radix_powers_scope;
 
     return digits_parser.parse_digits(tokens);
 }
@@ -2,9 +2,9 @@
 #define TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_DIGITS_FROM_STRING_HPP
 
 #include <string_view>
-#include <vector>
 
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 
 
 namespace tasty_int {
@@ -26,7 +26,7 @@ namespace conversions {
  * @pre @p base is a supported numeric base/radix
  * @pre @p tokens is not empty
  */
-std::vector<digit_type>
+SmallVector<digit_type>
 digits_from_string(std::string_view tokens,
                    unsigned int     base);
 
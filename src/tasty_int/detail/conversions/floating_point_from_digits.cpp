@@ -1,36 +1,196 @@
 #include "tasty_int/detail/conversions/floating_point_from_digits.hpp"
 
 #include <cassert>
+#include <cmath>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+
+#include "tasty_int/detail/digit_from_nonnegative_value.hpp"
 
 
 namespace tasty_int {
 namespace detail {
 namespace conversions {
+namespace {
+
+/**
+ * @return the number of digits needed to hold the leading @p mantissa_bits
+ *     bits of a value and the round bit that follows them
+ */
+constexpr std::size_t
+count_window_digits(unsigned int mantissa_bits)
+{
+    return (mantissa_bits + DIGIT_TYPE_BITS) / DIGIT_TYPE_BITS;
+}
+
+/**
+ * The leading `WINDOW_DIGITS*DIGIT_TYPE_BITS` bits of a value, most
+ * significant digit first, and whether any bits of the following digit were
+ * cut off.
+ */
+template<std::size_t WINDOW_DIGITS>
+struct LeadingBits
+{
+    std::array<digit_type, WINDOW_DIGITS> window;
+    bool                                  truncated;
+}; // struct LeadingBits
+
+digit_type
+digit_or_zero(DigitsView     digits,
+              std::ptrdiff_t index)
+{
+    return (index >= 0) ? digits[static_cast<std::size_t>(index)] : 0;
+}
+
+/**
+ * Left-aligns the leading bits of the top `WINDOW_DIGITS + 1` digits of
+ * @p digits in a window, such that the most significant bit of the value is
+ * the most significant bit of the window.
+ */
+template<std::size_t WINDOW_DIGITS>
+LeadingBits<WINDOW_DIGITS>
+get_leading_bits(DigitsView   digits,
+                 unsigned int leading_zero_bits)
+{
+    auto top = static_cast<std::ptrdiff_t>(digits.size()) - 1;
+
+    LeadingBits<WINDOW_DIGITS> leading_bits;
+    for (std::size_t i = 0; i < WINDOW_DIGITS; ++i)
+        leading_bits.window[i] =
+            digit_or_zero(digits, top - static_cast<std::ptrdiff_t>(i));
+
+    digit_type next = digit_or_zero(
+        digits, top - static_cast<std::ptrdiff_t>(WINDOW_DIGITS)
+    );
+
+    if (leading_zero_bits == 0) {
+        leading_bits.truncated = (next != 0);
+        return leading_bits;
+    }
+
+    auto shift_in = [&](digit_type digit, digit_type lower) {
+        return digit_from_nonnegative_value(
+            digit_accumulator_type(digit) << leading_zero_bits
+        ) | (lower >> (DIGIT_TYPE_BITS - leading_zero_bits));
+    };
+
+    auto &window = leading_bits.window;
+    for (std::size_t i = 0; (i + 1) < WINDOW_DIGITS; ++i)
+        window[i] = shift_in(window[i], window[i + 1]);
+    window.back() = shift_in(window.back(), next);
 
-long double
-floating_point_from_digits(const std::vector<digit_type> &digits)
+    leading_bits.truncated = digit_from_nonnegative_value(
+        digit_accumulator_type(next) << leading_zero_bits
+    ) != 0;
+
+    return leading_bits;
+}
+
+/**
+ * Determines whether any of the digits below the top @p count_top_digits are
+ * nonzero.  This is only needed to break an exact tie.
+ */
+bool
+have_nonzero_low_digits(DigitsView  digits,
+                        std::size_t count_top_digits)
+{
+    if (digits.size() <= count_top_digits)
+        return false;
+
+    return std::any_of(digits.begin(), digits.end() - count_top_digits,
+                       [](digit_type digit) { return digit != 0; });
+}
+
+} // namespace
+
+
+/**
+ * The leading `MANTISSA_BITS` bits of @p digits form the mantissa, which is
+ * rounded up if the next bit is set and either any bits below it are set or
+ * the mantissa is odd.  The mantissa is assembled from its digits, each of
+ * which converts exactly to @p FloatingPointType, and is then scaled by
+ * std::ldexp().
+ */
+template<FloatingPoint FloatingPointType>
+FloatingPointType
+floating_point_from_digits(DigitsView digits)
 {
     assert(!digits.empty());
 
-    constexpr long double LONG_DOUBLE_DIGIT_BASE = DIGIT_BASE;
+    using Limits = std::numeric_limits<FloatingPointType>;
 
-    long double value = 0.0;
+    constexpr unsigned int MANTISSA_BITS   = Limits::digits;
+    constexpr std::size_t  WINDOW_DIGITS   = count_window_digits(MANTISSA_BITS);
+    constexpr std::size_t  ROUND_DIGIT     = MANTISSA_BITS / DIGIT_TYPE_BITS;
+    constexpr unsigned int ROUND_BIT_SHIFT =
+        DIGIT_TYPE_BITS - 1 - (MANTISSA_BITS % DIGIT_TYPE_BITS);
 
-    auto digit       = digits.rbegin();
-    auto digits_rend = digits.rend();
-    while (true)
-    {
-        value += *digit;
+    digit_type top_digit = digits.back();
+    if (top_digit == 0)
+        return 0;
 
-        if (++digit == digits_rend)
-            break;
+    auto leading_zero_bits =
+        static_cast<unsigned int>(std::countl_zero(top_digit))
+      - (std::numeric_limits<digit_type>::digits - DIGIT_TYPE_BITS);
+    auto count_bits = (digits.size() * DIGIT_TYPE_BITS) - leading_zero_bits;
 
-        value *= LONG_DOUBLE_DIGIT_BASE;
+    if (count_bits > static_cast<std::size_t>(Limits::max_exponent))
+        return Limits::infinity();
+
+    auto [window, truncated] =
+        get_leading_bits<WINDOW_DIGITS>(digits, leading_zero_bits);
+
+    // the mantissa as an integer, with no more than MANTISSA_BITS bits set
+    // in any partial sum
+    FloatingPointType mantissa = 0;
+    for (std::size_t i = 0; i < ROUND_DIGIT; ++i)
+        mantissa += std::ldexp(
+            static_cast<FloatingPointType>(window[i]),
+            static_cast<int>(MANTISSA_BITS - ((i + 1) * DIGIT_TYPE_BITS))
+        );
+
+    // the round digit also holds the trailing mantissa bits, if any
+    digit_type round_digit = window[ROUND_DIGIT];
+    digit_type mantissa_least;
+    if constexpr (ROUND_BIT_SHIFT < (DIGIT_TYPE_BITS - 1)) {
+        mantissa_least = round_digit >> (ROUND_BIT_SHIFT + 1);
+        mantissa      += static_cast<FloatingPointType>(mantissa_least);
+    } else {
+        mantissa_least = window[ROUND_DIGIT - 1];
     }
 
-    return value;
+    bool round_bit   = ((round_digit >> ROUND_BIT_SHIFT) & 1) != 0;
+    bool sticky_bits =
+        ((round_digit & ((digit_type(1) << ROUND_BIT_SHIFT) - 1)) != 0)
+     || std::any_of(window.begin() + ROUND_DIGIT + 1, window.end(),
+                    [](digit_type digit) { return digit != 0; })
+     || truncated;
+
+    if (round_bit &&
+        (sticky_bits || ((mantissa_least & 1) != 0) ||
+         have_nonzero_low_digits(digits, WINDOW_DIGITS + 1)))
+        mantissa += 1;
+
+    auto exponent = static_cast<int>(count_bits)
+                  - static_cast<int>(MANTISSA_BITS);
+
+    // a mantissa carried out to MANTISSA_BITS + 1 bits is a power of two,
+    // which still converts exactly
+    return std::ldexp(mantissa, exponent);
 }
 
+template float
+floating_point_from_digits<float>(DigitsView digits);
+
+template double
+floating_point_from_digits<double>(DigitsView digits);
+
+template long double
+floating_point_from_digits<long double>(DigitsView digits);
+
 } // namespace conversions
 } // namespace detail
 } // namespace tasty_int
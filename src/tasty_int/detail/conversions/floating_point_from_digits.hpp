@@ -3,9 +3,9 @@
 
 #include <cstdint>
 
-#include <vector>
-
+#include "tasty_int/concepts.hpp"
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/digits_view.hpp"
 
 
 namespace tasty_int {
@@ -15,16 +15,22 @@ namespace conversions {
 /**
  * @brief Retrieve the floating-point value of @p digits.
  *
- * @brief If the value of @p digits is larger than what can be represented by
- *    long double, the result is positive infinity.
+ * @details The result is correctly rounded to nearest, ties to even, for
+ *    @p FloatingPointType.  Only the leading digits, which hold the mantissa
+ *    and rounding bits, are read; lower digits are inspected only to break an
+ *    exact tie.  If the value of @p digits is larger than what can be
+ *    represented by @p FloatingPointType, the result is positive infinity.
  *
+ * @tparam FloatingPointType one of `float`, `double`, or `long double`
  * @param[in] digits a little-endian sequence of digits
  * @return the floating-point value of @p digits
  *
  * @pre @p digits is not empty
+ * @pre @p digits may have no leading zeros
  */
-long double
-floating_point_from_digits(const std::vector<digit_type> &digits);
+template<FloatingPoint FloatingPointType = long double>
+FloatingPointType
+floating_point_from_digits(DigitsView digits);
 
 } // namespace conversions
 } // namespace detail
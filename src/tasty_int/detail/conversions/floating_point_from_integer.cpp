@@ -9,7 +9,8 @@ namespace tasty_int {
 namespace detail {
 namespace conversions {
 
-long double
+template<FloatingPoint FloatingPointType>
+FloatingPointType
 floating_point_from_integer(const Integer &integer)
 {
     assert((integer.sign == Sign::NEGATIVE) ||
@@ -17,7 +18,8 @@ floating_point_from_integer(const Integer &integer)
            (integer.sign == Sign::POSITIVE));
     assert(!integer.digits.empty());
 
-    long double result = floating_point_from_digits(integer.digits);
+    auto result =
+        floating_point_from_digits<FloatingPointType>(integer.digits);
 
     if (integer.sign < Sign::ZERO)
         result = -result;
@@ -25,6 +27,15 @@ floating_point_from_integer(const Integer &integer)
     return result;
 }
 
+template float
+floating_point_from_integer<float>(const Integer &integer);
+
+template double
+floating_point_from_integer<double>(const Integer &integer);
+
+template long double
+floating_point_from_integer<long double>(const Integer &integer);
+
 } // namespace conversions
 } // namespace detail
 } // namespace tasty_int
@@ -0,0 +1,154 @@
+#include "tasty_int/detail/conversions/integer_from_bytes.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <string>
+
+#include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
+#include "tasty_int/detail/sign_from_digits.hpp"
+#include "tasty_int/detail/trailing_zero.hpp"
+#include "tasty_int/detail/conversions/binary_layout.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+namespace conversions {
+namespace {
+
+constexpr std::size_t BYTES_PER_DIGIT = sizeof(digit_type);
+
+void
+ensure_bytes_are_valid(std::span<const std::byte> bytes,
+                       std::size_t                word_size)
+{
+    if (bytes.empty() || (((bytes.size() - 1) % word_size) != 0))
+        throw std::invalid_argument(
+            "tasty_int::detail::conversions::integer_from_bytes - invalid size"
+            " (" + std::to_string(bytes.size()) + " bytes): Encoding is not a"
+            " sign byte followed by whole words of " +
+            std::to_string(word_size) + " bytes."
+        );
+
+    if ((bytes.front() != NONNEGATIVE_SIGN_BYTE) &&
+        (bytes.front() != NEGATIVE_SIGN_BYTE))
+        throw std::invalid_argument(
+            "tasty_int::detail::conversions::integer_from_bytes - invalid sign"
+            " byte (" + std::to_string(std::to_integer<int>(bytes.front())) +
+            "): Sign byte must be 0 (nonnegative) or 1 (negative)."
+        );
+}
+
+/**
+ * Loads a digit from @p bytes stored most significant byte first, a pattern
+ * which compilers reduce to a single load and a byte swap.
+ */
+digit_type
+load_big_endian_digit(const std::byte *bytes)
+{
+    digit_type digit = 0;
+    for (std::size_t byte_index = 0; byte_index < BYTES_PER_DIGIT;
+         ++byte_index)
+        digit = (digit << 8) | std::to_integer<digit_type>(bytes[byte_index]);
+
+    return digit;
+}
+
+void
+read_big_endian_sequence(std::span<const std::byte>  words,
+                         SmallVector<digit_type>    &digits)
+{
+    const auto *magnitude_end = words.data() + words.size();
+    auto count_whole_digits = words.size() / BYTES_PER_DIGIT;
+
+    for (std::size_t digit_index = 0; digit_index < count_whole_digits;
+         ++digit_index) {
+        magnitude_end -= BYTES_PER_DIGIT;
+        digits[digit_index] = load_big_endian_digit(magnitude_end);
+    }
+
+    digit_type partial_digit = 0;
+    for (const auto *byte = words.data(); byte != magnitude_end; ++byte)
+        partial_digit = (partial_digit << 8)
+                      | std::to_integer<digit_type>(*byte);
+
+    if (count_whole_digits < digits.size())
+        digits[count_whole_digits] = partial_digit;
+}
+
+/**
+ * The inverse of write_magnitude() in bytes_from_integer.cpp: contiguous
+ * layouts are copied a digit at a time (or straight into memory where the
+ * machine is little-endian), and all others are gathered a byte at a time.
+ */
+void
+read_magnitude(std::span<const std::byte>  words,
+               const BinaryLayout         &layout,
+               SmallVector<digit_type>    &digits)
+{
+    if (layout.is_big_endian_sequence()) {
+        read_big_endian_sequence(words, digits);
+        return;
+    }
+
+    if constexpr (std::endian::native == std::endian::little) {
+        if (layout.is_little_endian_sequence()) {
+            std::copy(words.begin(), words.end(),
+                      reinterpret_cast<std::byte *>(digits.data()));
+            return;
+        }
+    }
+
+    auto word_size   = layout.bytes_per_word();
+    auto count_words = words.size() / word_size;
+
+    for (std::size_t word_index = 0; word_index < count_words; ++word_index) {
+        const auto *word = words.data() + layout.word_offset(word_index);
+        auto first_byte_index = word_index * word_size;
+
+        for (std::size_t byte_index = 0; byte_index < word_size; ++byte_index) {
+            auto magnitude_index = first_byte_index + byte_index;
+            auto value = std::to_integer<digit_type>(
+                word[layout.byte_offset(byte_index)]
+            );
+
+            digits[magnitude_index / BYTES_PER_DIGIT] |=
+                value << ((magnitude_index % BYTES_PER_DIGIT) * 8);
+        }
+    }
+}
+
+} // namespace
+
+
+Integer
+integer_from_bytes(std::span<const std::byte>  bytes,
+                   const BinaryFormat         &format)
+{
+    ensure_binary_format_is_supported(format);
+    ensure_bytes_are_valid(bytes, format.word_size);
+
+    auto words = bytes.subspan(1);
+    auto size_digits = std::max<std::size_t>(
+        (words.size() + BYTES_PER_DIGIT - 1) / BYTES_PER_DIGIT, 1
+    );
+
+    Integer integer;
+    integer.digits = SmallVector<digit_type>(size_digits);
+
+    read_magnitude(words, BinaryLayout(format, words.size() / format.word_size),
+                   integer.digits);
+
+    trim_trailing_zeros(integer.digits);
+    integer.sign = sign_from_digits(integer.digits,
+                                    (bytes.front() == NEGATIVE_SIGN_BYTE)
+                                    ? Sign::NEGATIVE
+                                    : Sign::POSITIVE);
+
+    return integer;
+}
+
+} // namespace conversions
+} // namespace detail
+} // namespace tasty_int
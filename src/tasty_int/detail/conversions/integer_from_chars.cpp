@@ -0,0 +1,66 @@
+#include "tasty_int/detail/conversions/integer_from_chars.hpp"
+
+#include <string_view>
+
+#include "tasty_int/detail/conversions/digits_from_string.hpp"
+#include "tasty_int/detail/conversions/ensure_base_is_supported.hpp"
+#include "tasty_int/detail/conversions/value_from_base_36_token.hpp"
+#include "tasty_int/detail/conversions/value_from_base_64_token.hpp"
+#include "tasty_int/detail/sign_from_digits.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+namespace conversions {
+namespace {
+
+const char *
+find_end_of_tokens(const char   *first,
+                   const char   *last,
+                   unsigned int  base)
+{
+    auto value_from_token = (base <= 36) ? value_from_base_36_token
+                                         : value_from_base_64_token;
+
+    while ((first != last) && (value_from_token(*first) < base))
+        ++first;
+
+    return first;
+}
+
+} // namespace
+
+
+std::from_chars_result
+integer_from_chars(const char   *first,
+                   const char   *last,
+                   unsigned int  base,
+                   Integer      &integer)
+{
+    ensure_base_is_supported(base);
+
+    const char *tokens_begin = first;
+
+    // '-' is not a token in any base, so it is unambiguous here (unlike '+')
+    bool is_negative = (tokens_begin != last)
+                    && (*tokens_begin == '-');
+    tokens_begin += is_negative;
+
+    const char *tokens_end = find_end_of_tokens(tokens_begin, last, base);
+
+    if (tokens_begin == tokens_end)
+        return { first, std::errc::invalid_argument };
+
+    integer.digits = digits_from_string(
+        std::string_view(tokens_begin, tokens_end - tokens_begin), base
+    );
+    integer.sign = sign_from_digits(integer.digits,
+                                    is_negative ? Sign::NEGATIVE
+                                                : Sign::POSITIVE);
+
+    return { tokens_end, std::errc() };
+}
+
+} // namespace conversions
+} // namespace detail
+} // namespace tasty_int
@@ -8,15 +8,17 @@ namespace detail {
 namespace conversions {
 
 std::uintmax_t
-integral_from_digits(const std::vector<digit_type> &digits)
+integral_from_digits(const SmallVector<digit_type> &digits)
 {
     assert(!digits.empty());
 
     std::uintmax_t value = digits.front();
 
     if (digits.size() > 1) {
-        auto next_digit  = static_cast<std::uintmax_t>(digits[1]);
-        value           |= (next_digit << DIGIT_TYPE_BITS);
+        auto next_digit  = static_cast<digit_accumulator_type>(digits[1]);
+        value           |= static_cast<std::uintmax_t>(
+            next_digit << DIGIT_TYPE_BITS
+        );
     }
 
     return value;
@@ -3,9 +3,8 @@
 
 #include <cstdint>
 
-#include <vector>
-
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 
 
 namespace tasty_int {
@@ -25,7 +24,7 @@ namespace conversions {
  * @pre @p digits is not empty
  */
 std::uintmax_t
-integral_from_digits(const std::vector<digit_type> &digits);
+integral_from_digits(const SmallVector<digit_type> &digits);
 
 } // namespace conversions
 } // namespace detail
@@ -0,0 +1,111 @@
+#include "tasty_int/detail/conversions/radix_powers.hpp"
+
+#include <cassert>
+
+#include <deque>
+#include <unordered_map>
+
+#include "tasty_int/detail/conversions/codegen/token_chunk_table.hpp"
+#include "tasty_int/detail/digits_multiplication.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+namespace conversions {
+namespace {
+
+/**
+ * The memoized radix powers of a single base, indexed by level.  A deque is
+ * used so that references to existing powers survive the addition of larger
+ * ones.
+ */
+typedef std::deque<SmallVector<digit_type>> RadixPowers;
+
+std::unordered_map<unsigned int, RadixPowers> &
+get_cache()
+{
+    thread_local std::unordered_map<unsigned int, RadixPowers> cache;
+
+    return cache;
+}
+
+RadixPowers &
+get_radix_powers(unsigned int base)
+{
+    assert(base >= 2);
+    assert(base <= 64);
+
+    auto &radix_powers = get_cache()[base];
+    if (radix_powers.empty())
+        radix_powers.push_back({ codegen::TOKEN_CHUNK_TABLE[base].radix_power });
+
+    return radix_powers;
+}
+
+unsigned int &
+get_scope_depth()
+{
+    thread_local unsigned int depth = 0;
+
+    return depth;
+}
+
+} // namespace
+
+
+const SmallVector<digit_type> &
+radix_power(unsigned int base,
+            std::size_t  level)
+{
+    auto &radix_powers = get_radix_powers(base);
+
+    while (radix_powers.size() <= level) {
+        const auto &largest_power = radix_powers.back();
+        radix_powers.push_back(largest_power * largest_power);
+    }
+
+    return radix_powers[level];
+}
+
+/**
+ * The level zero power is a single digit, so it is always retained.  Larger
+ * powers are only needed by conversions of larger values, which spend far
+ * more time dividing or multiplying by them than squaring them again.
+ */
+void
+trim_radix_powers()
+{
+    for (auto &[base, radix_powers] : get_cache())
+        while ((radix_powers.size() > 1) &&
+               (radix_powers.back().size() > RETAINED_RADIX_POWER_MAGNITUDE))
+            radix_powers.pop_back();
+}
+
+SmallVector<digit_type>::size_type
+largest_memoized_radix_power_magnitude(unsigned int base)
+{
+    assert(base >= 2);
+    assert(base <= 64);
+
+    const auto &cache  = get_cache();
+    auto        cursor = cache.find(base);
+
+    return ((cursor == cache.end()) || cursor->second.empty())
+         ? 0
+         : cursor->second.back().size();
+}
+
+RadixPowersScope::RadixPowersScope() noexcept
+{
+    ++get_scope_depth();
+}
+
+RadixPowersScope::~RadixPowersScope()
+{
+    if (--get_scope_depth() == 0)
+        trim_radix_powers();
+}
+
+} // namespace conversions
+} // namespace detail
+} // namespace tasty_int
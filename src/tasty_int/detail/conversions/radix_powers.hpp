@@ -0,0 +1,96 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_RADIX_POWERS_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_RADIX_POWERS_HPP
+
+#include <cstddef>
+
+#include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+namespace conversions {
+
+/**
+ * The largest magnitude of radix power retained by trim_radix_powers().
+ */
+constexpr SmallVector<digit_type>::size_type
+RETAINED_RADIX_POWER_MAGNITUDE = 1024;
+
+/**
+ * @brief Retrieves the radix power spanning `k * 2^level` tokens, where `k` is
+ *     the TokenChunk::count_tokens of @p base.
+ *
+ * Radix powers are computed by repeated squaring and memoized per thread, so
+ * that successive conversions in the same base share them.  Every level
+ * requested is retained until the next call to trim_radix_powers(), after
+ * which only powers spanning at most RETAINED_RADIX_POWER_MAGNITUDE digits
+ * are kept.
+ *
+ * @param[in] base  the numeric base/radix of the tokens
+ * @param[in] level the number of times the single-digit radix power is squared
+ * @return `base^(k * 2^level)`, which remains valid until it is dropped by
+ *     trim_radix_powers() or the calling thread exits
+ *
+ * @pre `(base >= 2) && (base <= 64)`
+ */
+const SmallVector<digit_type> &
+radix_power(unsigned int base,
+            std::size_t  level);
+
+/**
+ * @brief Releases the radix powers memoized by the calling thread that span
+ *     more than RETAINED_RADIX_POWER_MAGNITUDE digits, bounding the memory
+ *     retained after converting a large value.
+ *
+ * @post references returned by radix_power() to the released powers are
+ *     invalidated
+ */
+void
+trim_radix_powers();
+
+/**
+ * @brief Determines the magnitude of the largest radix power of @p base
+ *     memoized by the calling thread.
+ *
+ * @param[in] base the numeric base/radix of the tokens
+ * @return the number of digits in the largest memoized power, or zero if
+ *     none is memoized
+ *
+ * @pre `(base >= 2) && (base <= 64)`
+ */
+SmallVector<digit_type>::size_type
+largest_memoized_radix_power_magnitude(unsigned int base);
+
+/**
+ * This class trims the memoized radix powers once the outermost scope on the
+ * calling thread closes, whether or not it is left by an exception.  Each
+ * conversion entry point that calls radix_power() opens one.  Nested scopes,
+ * e.g. opened by a conversion made from a callback of another, leave the
+ * radix powers referenced by the enclosing conversion intact.
+ */
+class RadixPowersScope
+{
+public:
+    /**
+     * @brief Opens a scope.
+     */
+    RadixPowersScope() noexcept;
+
+    /**
+     * @brief Closes the scope, calling trim_radix_powers() if it is the
+     *     outermost on the calling thread.
+     */
+    ~RadixPowersScope();
+
+    RadixPowersScope(const RadixPowersScope &) = delete;
+
+    RadixPowersScope &
+    operator=(const RadixPowersScope &) = delete;
+}; // class RadixPowersScope
+
+} // namespace conversions
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_RADIX_POWERS_HPP
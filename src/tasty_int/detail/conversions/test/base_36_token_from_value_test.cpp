@@ -1,11 +1,14 @@
 #include "tasty_int/detail/conversions/base_36_token_from_value.hpp"
 
+#include <string>
+
 #include "gtest/gtest.h"
 
 
 namespace {
 
 using tasty_int::detail::conversions::base_36_token_from_value;
+using tasty_int::detail::conversions::base_36_tokens_from_values;
 
 
 TEST(Base36TokenFromValueTest, Value0MapsToToken0)
@@ -188,4 +191,14 @@ TEST(Base36TokenFromValueTest, Value35MapsToTokenZ)
     EXPECT_EQ('z', base_36_token_from_value(35));
 }
 
+
+TEST(Base36TokensFromValuesTest, ValuesMapToTokensInPlace)
+{
+    std::string tokens = { 0, 9, 10, 35, 1, 2, 3, 4, 5, 6, 7, 8, 11 };
+
+    base_36_tokens_from_values(tokens.data(), tokens.data() + tokens.size());
+
+    EXPECT_EQ("09az12345678b", tokens);
+}
+
 } // namespace
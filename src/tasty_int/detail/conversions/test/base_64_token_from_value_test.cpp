@@ -1,11 +1,14 @@
 #include "tasty_int/detail/conversions/base_64_token_from_value.hpp"
 
+#include <string>
+
 #include "gtest/gtest.h"
 
 
 namespace {
 
 using tasty_int::detail::conversions::base_64_token_from_value;
+using tasty_int::detail::conversions::base_64_tokens_from_values;
 
 
 
@@ -329,4 +332,14 @@ TEST(Base64TokenFromValueTest, Value63MapsToTokenForwardSlash)
     EXPECT_EQ('/', base_64_token_from_value(63));
 }
 
+
+TEST(Base64TokensFromValuesTest, ValuesMapToTokensInPlace)
+{
+    std::string tokens = { 0, 25, 26, 51, 52, 61, 62, 63 };
+
+    base_64_tokens_from_values(tokens.data(), tokens.data() + tokens.size());
+
+    EXPECT_EQ("AZaz09+/", tokens);
+}
+
 } // namespace
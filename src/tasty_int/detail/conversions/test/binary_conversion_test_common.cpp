@@ -0,0 +1,154 @@
+#include "tasty_int/detail/conversions/test/binary_conversion_test_common.hpp"
+
+#include <ostream>
+
+
+namespace binary_conversion_test_common {
+namespace {
+
+using tasty_int::BinaryFormat;
+using tasty_int::WordOrder;
+using tasty_int::detail::Integer;
+using tasty_int::detail::Sign;
+using tasty_int::detail::SmallVector;
+using tasty_int::detail::digit_type;
+
+// magnitude bytes 0x01...0x0a, least significant first
+const Integer LAYOUT_TEST_INTEGER = {
+    .sign   = Sign::NEGATIVE,
+#if TASTY_INT_HAVE_INT128_ACCUMULATOR
+    .digits = SmallVector<digit_type>{ 0x0807060504030201, 0x0a09 }
+#else
+    .digits = SmallVector<digit_type>{ 0x04030201, 0x08070605, 0x0a09 }
+#endif // if TASTY_INT_HAVE_INT128_ACCUMULATOR
+};
+
+} // namespace
+
+
+const std::vector<BinaryConversionTestParam> LAYOUT_TEST_PARAMS = {
+    {
+        .integer = LAYOUT_TEST_INTEGER,
+        .format  = BinaryFormat(),
+        .bytes   = make_bytes({
+            0x01,
+            0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+            0x09, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        })
+    },
+    {
+        .integer = LAYOUT_TEST_INTEGER,
+        .format  = {
+            .word_size  = 4,
+            .word_order = WordOrder::LEAST_SIGNIFICANT_FIRST,
+            .byte_order = std::endian::little
+        },
+        .bytes   = make_bytes({
+            0x01,
+            0x01, 0x02, 0x03, 0x04,
+            0x05, 0x06, 0x07, 0x08,
+            0x09, 0x0a, 0x00, 0x00
+        })
+    },
+    {
+        .integer = LAYOUT_TEST_INTEGER,
+        .format  = {
+            .word_size  = 4,
+            .word_order = WordOrder::LEAST_SIGNIFICANT_FIRST,
+            .byte_order = std::endian::big
+        },
+        .bytes   = make_bytes({
+            0x01,
+            0x04, 0x03, 0x02, 0x01,
+            0x08, 0x07, 0x06, 0x05,
+            0x00, 0x00, 0x0a, 0x09
+        })
+    },
+    {
+        .integer = LAYOUT_TEST_INTEGER,
+        .format  = {
+            .word_size  = 4,
+            .word_order = WordOrder::MOST_SIGNIFICANT_FIRST,
+            .byte_order = std::endian::little
+        },
+        .bytes   = make_bytes({
+            0x01,
+            0x09, 0x0a, 0x00, 0x00,
+            0x05, 0x06, 0x07, 0x08,
+            0x01, 0x02, 0x03, 0x04
+        })
+    },
+    {
+        .integer = LAYOUT_TEST_INTEGER,
+        .format  = {
+            .word_size  = 4,
+            .word_order = WordOrder::MOST_SIGNIFICANT_FIRST,
+            .byte_order = std::endian::big
+        },
+        .bytes   = make_bytes({
+            0x01,
+            0x00, 0x00, 0x0a, 0x09,
+            0x08, 0x07, 0x06, 0x05,
+            0x04, 0x03, 0x02, 0x01
+        })
+    },
+    {
+        .integer = LAYOUT_TEST_INTEGER,
+        .format  = {
+            .word_size  = 3,
+            .word_order = WordOrder::MOST_SIGNIFICANT_FIRST,
+            .byte_order = std::endian::little
+        },
+        .bytes   = make_bytes({
+            0x01,
+            0x0a, 0x00, 0x00,
+            0x07, 0x08, 0x09,
+            0x04, 0x05, 0x06,
+            0x01, 0x02, 0x03
+        })
+    },
+    {
+        .integer = LAYOUT_TEST_INTEGER,
+        .format  = {
+            .word_size  = 16,
+            .word_order = WordOrder::LEAST_SIGNIFICANT_FIRST,
+            .byte_order = std::endian::big
+        },
+        .bytes   = make_bytes({
+            0x01,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x09,
+            0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01
+        })
+    }
+};
+
+std::vector<std::byte>
+make_bytes(std::initializer_list<unsigned char> values)
+{
+    std::vector<std::byte> bytes;
+    bytes.reserve(values.size());
+
+    for (auto value : values)
+        bytes.push_back(static_cast<std::byte>(value));
+
+    return bytes;
+}
+
+std::ostream &
+operator<<(std::ostream                    &output,
+           const BinaryConversionTestParam &test_param)
+{
+    const auto &format = test_param.format;
+
+    output << "{ word_size=" << format.word_size
+           << ", word_order="
+           << ((format.word_order == WordOrder::LEAST_SIGNIFICANT_FIRST)
+               ? "LEAST_SIGNIFICANT_FIRST" : "MOST_SIGNIFICANT_FIRST")
+           << ", byte_order="
+           << ((format.byte_order == std::endian::little) ? "little" : "big")
+           << ", size_bytes=" << test_param.bytes.size() << " }";
+
+    return output;
+}
+
+} // namespace binary_conversion_test_common
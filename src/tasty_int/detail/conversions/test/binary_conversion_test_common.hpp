@@ -0,0 +1,55 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_TEST_BINARY_CONVERSION_TEST_COMMON_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_TEST_BINARY_CONVERSION_TEST_COMMON_HPP
+
+#include <cstddef>
+
+#include <initializer_list>
+#include <iosfwd>
+#include <vector>
+
+#include "tasty_int/binary_format.hpp"
+#include "tasty_int/detail/integer.hpp"
+
+
+namespace binary_conversion_test_common {
+
+/**
+ * This struct bundles an integer with its expected encoding in a particular
+ * binary format.
+ */
+struct BinaryConversionTestParam
+{
+    tasty_int::detail::Integer integer; ///< the test case integer
+    tasty_int::BinaryFormat    format;  ///< the test case layout
+    std::vector<std::byte>     bytes;   ///< the expected encoding
+}; // struct BinaryConversionTestParam
+
+/**
+ * Encodings of the same multi-digit integer in every combination of word
+ * order and byte order, with words that do not evenly divide a digit.
+ */
+extern const std::vector<BinaryConversionTestParam> LAYOUT_TEST_PARAMS;
+
+/**
+ * @brief Builds a sequence of bytes from their values.
+ *
+ * @param[in] values the byte values
+ * @return the bytes
+ */
+std::vector<std::byte>
+make_bytes(std::initializer_list<unsigned char> values);
+
+/**
+ * @brief Outputs BinaryConversionTestParam for diagnostic purposes.
+ *
+ * @param[in,out] output     the output stream
+ * @param[in]     test_param the BinaryConversionTestParam
+ * @return a reference to @p output
+ */
+std::ostream &
+operator<<(std::ostream                    &output,
+           const BinaryConversionTestParam &test_param);
+
+} // namespace binary_conversion_test_common
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_TEST_BINARY_CONVERSION_TEST_COMMON_HPP
@@ -0,0 +1,100 @@
+#include "tasty_int/detail/conversions/bytes_from_integer.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tasty_int/detail/conversions/test/binary_conversion_test_common.hpp"
+
+
+namespace {
+
+using tasty_int::BinaryFormat;
+using tasty_int::detail::Integer;
+using tasty_int::detail::Sign;
+using tasty_int::detail::SmallVector;
+using tasty_int::detail::digit_type;
+using tasty_int::detail::conversions::bytes_from_integer;
+using tasty_int::detail::conversions::count_bytes_from_integer;
+using binary_conversion_test_common::BinaryConversionTestParam;
+using binary_conversion_test_common::make_bytes;
+
+
+TEST(BytesFromIntegerTest, InvalidWordSizeThrowsInvalidArgument)
+{
+    Integer one = {
+        .sign   = Sign::POSITIVE,
+        .digits = SmallVector<digit_type>{ 1 }
+    };
+    BinaryFormat format = { .word_size = 0 };
+    std::vector<std::byte> bytes(16);
+
+    EXPECT_THROW(count_bytes_from_integer(one, format), std::invalid_argument);
+    EXPECT_THROW(bytes_from_integer(one, format, bytes),
+                 std::invalid_argument);
+}
+
+TEST(BytesFromIntegerTest, TooSmallBufferThrowsInvalidArgument)
+{
+    Integer one = {
+        .sign   = Sign::POSITIVE,
+        .digits = SmallVector<digit_type>{ 1 }
+    };
+    std::vector<std::byte> bytes(8);
+
+    EXPECT_THROW(bytes_from_integer(one, BinaryFormat(), bytes),
+                 std::invalid_argument);
+}
+
+TEST(BytesFromIntegerTest, ZeroHasNoWords)
+{
+    Integer zero = {
+        .sign   = Sign::ZERO,
+        .digits = SmallVector<digit_type>{ 0 }
+    };
+    std::vector<std::byte> bytes(4, std::byte(0xFF));
+
+    EXPECT_EQ(1, count_bytes_from_integer(zero, BinaryFormat()));
+    EXPECT_EQ(1, bytes_from_integer(zero, BinaryFormat(), bytes));
+    EXPECT_EQ(make_bytes({ 0x00, 0xFF, 0xFF, 0xFF }), bytes);
+}
+
+TEST(BytesFromIntegerTest, NegativeSignByteIsOne)
+{
+    Integer negative_one = {
+        .sign   = Sign::NEGATIVE,
+        .digits = SmallVector<digit_type>{ 1 }
+    };
+    BinaryFormat format = { .word_size = 1 };
+    std::vector<std::byte> bytes(2);
+
+    EXPECT_EQ(2, bytes_from_integer(negative_one, format, bytes));
+    EXPECT_EQ(make_bytes({ 0x01, 0x01 }), bytes);
+}
+
+
+class BytesFromIntegerLayoutTest
+    : public ::testing::TestWithParam<BinaryConversionTestParam>
+{}; // class BytesFromIntegerLayoutTest
+
+TEST_P(BytesFromIntegerLayoutTest, WritesExpectedBytes)
+{
+    const auto &[integer, format, expected] = GetParam();
+
+    std::vector<std::byte> bytes(expected.size() + 1, std::byte(0xFF));
+
+    EXPECT_EQ(expected.size(), count_bytes_from_integer(integer, format));
+    EXPECT_EQ(expected.size(), bytes_from_integer(integer, format, bytes));
+
+    bytes.pop_back();
+    EXPECT_EQ(expected, bytes);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    BytesFromIntegerTest,
+    BytesFromIntegerLayoutTest,
+    ::testing::ValuesIn(binary_conversion_test_common::LAYOUT_TEST_PARAMS)
+);
+
+} // namespace
@@ -0,0 +1,139 @@
+#include "tasty_int/detail/conversions/chars_from_integer.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "gtest/gtest.h"
+
+#include "tasty_int/detail/conversions/integer_from_string.hpp"
+#include "tasty_int/detail/conversions/string_from_integer.hpp"
+
+
+namespace {
+
+using tasty_int::detail::Integer;
+using tasty_int::detail::Sign;
+using tasty_int::detail::SmallVector;
+using tasty_int::detail::digit_type;
+using tasty_int::detail::conversions::chars_from_integer;
+using tasty_int::detail::conversions::integer_from_string;
+using tasty_int::detail::conversions::max_chars_from_integer;
+using tasty_int::detail::conversions::string_from_integer;
+
+
+TEST(CharsFromIntegerTest, UnsupportedBaseThrowsInvalidArgument)
+{
+    Integer one = {
+        .sign   = Sign::POSITIVE,
+        .digits = SmallVector<digit_type>{ 1 }
+    };
+    char buffer[8];
+
+    EXPECT_THROW(max_chars_from_integer(one, 1), std::invalid_argument);
+    EXPECT_THROW(chars_from_integer(one, 65, buffer, buffer + sizeof(buffer)),
+                 std::invalid_argument);
+}
+
+TEST(CharsFromIntegerTest, WritesExactlyTheTokensWithoutTerminator)
+{
+    Integer negative_twelve = {
+        .sign   = Sign::NEGATIVE,
+        .digits = SmallVector<digit_type>{ 12 }
+    };
+    char buffer[] = "xxxxxxxx";
+
+    auto [end, error] = chars_from_integer(negative_twelve, 10,
+                                           buffer, buffer + sizeof(buffer));
+
+    EXPECT_EQ(std::errc(), error);
+    EXPECT_EQ(buffer + 3, end);
+    EXPECT_EQ("-12xxxxx", std::string_view(buffer));
+}
+
+TEST(CharsFromIntegerTest, TooSmallBufferReportsValueTooLarge)
+{
+    Integer negative_twelve = {
+        .sign   = Sign::NEGATIVE,
+        .digits = SmallVector<digit_type>{ 12 }
+    };
+    char buffer[2];
+
+    auto [end, error] = chars_from_integer(negative_twelve, 10,
+                                           buffer, buffer + sizeof(buffer));
+
+    EXPECT_EQ(std::errc::value_too_large, error);
+    EXPECT_EQ(buffer + sizeof(buffer), end);
+}
+
+TEST(CharsFromIntegerTest, EmptyBufferReportsValueTooLarge)
+{
+    Integer zero = {
+        .sign   = Sign::ZERO,
+        .digits = SmallVector<digit_type>{ 0 }
+    };
+    char buffer[1];
+
+    auto [end, error] = chars_from_integer(zero, 2, buffer, buffer);
+
+    EXPECT_EQ(std::errc::value_too_large, error);
+    EXPECT_EQ(buffer, end);
+}
+
+class MaxCharsFromIntegerTest : public ::testing::TestWithParam<unsigned int>
+{}; // class MaxCharsFromIntegerTest
+
+TEST_P(MaxCharsFromIntegerTest, MaxCharsSufficesAndMatchesStringOutput)
+{
+    unsigned int base = GetParam();
+    Integer integer   = integer_from_string(
+        "-1234567890123456789012345678901234567890123456789012345678901234567"
+        "89012345678901234567890123456789012345678901234567890", 10
+    );
+
+    std::size_t max_chars = max_chars_from_integer(integer, base);
+    std::string buffer(max_chars, '\0');
+
+    auto [end, error] = chars_from_integer(integer, base, buffer.data(),
+                                           buffer.data() + buffer.size());
+
+    ASSERT_EQ(std::errc(), error);
+    buffer.resize(end - buffer.data());
+    EXPECT_EQ(string_from_integer(integer, base), buffer);
+    EXPECT_GE(max_chars, buffer.size());
+    // the estimate overshoots by at most a token
+    EXPECT_LE(max_chars - buffer.size(), 1);
+}
+
+TEST_P(MaxCharsFromIntegerTest, BufferOneShortOfExactReportsValueTooLarge)
+{
+    unsigned int base = GetParam();
+
+    for (const char *tokens : { "-1", "7", "-100000000000000000000000000000",
+                                "99999999999999999999999999999999999999" }) {
+        Integer integer    = integer_from_string(tokens, 10);
+        std::string output = string_from_integer(integer, base);
+        std::string buffer(output.size(), '\0');
+
+        auto [short_end, short_error] =
+            chars_from_integer(integer, base, buffer.data(),
+                               buffer.data() + buffer.size() - 1);
+
+        EXPECT_EQ(std::errc::value_too_large, short_error);
+        EXPECT_EQ(buffer.data() + buffer.size() - 1, short_end);
+
+        auto [end, error] = chars_from_integer(integer, base, buffer.data(),
+                                               buffer.data() + buffer.size());
+
+        EXPECT_EQ(std::errc(), error);
+        EXPECT_EQ(output, buffer);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ChunkedAndPowerOfTwoBasesMaxCharsFromIntegerTest,
+    MaxCharsFromIntegerTest,
+    ::testing::Values(2, 3, 8, 10, 16, 36, 37, 62, 64)
+);
+
+} // namespace
@@ -1,5 +1,7 @@
 #include "tasty_int/detail/conversions/digits_from_floating_point.hpp"
 
+#include <cmath>
+
 #include <limits>
 
 #include "gtest/gtest.h"
@@ -10,6 +12,8 @@
 
 namespace {
 
+using tasty_int::detail::DIGIT_TYPE_BITS;
+using tasty_int::detail::digit_type;
 using tasty_int::detail::conversions::digits_from_floating_point;
 using from_floating_point_test_common::expect_digits_equal;
 
@@ -22,6 +26,49 @@ TEST_P(DigitsFromFloatingPointTest, TwoDigitsForValuesGreaterThanDigitTypeMax)
     expect_digits_equal(GetParam(), digits_from_floating_point(GetParam()));
 }
 
+TEST(DigitsFromFloatingPointExactnessTest, PowersOfTwoSetASingleBit)
+{
+    for (int exponent = 0;
+         exponent < std::numeric_limits<long double>::max_exponent;
+         exponent += 37) {
+        auto digits = digits_from_floating_point(std::ldexp(1.0L, exponent));
+
+        auto bit_index = static_cast<unsigned int>(exponent);
+        ASSERT_EQ((bit_index / DIGIT_TYPE_BITS) + 1, digits.size());
+        for (std::size_t index = 0; index + 1 < digits.size(); ++index)
+            ASSERT_EQ(0, digits[index]);
+        ASSERT_EQ(digit_type(1) << (bit_index % DIGIT_TYPE_BITS),
+                  digits.back());
+    }
+}
+
+TEST(DigitsFromFloatingPointExactnessTest, DoubleMaxIsRepresentedExactly)
+{
+    constexpr int MANTISSA_BITS = std::numeric_limits<double>::digits;
+    constexpr int MAX_EXPONENT  = std::numeric_limits<double>::max_exponent;
+    constexpr unsigned int LOW_BIT = MAX_EXPONENT - MANTISSA_BITS;
+
+    auto digits = digits_from_floating_point(
+        std::numeric_limits<double>::max()
+    );
+
+    // the top MANTISSA_BITS bits are set and every bit below them is clear
+    ASSERT_EQ(MAX_EXPONENT / DIGIT_TYPE_BITS, digits.size());
+    for (unsigned int bit = 0; bit < MAX_EXPONENT; ++bit) {
+        bool is_set = (
+            digits[bit / DIGIT_TYPE_BITS] >> (bit % DIGIT_TYPE_BITS)
+        ) & 1;
+        ASSERT_EQ(bit >= LOW_BIT, is_set) << "bit " << bit;
+    }
+}
+
+TEST(DigitsFromFloatingPointExactnessTest, FractionalValuesAreTruncated)
+{
+    EXPECT_EQ(1, digits_from_floating_point(0.5L).size());
+    EXPECT_EQ(0, digits_from_floating_point(0.5L).front());
+    EXPECT_EQ(12345, digits_from_floating_point(12345.999L).front());
+}
+
 INSTANTIATE_TEST_SUITE_P(
     DigitsFromFloatingPointTest,
     DigitsFromFloatingPointTest,
@@ -13,6 +13,7 @@ namespace {
 
 using tasty_int::detail::DIGIT_TYPE_BITS;
 using tasty_int::detail::DIGIT_TYPE_MAX;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 using tasty_int::detail::conversions::digits_from_integral;
 
@@ -22,7 +23,7 @@ class SmallValuesTest : public ::testing::TestWithParam<std::uintmax_t>
 
 TEST_P(SmallValuesTest, SingleDigitForValuesLessThanOrEqualToDigitTypeMax)
 {
-    std::vector<digit_type> expected = {
+    SmallVector<digit_type> expected = {
         static_cast<digit_type>(GetParam())
     };
 
@@ -36,12 +37,15 @@ INSTANTIATE_TEST_SUITE_P(
 );
 
 
+#if !TASTY_INT_HAVE_INT128_ACCUMULATOR
+// Values greater than DIGIT_TYPE_MAX only exist if std::uintmax_t spans
+// multiple digits.
 class LargeValuesTest : public ::testing::TestWithParam<std::uintmax_t>
 {}; // class LargeValuesTest
 
 TEST_P(LargeValuesTest, TwoDigitsForValuesGreaterThanDigitTypeMax)
 {
-    std::vector<digit_type> expected = {
+    SmallVector<digit_type> expected = {
         static_cast<digit_type>(GetParam()),
         static_cast<digit_type>(GetParam() >> DIGIT_TYPE_BITS)
     };
@@ -58,5 +62,6 @@ INSTANTIATE_TEST_SUITE_P(
         2
     )
 );
+#endif // if !TASTY_INT_HAVE_INT128_ACCUMULATOR
 
 } // namespace
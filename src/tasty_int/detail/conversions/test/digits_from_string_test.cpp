@@ -2,17 +2,23 @@
 
 #include <limits>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "gtest/gtest.h"
 
+#include "tasty_int/detail/digits_addition.hpp"
+#include "tasty_int/detail/digits_multiplication.hpp"
 #include "tasty_int/detail/conversions/test/base_support_test_common.hpp"
 #include "tasty_int/detail/conversions/test/string_conversion_test_common.hpp"
 
 
 namespace {
 
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
+using tasty_int::detail::DIGIT_TYPE_BITS;
 using tasty_int::detail::conversions::digits_from_string;
 using base_support_test_common::unsupported_bases;
 using string_conversion_test_common::StringViewConversionTestParam;
@@ -20,7 +26,7 @@ using string_conversion_test_common::StringViewConversionTestParam;
 
 void
 expect_single_digit_equals(digit_type                     value,
-                           const std::vector<digit_type> &digits)
+                           const SmallVector<digit_type> &digits)
 {
     EXPECT_EQ(value, digits.at(0));
     EXPECT_EQ(1,     digits.size());
@@ -103,7 +109,13 @@ INSTANTIATE_TEST_SUITE_P(
             { { 10, "+1234&56789" }, '+' },
             { { 16, "DEADBEEF*"   }, '*' },
             { { 36, "-123ab c"    }, '-' },
-            { { 64, " ABCabc123_" }, ' ' }
+            { { 64, " ABCabc123_" }, ' ' },
+            // the leftmost of several invalid tokens is reported
+            { {  2, "1012013"     }, '2' },
+            { {  8, "17x9"        }, 'x' },
+            { { 16, "1g2h"        }, 'g' },
+            { { 16, "1234X6789abcdef0Y23456789abcdef0" }, 'X' },
+            { { 64, "A!B?"        }, '!' }
         }
     )
 );
@@ -389,4 +401,91 @@ INSTANTIATE_TEST_SUITE_P(
     equivalent_multi_digit_tokens_in_all_bases()
 );
 
+
+class LargeValueTest : public ::testing::TestWithParam<unsigned int>
+{
+protected:
+    static std::string_view
+    get_alphabet(unsigned int base);
+
+    static std::string
+    make_tokens(std::string_view alphabet);
+
+    static SmallVector<digit_type>
+    evaluate_tokens(std::string_view tokens,
+                    std::string_view alphabet);
+}; // class LargeValueTest
+
+std::string_view
+LargeValueTest::get_alphabet(unsigned int base)
+{
+    std::string_view alphabet = (base <= 36)
+        ? "0123456789abcdefghijklmnopqrstuvwxyz"
+        : "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    return alphabet.substr(0, base);
+}
+
+/**
+ * Produces a string of tokens long enough to be parsed by divide-and-conquer,
+ * with leading zeros and interior runs of zeros that span entire splits.
+ */
+std::string
+LargeValueTest::make_tokens(std::string_view alphabet)
+{
+    const std::string zeros(1500, alphabet.front());
+
+    std::string tokens(700, alphabet.front());
+    tokens += alphabet.back();
+    tokens += zeros;
+    for (unsigned int i = 0; i < 30; ++i)
+        tokens += alphabet;
+    tokens += zeros;
+    tokens += alphabet;
+
+    return tokens;
+}
+
+SmallVector<digit_type>
+LargeValueTest::evaluate_tokens(std::string_view tokens,
+                                std::string_view alphabet)
+{
+    SmallVector<digit_type> digits = { 0 };
+
+    for (char token : tokens) {
+        digits *= alphabet.size();
+        digits += alphabet.find(token);
+    }
+
+    return digits;
+}
+
+TEST_P(LargeValueTest, EqualsTokensEvaluatedOneAtATime)
+{
+    auto base     = GetParam();
+    auto alphabet = get_alphabet(base);
+    auto tokens   = make_tokens(alphabet);
+
+    EXPECT_EQ(evaluate_tokens(tokens, alphabet),
+              digits_from_string(tokens, base));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    DigitsFromStringTest,
+    LargeValueTest,
+    ::testing::Range<unsigned int>(2, 65)
+);
+
+
+TEST(PowerOfTwoBaseTest, TokenStraddlingDigitBoundaryAddsNoLeadingZero)
+{
+    // the set bit of the leading octal token is the last below the boundary
+    unsigned int count_zeros = (DIGIT_TYPE_BITS - 1) / 3;
+    std::string  tokens      = "1" + std::string(count_zeros, '0');
+
+    auto digits = digits_from_string(tokens, 8);
+
+    expect_single_digit_equals(digit_type(1) << (count_zeros * 3), digits);
+}
+
 } // namespace
@@ -1,6 +1,7 @@
 #include "tasty_int/detail/conversions/floating_point_from_digits.hpp"
 
 #include <cmath>
+#include <cstdint>
 
 #include <limits>
 #include <string>
@@ -8,15 +9,23 @@
 #include "gtest/gtest.h"
 
 #include "tasty_int/detail/conversions/digits_from_floating_point.hpp"
+#include "tasty_int/detail/conversions/digits_from_integral.hpp"
 #include "tasty_int/detail/conversions/digits_from_string.hpp"
+#include "tasty_int/detail/test/integer_test_common.hpp"
 #include "tasty_int_test/base_10_integer_string_from_arithmetic.hpp"
 #include "tasty_int_test/logarithmic_range.hpp"
 
 
 namespace {
 
+using tasty_int::detail::DIGIT_TYPE_BITS;
+using tasty_int::detail::DIGIT_TYPE_MAX;
+using tasty_int::detail::SmallVector;
+using tasty_int::detail::digit_type;
+using tasty_int::detail::make_arbitrary_digits;
 using tasty_int::detail::conversions::floating_point_from_digits;
 using tasty_int::detail::conversions::digits_from_floating_point;
+using tasty_int::detail::conversions::digits_from_integral;
 using tasty_int::detail::conversions::digits_from_string;
 using tasty_int_test::base_10_integer_string_from_arithmetic;
 
@@ -53,4 +62,77 @@ TEST(FloatingPointFromDigitsTest, OverflowProducesPositiveInfinity)
               floating_point_from_digits(overflow_digits));
 }
 
+
+TEST(FloatingPointFromDigitsTest, SingleDigitMatchesHardwareConversion)
+{
+    for (digit_type value : make_arbitrary_digits(1000, 0)) {
+        SmallVector<digit_type> digits = { value };
+
+        EXPECT_EQ(static_cast<float>(value),
+                  floating_point_from_digits<float>(digits));
+        EXPECT_EQ(static_cast<double>(value),
+                  floating_point_from_digits<double>(digits));
+        EXPECT_EQ(static_cast<long double>(value),
+                  floating_point_from_digits<long double>(digits));
+    }
+}
+
+TEST(FloatingPointFromDigitsTest, TiesRoundToEven)
+{
+    constexpr std::uintmax_t TWO_POW_53 = std::uintmax_t(1) << 53;
+
+    EXPECT_EQ(0x1p53, floating_point_from_digits<double>(
+        digits_from_integral(TWO_POW_53 + 1)
+    ));
+    EXPECT_EQ(0x1p53 + 4.0, floating_point_from_digits<double>(
+        digits_from_integral(TWO_POW_53 + 3)
+    ));
+    EXPECT_EQ(0x1p24f, floating_point_from_digits<float>(
+        digits_from_integral((1 << 24) + 1)
+    ));
+}
+
+TEST(FloatingPointFromDigitsTest, LowDigitsBreakTies)
+{
+    constexpr std::uintmax_t TWO_POW_53 = std::uintmax_t(1) << 53;
+
+    auto digits = digits_from_integral(TWO_POW_53 + 1);
+    digits.insert(digits.begin(), 192 / DIGIT_TYPE_BITS, 0);
+
+    EXPECT_EQ(0x1p245, floating_point_from_digits<double>(digits));
+
+    digits.front() = 1;
+
+    EXPECT_EQ(0x1p245 + 0x1p193, floating_point_from_digits<double>(digits));
+}
+
+TEST(FloatingPointFromDigitsTest, RoundingCarriesIntoNextBinade)
+{
+    SmallVector<digit_type> digits(128 / DIGIT_TYPE_BITS, DIGIT_TYPE_MAX);
+
+    EXPECT_EQ(0x1p128, floating_point_from_digits<double>(digits));
+
+    digits.insert(digits.end(), 128 / DIGIT_TYPE_BITS, DIGIT_TYPE_MAX);
+
+    EXPECT_EQ(0x1p256, floating_point_from_digits<double>(digits));
+}
+
+TEST(FloatingPointFromDigitsTest, RoundingPastMaxProducesInfinity)
+{
+    // (2^53 - 1) * 2^971 is the largest double, and the value half an ulp
+    // above it rounds to 2^1024
+    SmallVector<digit_type> digits(1024 / DIGIT_TYPE_BITS, DIGIT_TYPE_MAX);
+
+    EXPECT_EQ(std::numeric_limits<double>::infinity(),
+              floating_point_from_digits<double>(digits));
+
+    // clear the round bit and the bits that follow it down to 2^960
+    for (unsigned int bit = 960; bit < 971; ++bit)
+        digits[bit / DIGIT_TYPE_BITS] &=
+            ~(digit_type(1) << (bit % DIGIT_TYPE_BITS));
+
+    EXPECT_EQ(std::numeric_limits<double>::max(),
+              floating_point_from_digits<double>(digits));
+}
+
 } // namespace
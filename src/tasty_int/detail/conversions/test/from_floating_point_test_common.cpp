@@ -7,13 +7,14 @@
 
 namespace from_floating_point_test_common {
 
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 using tasty_int::detail::DIGIT_BASE;
 
 
 void
 expect_digits_equal(long double                    expected,
-                    const std::vector<digit_type> &digits)
+                    const SmallVector<digit_type> &digits)
 {
     std::size_t index = 0;
 
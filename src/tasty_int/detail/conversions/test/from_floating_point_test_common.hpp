@@ -1,9 +1,8 @@
 #ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_TEST_FROM_FLOATING_POINT_TEST_COMMON_HPP
 #define TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_TEST_FROM_FLOATING_POINT_TEST_COMMON_HPP
 
-#include <vector>
-
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 
 
 namespace from_floating_point_test_common {
@@ -17,8 +16,8 @@ namespace from_floating_point_test_common {
  *     a floating point number
  */
 void
-expect_digits_equal(long double                                       expected,
-                    const std::vector<tasty_int::detail::digit_type> &digits);
+expect_digits_equal(long double                                                         expected,
+                    const tasty_int::detail::SmallVector<tasty_int::detail::digit_type> &digits);
 
 } // namespace from_floating_point_test_common
 
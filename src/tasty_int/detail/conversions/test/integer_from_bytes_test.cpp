@@ -0,0 +1,150 @@
+#include "tasty_int/detail/conversions/integer_from_bytes.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tasty_int/detail/conversions/bytes_from_integer.hpp"
+#include "tasty_int/detail/conversions/test/binary_conversion_test_common.hpp"
+#include "tasty_int/detail/test/integer_test_common.hpp"
+
+
+namespace {
+
+using tasty_int::BinaryFormat;
+using tasty_int::WordOrder;
+using tasty_int::detail::Integer;
+using tasty_int::detail::Sign;
+using tasty_int::detail::SmallVector;
+using tasty_int::detail::digit_type;
+using tasty_int::detail::make_arbitrary_digits;
+using tasty_int::detail::conversions::bytes_from_integer;
+using tasty_int::detail::conversions::count_bytes_from_integer;
+using tasty_int::detail::conversions::integer_from_bytes;
+using binary_conversion_test_common::BinaryConversionTestParam;
+using binary_conversion_test_common::make_bytes;
+
+
+TEST(IntegerFromBytesTest, InvalidWordSizeThrowsInvalidArgument)
+{
+    BinaryFormat format = { .word_size = 0 };
+
+    EXPECT_THROW(integer_from_bytes(make_bytes({ 0x00 }), format),
+                 std::invalid_argument);
+}
+
+TEST(IntegerFromBytesTest, MissingSignByteThrowsInvalidArgument)
+{
+    EXPECT_THROW(integer_from_bytes(std::vector<std::byte>(), BinaryFormat()),
+                 std::invalid_argument);
+}
+
+TEST(IntegerFromBytesTest, PartialWordThrowsInvalidArgument)
+{
+    BinaryFormat format = { .word_size = 2 };
+
+    EXPECT_THROW(integer_from_bytes(make_bytes({ 0x00, 0x01, 0x02, 0x03 }),
+                                    format),
+                 std::invalid_argument);
+}
+
+TEST(IntegerFromBytesTest, InvalidSignByteThrowsInvalidArgument)
+{
+    BinaryFormat format = { .word_size = 1 };
+
+    EXPECT_THROW(integer_from_bytes(make_bytes({ 0x02, 0x01 }), format),
+                 std::invalid_argument);
+}
+
+TEST(IntegerFromBytesTest, LoneSignByteIsZero)
+{
+    EXPECT_EQ((Integer { .sign   = Sign::ZERO,
+                         .digits = SmallVector<digit_type>{ 0 } }),
+              integer_from_bytes(make_bytes({ 0x01 }), BinaryFormat()));
+}
+
+TEST(IntegerFromBytesTest, NegativeZeroWordsAreZero)
+{
+    BinaryFormat format = { .word_size = 4 };
+
+    EXPECT_EQ((Integer { .sign   = Sign::ZERO,
+                         .digits = SmallVector<digit_type>{ 0 } }),
+              integer_from_bytes(make_bytes({ 0x01, 0x00, 0x00, 0x00, 0x00,
+                                              0x00, 0x00, 0x00, 0x00 }),
+                                 format));
+}
+
+TEST(IntegerFromBytesTest, LeadingZeroWordsAreTrimmed)
+{
+    BinaryFormat format = {
+        .word_size  = 8,
+        .word_order = WordOrder::MOST_SIGNIFICANT_FIRST,
+        .byte_order = std::endian::big
+    };
+    auto bytes = make_bytes({
+        0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a
+    });
+
+    EXPECT_EQ((Integer { .sign   = Sign::POSITIVE,
+                         .digits = SmallVector<digit_type>{ 42 } }),
+              integer_from_bytes(bytes, format));
+}
+
+
+class IntegerFromBytesLayoutTest
+    : public ::testing::TestWithParam<BinaryConversionTestParam>
+{}; // class IntegerFromBytesLayoutTest
+
+TEST_P(IntegerFromBytesLayoutTest, ReadsExpectedInteger)
+{
+    const auto &[integer, format, bytes] = GetParam();
+
+    EXPECT_EQ(integer, integer_from_bytes(bytes, format));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    IntegerFromBytesTest,
+    IntegerFromBytesLayoutTest,
+    ::testing::ValuesIn(binary_conversion_test_common::LAYOUT_TEST_PARAMS)
+);
+
+
+class BinaryRoundTripTest : public ::testing::TestWithParam<std::size_t>
+{}; // class BinaryRoundTripTest
+
+TEST_P(BinaryRoundTripTest, IntegerFromBytesFromIntegerIsIdentity)
+{
+    Integer integer = {
+        .sign   = Sign::POSITIVE,
+        .digits = make_arbitrary_digits(GetParam(), GetParam())
+    };
+
+    for (auto word_order : { WordOrder::LEAST_SIGNIFICANT_FIRST,
+                             WordOrder::MOST_SIGNIFICANT_FIRST })
+        for (auto byte_order : { std::endian::little, std::endian::big })
+            for (std::size_t word_size : { 1, 2, 5, 8, 13 }) {
+                BinaryFormat format = {
+                    .word_size  = word_size,
+                    .word_order = word_order,
+                    .byte_order = byte_order
+                };
+                std::vector<std::byte> bytes(
+                    count_bytes_from_integer(integer, format)
+                );
+                bytes_from_integer(integer, format, bytes);
+
+                EXPECT_EQ(integer, integer_from_bytes(bytes, format));
+            }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    IntegerFromBytesTest,
+    BinaryRoundTripTest,
+    ::testing::Values(1, 2, 3, 17, 100)
+);
+
+} // namespace
@@ -0,0 +1,103 @@
+#include "tasty_int/detail/conversions/integer_from_chars.hpp"
+
+#include <stdexcept>
+#include <string_view>
+
+#include "gtest/gtest.h"
+
+#include "tasty_int/detail/test/integer_test_common.hpp"
+
+
+namespace {
+
+using tasty_int::detail::Integer;
+using tasty_int::detail::Sign;
+using tasty_int::detail::SmallVector;
+using tasty_int::detail::digit_type;
+using tasty_int::detail::conversions::integer_from_chars;
+
+
+std::from_chars_result
+integer_from_chars(std::string_view  tokens,
+                   unsigned int      base,
+                   Integer          &integer)
+{
+    return integer_from_chars(tokens.data(), tokens.data() + tokens.size(),
+                              base, integer);
+}
+
+TEST(IntegerFromCharsTest, UnsupportedBaseThrowsInvalidArgument)
+{
+    Integer integer;
+
+    EXPECT_THROW(integer_from_chars("1", 0, integer), std::invalid_argument);
+    EXPECT_THROW(integer_from_chars("1", 65, integer), std::invalid_argument);
+}
+
+TEST(IntegerFromCharsTest, ParsesLongestPrefixOfTokens)
+{
+    std::string_view tokens = "-1f2g";
+    Integer integer;
+
+    auto [end, error] = integer_from_chars(tokens, 16, integer);
+
+    EXPECT_EQ(std::errc(), error);
+    EXPECT_EQ(tokens.data() + 4, end);
+    EXPECT_EQ((Integer { .sign   = Sign::NEGATIVE,
+                         .digits = SmallVector<digit_type>{ 0x1f2 } }),
+              integer);
+}
+
+TEST(IntegerFromCharsTest, NegativeZeroIsZero)
+{
+    Integer integer;
+
+    auto [end, error] = integer_from_chars("-000", 10, integer);
+
+    EXPECT_EQ(std::errc(), error);
+    EXPECT_EQ((Integer { .sign   = Sign::ZERO,
+                         .digits = SmallVector<digit_type>{ 0 } }),
+              integer);
+}
+
+TEST(IntegerFromCharsTest, MinusSignIsAcceptedInBase64)
+{
+    std::string_view tokens = "-+/";
+    Integer integer;
+
+    auto [end, error] = integer_from_chars(tokens, 64, integer);
+
+    EXPECT_EQ(std::errc(), error);
+    EXPECT_EQ(tokens.data() + tokens.size(), end);
+    EXPECT_EQ((Integer { .sign   = Sign::NEGATIVE,
+                         .digits = SmallVector<digit_type>{ (62 * 64) + 63 } }),
+              integer);
+}
+
+class IntegerFromCharsNoNumberTest
+    : public ::testing::TestWithParam<std::string_view>
+{}; // class IntegerFromCharsNoNumberTest
+
+TEST_P(IntegerFromCharsNoNumberTest, NoNumberReportsInvalidArgument)
+{
+    std::string_view tokens = GetParam();
+    Integer integer = {
+        .sign   = Sign::POSITIVE,
+        .digits = SmallVector<digit_type>{ 7 }
+    };
+    Integer original = integer;
+
+    auto [end, error] = integer_from_chars(tokens, 10, integer);
+
+    EXPECT_EQ(std::errc::invalid_argument, error);
+    EXPECT_EQ(tokens.data(), end);
+    EXPECT_EQ(original, integer);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    IntegerFromCharsTest,
+    IntegerFromCharsNoNumberTest,
+    ::testing::Values("", "-", "+1", " 1", "--1", "a")
+);
+
+} // namespace
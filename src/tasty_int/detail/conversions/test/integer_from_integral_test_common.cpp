@@ -7,6 +7,7 @@ namespace integer_from_integral_test_common {
 
 using tasty_int::detail::Integer;
 using tasty_int::detail::Sign;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 using tasty_int::detail::DIGIT_BASE;
 using tasty_int::detail::DIGIT_TYPE_MAX;
@@ -15,7 +16,7 @@ using tasty_int::detail::DIGITS_PER_DIGIT_ACCUMULATOR;
 
 void
 expect_digits_equal(std::uintmax_t                 expected,
-                    const std::vector<digit_type> &digits)
+                    const SmallVector<digit_type> &digits)
 {
     EXPECT_EQ(static_cast<digit_type>(expected), digits.at(0));
 
@@ -3,9 +3,8 @@
 
 #include <cstdint>
 
-#include <vector>
-
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 #include "tasty_int/detail/integer.hpp"
 
 
@@ -20,8 +19,8 @@ namespace integer_from_integral_test_common {
  *     an unsigned integer
  */
 void
-expect_digits_equal(std::uintmax_t                                    expected,
-                    const std::vector<tasty_int::detail::digit_type> &digits);
+expect_digits_equal(std::uintmax_t                                                      expected,
+                    const tasty_int::detail::SmallVector<tasty_int::detail::digit_type> &digits);
 
 /**
  * @brief testing utility for checking that @p actual is equivalent to zero.
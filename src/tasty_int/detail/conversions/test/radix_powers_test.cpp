@@ -0,0 +1,109 @@
+#include "tasty_int/detail/conversions/radix_powers.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+
+#include "tasty_int/detail/conversions/codegen/token_chunk_table.hpp"
+#include "tasty_int/detail/conversions/digits_from_string.hpp"
+#include "tasty_int/detail/conversions/token_values_from_digits.hpp"
+#include "tasty_int/detail/digits_multiplication.hpp"
+
+
+namespace {
+
+using tasty_int::detail::SmallVector;
+using tasty_int::detail::digit_type;
+using tasty_int::detail::DIGIT_TYPE_MAX;
+using tasty_int::detail::conversions::radix_power;
+using tasty_int::detail::conversions::trim_radix_powers;
+using tasty_int::detail::conversions::largest_memoized_radix_power_magnitude;
+using tasty_int::detail::conversions::RETAINED_RADIX_POWER_MAGNITUDE;
+using tasty_int::detail::conversions::digits_from_string;
+using tasty_int::detail::conversions::token_values_from_digits;
+using tasty_int::detail::conversions::codegen::TOKEN_CHUNK_TABLE;
+
+
+class RadixPowersTest : public ::testing::TestWithParam<unsigned int>
+{}; // class RadixPowersTest
+
+TEST_P(RadixPowersTest, TokenChunkIsLargestPowerWithinDigit)
+{
+    auto base        = GetParam();
+    auto token_chunk = TOKEN_CHUNK_TABLE[base];
+
+    digit_type expected_radix_power = 1;
+    for (unsigned int i = 0; i < token_chunk.count_tokens; ++i)
+        expected_radix_power *= base;
+
+    EXPECT_EQ(expected_radix_power, token_chunk.radix_power);
+    EXPECT_GT(token_chunk.radix_power, DIGIT_TYPE_MAX / base);
+}
+
+TEST_P(RadixPowersTest, LevelZeroIsTokenChunkRadixPower)
+{
+    auto base = GetParam();
+
+    EXPECT_EQ((SmallVector<digit_type> { TOKEN_CHUNK_TABLE[base].radix_power }),
+              radix_power(base, 0));
+}
+
+TEST_P(RadixPowersTest, EachLevelIsSquareOfPrevious)
+{
+    auto base = GetParam();
+
+    for (std::size_t level = 1; level < 5; ++level) {
+        const auto &previous = radix_power(base, level - 1);
+
+        EXPECT_EQ(previous * previous, radix_power(base, level));
+    }
+}
+
+TEST_P(RadixPowersTest, PowersAreMemoized)
+{
+    auto base = GetParam();
+
+    const auto *level_zero = &radix_power(base, 0);
+    radix_power(base, 8);
+
+    EXPECT_EQ(level_zero, &radix_power(base, 0));
+}
+
+TEST_P(RadixPowersTest, TrimmedPowersAreRecomputed)
+{
+    auto base = GetParam();
+
+    const auto *level_zero    = &radix_power(base, 0);
+    auto        largest_power = radix_power(base, 12);
+
+    trim_radix_powers();
+
+    EXPECT_EQ(level_zero, &radix_power(base, 0));
+    EXPECT_EQ(largest_power, radix_power(base, 12));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    RadixPowersTest,
+    RadixPowersTest,
+    ::testing::Range<unsigned int>(2, 65)
+);
+
+TEST(RadixPowersRetentionTest, LargeConversionsRetainOnlySmallPowers)
+{
+    // spans radix powers well beyond RETAINED_RADIX_POWER_MAGNITUDE
+    std::string tokens(200000, '7');
+
+    auto digits = digits_from_string(tokens, 10);
+
+    EXPECT_LE(largest_memoized_radix_power_magnitude(10),
+              RETAINED_RADIX_POWER_MAGNITUDE);
+
+    std::string token_values;
+    token_values_from_digits(digits, 10, token_values);
+
+    EXPECT_LE(largest_memoized_radix_power_magnitude(10),
+              RETAINED_RADIX_POWER_MAGNITUDE);
+    EXPECT_EQ(tokens.size(), token_values.size());
+}
+
+} // namespace
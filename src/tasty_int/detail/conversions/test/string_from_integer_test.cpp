@@ -13,6 +13,7 @@ namespace {
 
 using tasty_int::detail::Integer;
 using tasty_int::detail::Sign;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 using tasty_int::detail::conversions::digits_from_string;
 using tasty_int::detail::conversions::string_from_integer;
@@ -28,7 +29,7 @@ TEST_P(StringFromZeroTest, ZeroInterprettedAsZero)
     auto [base, zero_token] = GetParam();
     Integer zero = {
         .sign   = Sign::ZERO,
-        .digits = std::vector<digit_type>{ 0 }
+        .digits = SmallVector<digit_type>{ 0 }
     };
 
     std::string result = string_from_integer(zero, base);
@@ -58,7 +59,7 @@ TEST(StringFromIntegerTest, SingleNegativeTokenTest)
 {
     Integer negative_one = {
         .sign   = Sign::NEGATIVE,
-        .digits = std::vector<digit_type>{ 1 }
+        .digits = SmallVector<digit_type>{ 1 }
     };
 
     std::string result = string_from_integer(negative_one, 10);
@@ -71,7 +72,7 @@ class SingleDigitConsistencyTest
 {
 public:
     static const std::string_view        SINGLE_DIGIT_BASE_10_TOKENS;
-    static const std::vector<digit_type> INPUT_DIGITS;
+    static const SmallVector<digit_type> INPUT_DIGITS;
     static const std::vector<StringViewConversionTestParam>
         EQUIVALENT_SINGLE_DIGIT_TOKENS_IN_ALL_BASES;
 }; // class SingleDigitConsistencyTest
@@ -79,7 +80,7 @@ public:
 const std::string_view SingleDigitConsistencyTest::SINGLE_DIGIT_BASE_10_TOKENS =
     "24680";
 
-const std::vector<digit_type> SingleDigitConsistencyTest::INPUT_DIGITS =
+const SmallVector<digit_type> SingleDigitConsistencyTest::INPUT_DIGITS =
     digits_from_string(SINGLE_DIGIT_BASE_10_TOKENS,
                        10);
 
@@ -194,7 +195,7 @@ class MultiDigitConsistencyTest
 {
 public:
     static const std::string_view        MULTI_DIGIT_BASE_10_TOKENS;
-    static const std::vector<digit_type> INPUT_DIGITS;
+    static const SmallVector<digit_type> INPUT_DIGITS;
     static const std::vector<StringViewConversionTestParam>
         EQUIVALENT_MULTI_DIGIT_TOKENS_IN_ALL_BASES;
 }; // class MultiDigitConsistencyTest
@@ -211,7 +212,7 @@ const std::string_view MultiDigitConsistencyTest::MULTI_DIGIT_BASE_10_TOKENS =
     "2468013579"
     "2468013579";
 
-const std::vector<digit_type> MultiDigitConsistencyTest::INPUT_DIGITS =
+const SmallVector<digit_type> MultiDigitConsistencyTest::INPUT_DIGITS =
     digits_from_string(MULTI_DIGIT_BASE_10_TOKENS,
                        10);
 
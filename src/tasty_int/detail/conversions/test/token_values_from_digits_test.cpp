@@ -1,5 +1,6 @@
 #include "tasty_int/detail/conversions/token_values_from_digits.hpp"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -15,8 +16,11 @@ namespace {
 
 using tasty_int::detail::conversions::base_36_token_from_value;
 using tasty_int::detail::conversions::base_64_token_from_value;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
+using tasty_int::detail::DIGIT_TYPE_BITS;
 using tasty_int::detail::conversions::digits_from_string;
+using tasty_int::detail::conversions::stream_token_values_from_digits;
 using tasty_int::detail::conversions::token_values_from_digits;
 using string_conversion_test_common::StringViewConversionTestParam;
 
@@ -36,6 +40,31 @@ std::string tokens_from_token_values(const std::string &token_values,
     return tokens;
 }
 
+/**
+ * Concatenates the segments streamed by stream_token_values_from_digits(),
+ * recording the length of the longest.
+ */
+std::string stream_token_values(const SmallVector<digit_type> &digits,
+                                unsigned int                   base,
+                                std::size_t                   &max_length)
+{
+    std::string token_values;
+
+    max_length = 0;
+    stream_token_values_from_digits(
+        digits, base,
+        [&](char *first, char *last) {
+            token_values.append(first, last);
+            max_length = std::max<std::size_t>(max_length, last - first);
+        }
+    );
+
+    // present in the little-endian order of token_values_from_digits()
+    std::reverse(token_values.begin(), token_values.end());
+
+    return token_values;
+}
+
 
 class ZeroTest : public ::testing::TestWithParam<unsigned int>
 {}; // class ZeroTest
@@ -45,12 +74,23 @@ TEST_P(ZeroTest, ZeroInterprettedAsZero)
     unsigned int base = GetParam();
     std::string token_values;
 
-    token_values_from_digits(std::vector<digit_type>{ 0 }, base,
+    token_values_from_digits(SmallVector<digit_type>{ 0 }, base,
                              token_values);
 
     EXPECT_EQ(std::string{ '\0' }, token_values);
 }
 
+TEST_P(ZeroTest, StreamedZeroInterprettedAsZero)
+{
+    unsigned int base = GetParam();
+    std::size_t  max_length;
+
+    std::string token_values = stream_token_values(SmallVector<digit_type>{ 0 },
+                                                   base, max_length);
+
+    EXPECT_EQ(std::string{ '\0' }, token_values);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     StringFromDigitsTest,
     ZeroTest,
@@ -63,7 +103,7 @@ class SingleDigitConsistencyTest
 {
 public:
     static const std::string_view        SINGLE_DIGIT_BASE_10_TOKENS;
-    static const std::vector<digit_type> INPUT_DIGITS;
+    static const SmallVector<digit_type> INPUT_DIGITS;
     static const std::vector<StringViewConversionTestParam>
         EQUIVALENT_SINGLE_DIGIT_TOKENS_IN_ALL_BASES;
 }; // class SingleDigitConsistencyTest
@@ -71,7 +111,7 @@ public:
 const std::string_view SingleDigitConsistencyTest::SINGLE_DIGIT_BASE_10_TOKENS =
     "987654321";
 
-const std::vector<digit_type> SingleDigitConsistencyTest::INPUT_DIGITS =
+const SmallVector<digit_type> SingleDigitConsistencyTest::INPUT_DIGITS =
     digits_from_string(SINGLE_DIGIT_BASE_10_TOKENS,
                        10);
 
@@ -167,7 +207,7 @@ class MultiDigitConsistencyTest
 {
 public:
     static const std::string_view        MULTI_DIGIT_BASE_10_TOKENS;
-    static const std::vector<digit_type> INPUT_DIGITS;
+    static const SmallVector<digit_type> INPUT_DIGITS;
     static const std::vector<StringViewConversionTestParam>
         EQUIVALENT_MULTI_DIGIT_TOKENS_IN_ALL_BASES;
 }; // class MultiDigitConsistencyTest
@@ -182,7 +222,7 @@ const std::string_view MultiDigitConsistencyTest::MULTI_DIGIT_BASE_10_TOKENS =
     "9876543210"
     "9876543210";
 
-const std::vector<digit_type> MultiDigitConsistencyTest::INPUT_DIGITS =
+const SmallVector<digit_type> MultiDigitConsistencyTest::INPUT_DIGITS =
     digits_from_string(MULTI_DIGIT_BASE_10_TOKENS,
                        10);
 
@@ -272,4 +312,87 @@ INSTANTIATE_TEST_SUITE_P(
     )
 );
 
+
+class LargeValueRoundTripTest : public ::testing::TestWithParam<unsigned int>
+{
+protected:
+    static std::string
+    make_tokens(unsigned int base);
+}; // class LargeValueRoundTripTest
+
+/**
+ * Produces a string of tokens long enough to be converted by divide-and-
+ * conquer, with runs of zeros that must be padded at every split.
+ */
+std::string
+LargeValueRoundTripTest::make_tokens(unsigned int base)
+{
+    auto token_from_value = (base <= 36)
+                          ? base_36_token_from_value
+                          : base_64_token_from_value;
+
+    std::string pattern;
+    for (unsigned int value = 0; value < base; ++value)
+        pattern.push_back(token_from_value(value));
+
+    const std::string zeros(3000, token_from_value(0));
+
+    std::string tokens(1, token_from_value(1));
+    tokens += zeros;
+    for (unsigned int i = 0; i < 40; ++i)
+        tokens += pattern;
+    tokens += zeros;
+    tokens += pattern;
+
+    return tokens;
+}
+
+TEST_P(LargeValueRoundTripTest, ConversionFromParsedDigitsRestoresTokens)
+{
+    unsigned int base   = GetParam();
+    std::string  tokens = make_tokens(base);
+    auto         digits = digits_from_string(tokens, base);
+
+    std::string token_values;
+    token_values_from_digits(digits, base,
+                             token_values);
+
+    EXPECT_EQ(tokens, tokens_from_token_values(token_values, base));
+}
+
+TEST_P(LargeValueRoundTripTest, StreamingFromParsedDigitsRestoresTokens)
+{
+    unsigned int base   = GetParam();
+    std::string  tokens = make_tokens(base);
+    auto         digits = digits_from_string(tokens, base);
+    std::size_t  max_length;
+
+    std::string token_values = stream_token_values(digits, base, max_length);
+
+    EXPECT_EQ(tokens, tokens_from_token_values(token_values, base));
+    EXPECT_LT(max_length, tokens.size());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    StringFromDigitsTest,
+    LargeValueRoundTripTest,
+    ::testing::Range<unsigned int>(2, 65)
+);
+
+
+TEST(PowerOfTwoBaseTest, TokenStraddlingDigitBoundaryAddsNoLeadingZero)
+{
+    // the set bit of the leading octal token is the last below the boundary
+    unsigned int count_zeros = (DIGIT_TYPE_BITS - 1) / 3;
+    std::string token_values;
+
+    token_values_from_digits(
+        SmallVector<digit_type>{ digit_type(1) << (count_zeros * 3) }, 8,
+        token_values
+    );
+
+    EXPECT_EQ("1" + std::string(count_zeros, '0'),
+              tokens_from_token_values(token_values, 8));
+}
+
 } // namespace
@@ -0,0 +1,99 @@
+#include "tasty_int/detail/conversions/token_word.hpp"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using tasty_int::detail::conversions::TokenWord;
+using tasty_int::detail::conversions::TOKENS_PER_WORD;
+using tasty_int::detail::conversions::load_token_word;
+using tasty_int::detail::conversions::store_token_word;
+using tasty_int::detail::conversions::is_decimal_token_word;
+using tasty_int::detail::conversions::value_from_decimal_token_word;
+using tasty_int::detail::conversions::is_hexadecimal_token_word;
+using tasty_int::detail::conversions::value_from_hexadecimal_token_word;
+using tasty_int::detail::conversions::base_36_token_word_from_values;
+
+
+TokenWord
+load(const std::string &tokens)
+{
+    return load_token_word(tokens.data());
+}
+
+std::string
+store(TokenWord word)
+{
+    std::string tokens(TOKENS_PER_WORD, '\0');
+    store_token_word(word, tokens.data());
+
+    return tokens;
+}
+
+
+TEST(TokenWordTest, FirstTokenIsLeastSignificantByte)
+{
+    EXPECT_EQ(0x3837363534333231U, load("12345678"));
+}
+
+TEST(TokenWordTest, StoreRestoresLoadedTokens)
+{
+    EXPECT_EQ("a1B2c3D4", store(load("a1B2c3D4")));
+}
+
+TEST(TokenWordTest, DecimalTokensAreDecimal)
+{
+    EXPECT_TRUE(is_decimal_token_word(load("01234567")));
+    EXPECT_TRUE(is_decimal_token_word(load("89999999")));
+}
+
+TEST(TokenWordTest, NonDecimalTokensAreNotDecimal)
+{
+    for (const char *tokens : {
+             "0123456/", "0123456:", "a1234567", "1234 567", "1234567\x80",
+             "\xb0" "1234567", "\xff\xff\xff\xff\xff\xff\xff\xff"
+         })
+        EXPECT_FALSE(is_decimal_token_word(load(tokens))) << tokens;
+}
+
+TEST(TokenWordTest, DecimalValue)
+{
+    EXPECT_EQ(12345678U, value_from_decimal_token_word(load("12345678")));
+    EXPECT_EQ(0U,        value_from_decimal_token_word(load("00000000")));
+    EXPECT_EQ(99999999U, value_from_decimal_token_word(load("99999999")));
+    EXPECT_EQ(907U,      value_from_decimal_token_word(load("00000907")));
+}
+
+TEST(TokenWordTest, HexadecimalTokensAreHexadecimal)
+{
+    EXPECT_TRUE(is_hexadecimal_token_word(load("01234567")));
+    EXPECT_TRUE(is_hexadecimal_token_word(load("89abcdef")));
+    EXPECT_TRUE(is_hexadecimal_token_word(load("ABCDEF00")));
+}
+
+TEST(TokenWordTest, NonHexadecimalTokensAreNotHexadecimal)
+{
+    for (const char *tokens : {
+             "0123456g", "G1234567", "@1234567", "`1234567", "1234567/",
+             "1234567:", "1234 567", "1234567\xc1"
+         })
+        EXPECT_FALSE(is_hexadecimal_token_word(load(tokens))) << tokens;
+}
+
+TEST(TokenWordTest, HexadecimalValue)
+{
+    EXPECT_EQ(0x01234567U, value_from_hexadecimal_token_word(load("01234567")));
+    EXPECT_EQ(0x89ABCDEFU, value_from_hexadecimal_token_word(load("89abcdef")));
+    EXPECT_EQ(0xFEDCBA98U, value_from_hexadecimal_token_word(load("FEDCBA98")));
+}
+
+TEST(TokenWordTest, Base36TokensFromValues)
+{
+    EXPECT_EQ("019abxyz",
+              store(base_36_token_word_from_values(0x2322210B0A090100U)));
+}
+
+} // namespace
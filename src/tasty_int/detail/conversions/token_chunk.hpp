@@ -0,0 +1,32 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_TOKEN_CHUNK_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_TOKEN_CHUNK_HPP
+
+#include <array>
+
+#include "tasty_int/detail/digit_type.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+namespace conversions {
+
+/**
+ * This struct describes the largest run of tokens in a particular base whose
+ * value always fits within a single digit.
+ */
+struct TokenChunk
+{
+    unsigned int count_tokens; ///< the number of tokens, `k`
+    digit_type   radix_power;  ///< `base^k`
+}; // struct TokenChunk
+
+/**
+ * A TokenChunk for each base in `[0, 64]`.
+ */
+using TokenChunkTable = std::array<TokenChunk, 65>;
+
+} // namespace conversions
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_TOKEN_CHUNK_HPP
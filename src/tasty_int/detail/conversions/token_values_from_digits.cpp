@@ -1,8 +1,17 @@
 #include "tasty_int/detail/conversions/token_values_from_digits.hpp"
 
 #include <cassert>
+#include <cstddef>
 
-#include <limits>
+#include <algorithm>
+#include <bit>
+#include <iterator>
+
+#include "tasty_int/detail/conversions/codegen/token_chunk_table.hpp"
+#include "tasty_int/detail/conversions/radix_powers.hpp"
+#include "tasty_int/detail/digits_comparison.hpp"
+#include "tasty_int/detail/digits_division.hpp"
+#include "tasty_int/detail/invariant_digit_divisor.hpp"
 
 
 namespace tasty_int {
@@ -10,6 +19,26 @@ namespace detail {
 namespace conversions {
 namespace {
 
+/**
+ * The digits size at or below which digits are converted to token values by
+ * repeated multiplication rather than by divide-and-conquer.
+ */
+constexpr SmallVector<digit_type>::size_type
+DIVIDE_AND_CONQUER_THRESHOLD_MAGNITUDE = 32;
+
+/**
+ * The number of token values passed to a TokenValuesConsumer at a time when
+ * streaming a power-of-two base.
+ */
+constexpr std::size_t BITWISE_SEGMENT_LENGTH = 4096;
+
+/**
+ * The capacity beyond which the per-thread chunk value buffer of
+ * multiply_convert() is released once a conversion completes.
+ */
+constexpr SmallVector<digit_type>::size_type RETAINED_CHUNK_VALUES_CAPACITY =
+    DIVIDE_AND_CONQUER_THRESHOLD_MAGNITUDE * 4;
+
 /**
  * This class converts a little-endian sequence of digits to a little-endian
  * sequence of values according to the provided base.
@@ -23,7 +52,7 @@ public:
      * @param[in] base the numeric base/radix in which the output to
      *     convert_to_token_values() is presented
      *
-     * @pre `(base >= 2) && (base <= (std::numeric_limits<char>::max() + 1))`
+     * @pre `(base >= 2) && (base <= 64)`
      */
     TokenValuesConverter(unsigned int base);
 
@@ -38,88 +67,534 @@ public:
      * @pre @p token_values is empty
      */
     void
-    convert_to_token_values(const std::vector<digit_type> &digits,
-                            std::string                   &token_values) const;
+    convert_to_token_values(DigitsView   digits,
+                            std::string &token_values) const;
+
+    /**
+     * @brief Converts @p digits to token values in base @p base, passing them
+     *     to @p consume most significant first in bounded segments.
+     *
+     * @param[in] digits  a little-endian sequence of digits
+     * @param[in] consume the receiver of the segments of token values
+     *
+     * @pre @p digits is not empty
+     */
+    void
+    stream_token_values(DigitsView                 digits,
+                        const TokenValuesConsumer &consume) const;
 
 private:
     void
-    accumulate_digit(std::string &token_values,
-                     digit_type   digit) const;
+    bitwise_convert(DigitsView   digits,
+                    std::string &token_values) const;
+
+    std::size_t
+    count_radix_power_levels(SmallVector<digit_type>::size_type count_digits)
+    const;
 
-    digit_accumulator_type
-    multiply_accumulate(std::string            &token_values,
-                        digit_accumulator_type  addend) const;
+    void
+    divide_and_conquer_convert(
+        const SmallVector<digit_type> &digits,
+        std::size_t                    count_levels,
+        std::string::size_type         min_count_token_values,
+        std::string                   &token_values
+    ) const;
+
+    void
+    bitwise_stream(DigitsView                 digits,
+                   const TokenValuesConsumer &consume) const;
+
+    void
+    divide_and_conquer_stream(
+        const SmallVector<digit_type> &digits,
+        std::size_t                    count_levels,
+        std::string::size_type         min_count_token_values,
+        std::string                   &segment,
+        const TokenValuesConsumer     &consume
+    ) const;
 
-    const digit_accumulator_type token_base;
+    void
+    multiply_stream(DigitsView                 digits,
+                    std::string::size_type     min_count_token_values,
+                    std::string               &segment,
+                    const TokenValuesConsumer &consume) const;
+
+    void
+    multiply_convert(DigitsView              digits,
+                     std::string::size_type  min_count_token_values,
+                     std::string            &token_values) const;
+
+    void
+    accumulate_digit(SmallVector<digit_type> &chunk_values,
+                     digit_type               digit) const;
+
+    digit_type
+    multiply_accumulate(SmallVector<digit_type> &chunk_values,
+                        digit_type               addend) const;
+
+    void
+    append_token_values(const SmallVector<digit_type> &chunk_values,
+                        std::string                   &token_values) const;
+
+    digit_type
+    append_token_value(digit_type   chunk_value,
+                       std::string &token_values) const;
+
+    static TokenChunk
+    get_token_chunk(unsigned int base);
+
+    static unsigned int
+    count_bits_per_token(unsigned int base);
+
+    const digit_type            token_base;
+    const TokenChunk            token_chunk;
+    const unsigned int          bits_per_token;
+    const InvariantDigitDivisor token_base_divisor;
+    const InvariantDigitDivisor radix_power_divisor;
 }; // class TokenValuesConverter
 
 
 TokenValuesConverter::TokenValuesConverter(unsigned int base)
     : token_base(base)
+    , token_chunk(get_token_chunk(base))
+    , bits_per_token(count_bits_per_token(base))
+    , token_base_divisor(token_base)
+    , radix_power_divisor(token_chunk.radix_power)
+{}
+
+TokenChunk
+TokenValuesConverter::get_token_chunk(unsigned int base)
 {
     assert(base >= 2);
-    assert(base <= (std::numeric_limits<char>::max() + 1u));
+    assert(base <= 64);
+
+    return codegen::TOKEN_CHUNK_TABLE[base];
+}
+
+/**
+ * Each token of a power-of-two base maps onto a fixed group of bits, which is
+ * counted here.  Other bases have no such mapping and are assigned zero bits.
+ */
+unsigned int
+TokenValuesConverter::count_bits_per_token(unsigned int base)
+{
+    return std::has_single_bit(base) ? std::countr_zero(base) : 0;
 }
 
 void
 TokenValuesConverter::convert_to_token_values(
-    const std::vector<digit_type> &digits,
-    std::string                   &token_values
+    DigitsView   digits,
+    std::string &token_values
 ) const
 {
     assert(!digits.empty());
     assert(token_values.empty());
 
-    token_values.push_back('\0');
+    if (bits_per_token > 0) {
+        bitwise_convert(digits, token_values);
+        return;
+    }
 
-    for(auto cursor = digits.rbegin(); cursor != digits.rend(); ++cursor)
-        accumulate_digit(token_values, *cursor);
+    if (digits.size() <= DIVIDE_AND_CONQUER_THRESHOLD_MAGNITUDE) {
+        multiply_convert(digits, 0, token_values);
+        return;
+    }
+
+    // divide and conquer operates on owned digits
+    divide_and_conquer_convert(SmallVector<digit_type>(digits.begin(),
+                                                       digits.end()),
+                               count_radix_power_levels(digits.size()),
+                               0, token_values);
+}
+
+void
+TokenValuesConverter::stream_token_values(
+    DigitsView                 digits,
+    const TokenValuesConsumer &consume
+) const
+{
+    assert(!digits.empty());
+
+    if (bits_per_token > 0) {
+        bitwise_stream(digits, consume);
+        return;
+    }
+
+    std::string segment;
+
+    if (digits.size() <= DIVIDE_AND_CONQUER_THRESHOLD_MAGNITUDE) {
+        multiply_stream(digits, 0, segment, consume);
+        return;
+    }
+
+    // divide and conquer operates on owned digits
+    divide_and_conquer_stream(SmallVector<digit_type>(digits.begin(),
+                                                      digits.end()),
+                              count_radix_power_levels(digits.size()),
+                              0, segment, consume);
 }
 
+/**
+ * Slices the bits of @p digits, from least to most significant, directly into
+ * token values in linear time.
+ */
 void
-TokenValuesConverter::accumulate_digit(std::string &token_values,
-                                       digit_type   digit) const
+TokenValuesConverter::bitwise_convert(
+    DigitsView   digits,
+    std::string &token_values
+) const
 {
-    digit_accumulator_type carry = multiply_accumulate(token_values, digit);
+    const digit_accumulator_type token_mask = token_base - 1;
 
-    while (carry > 0) {
-        char next_token_value = static_cast<char>(carry % token_base);
-        carry /= token_base;
+    token_values.reserve(
+        ((digits.size() * DIGIT_TYPE_BITS) + bits_per_token - 1)
+        / bits_per_token
+    );
 
-        token_values.push_back(next_token_value);
+    digit_accumulator_type accumulator = 0;
+    unsigned int           count_bits  = 0;
+
+    for (digit_type digit : digits) {
+        accumulator |= static_cast<digit_accumulator_type>(digit) << count_bits;
+        count_bits  += DIGIT_TYPE_BITS;
+
+        for (; count_bits >= bits_per_token; count_bits -= bits_per_token) {
+            token_values.push_back(static_cast<char>(accumulator & token_mask));
+            accumulator >>= bits_per_token;
+        }
     }
+
+    if (accumulator > 0)
+        token_values.push_back(static_cast<char>(accumulator));
+
+    // strip the leading zeros sliced from the most significant digit, but
+    // present zero as a single token value
+    auto last_nonzero = token_values.find_last_not_of('\0');
+    token_values.resize(
+        (last_nonzero == std::string::npos) ? 1 : (last_nonzero + 1)
+    );
 }
 
-digit_accumulator_type
-TokenValuesConverter::multiply_accumulate(std::string            &token_values,
-                                          digit_accumulator_type  addend) const
+/**
+ * Slices the bits of @p digits into token values like bitwise_convert(), but
+ * from most to least significant, buffering at most BITWISE_SEGMENT_LENGTH
+ * token values at a time.
+ */
+void
+TokenValuesConverter::bitwise_stream(
+    DigitsView                 digits,
+    const TokenValuesConsumer &consume
+) const
 {
-    for (char &token_value : token_values) {
-        digit_accumulator_type accumulator = token_value;
+    const digit_type token_mask = token_base - 1;
+
+    std::size_t count_bits =
+        ((digits.size() - 1) * DIGIT_TYPE_BITS)
+      + static_cast<unsigned int>(std::bit_width(digits.back()));
+    // zero is presented as a single token value
+    std::size_t count_token_values =
+        std::max<std::size_t>((count_bits + bits_per_token - 1)
+                              / bits_per_token, 1);
+
+    char        segment[BITWISE_SEGMENT_LENGTH];
+    std::size_t segment_length = 0;
+
+    for (std::size_t index = count_token_values; index-- > 0;) {
+        std::size_t  bit_offset   = index * bits_per_token;
+        std::size_t  digit_offset = bit_offset / DIGIT_TYPE_BITS;
+        unsigned int shift        = bit_offset % DIGIT_TYPE_BITS;
 
-        accumulator <<= DIGIT_TYPE_BITS;
-        accumulator  += addend;
+        digit_type token_value = digits[digit_offset] >> shift;
 
-        token_value = static_cast<char>(accumulator % token_base);
-        addend      = (accumulator / token_base);
+        // a token may straddle the boundary between two digits
+        if (((shift + bits_per_token) > DIGIT_TYPE_BITS) &&
+            ((digit_offset + 1) < digits.size()))
+            token_value |=
+                digits[digit_offset + 1] << (DIGIT_TYPE_BITS - shift);
+
+        segment[segment_length++] = static_cast<char>(token_value & token_mask);
+
+        if (segment_length == BITWISE_SEGMENT_LENGTH) {
+            consume(segment, segment + segment_length);
+            segment_length = 0;
+        }
+    }
+
+    if (segment_length > 0)
+        consume(segment, segment + segment_length);
+}
+
+/**
+ * Counts the radix powers, `base^(k * 2^i)` for successive
+ * `i`, up to and including the first that spans more than half of
+ * @p count_digits.
+ */
+std::size_t
+TokenValuesConverter::count_radix_power_levels(
+    SmallVector<digit_type>::size_type count_digits
+) const
+{
+    auto base = static_cast<unsigned int>(token_base);
+
+    std::size_t level = 0;
+    while ((radix_power(base, level).size() * 2) <= count_digits)
+        ++level;
+
+    return level + 1;
+}
+
+/**
+ * Splits @p digits into `high * radix_power(base, count_levels - 1) + low`,
+ * then converts `low`, zero-padded to exactly the number of token values
+ * spanned by the radix power, followed by `high`, each in turn with the next
+ * smaller radix power.
+ */
+void
+TokenValuesConverter::divide_and_conquer_convert(
+    const SmallVector<digit_type> &digits,
+    std::size_t                    count_levels,
+    std::string::size_type         min_count_token_values,
+    std::string                   &token_values
+) const
+{
+    if ((count_levels == 0) ||
+        (digits.size() <= DIVIDE_AND_CONQUER_THRESHOLD_MAGNITUDE)) {
+        multiply_convert(digits, min_count_token_values, token_values);
+        return;
+    }
+
+    auto        level = count_levels - 1;
+    const auto &power = radix_power(static_cast<unsigned int>(token_base),
+                                    level);
+
+    if (digits < power) {
+        divide_and_conquer_convert(digits, level, min_count_token_values,
+                                   token_values);
+        return;
+    }
+
+    auto [high, low] = divide(digits, power);
+
+    std::string::size_type count_low_token_values =
+        static_cast<std::string::size_type>(token_chunk.count_tokens) << level;
+    std::string::size_type min_count_high_token_values =
+        (min_count_token_values > count_low_token_values)
+        ? (min_count_token_values - count_low_token_values)
+        : 0;
+
+    divide_and_conquer_convert(low, level, count_low_token_values,
+                               token_values);
+    divide_and_conquer_convert(high, level, min_count_high_token_values,
+                               token_values);
+}
+
+/**
+ * Splits @p digits like divide_and_conquer_convert(), but visits `high` before
+ * `low` so that the segments are produced most significant first.  Each half
+ * is released as soon as it has been streamed.
+ */
+void
+TokenValuesConverter::divide_and_conquer_stream(
+    const SmallVector<digit_type> &digits,
+    std::size_t                    count_levels,
+    std::string::size_type         min_count_token_values,
+    std::string                   &segment,
+    const TokenValuesConsumer     &consume
+) const
+{
+    if ((count_levels == 0) ||
+        (digits.size() <= DIVIDE_AND_CONQUER_THRESHOLD_MAGNITUDE)) {
+        multiply_stream(digits, min_count_token_values, segment, consume);
+        return;
+    }
+
+    auto        level = count_levels - 1;
+    const auto &power = radix_power(static_cast<unsigned int>(token_base),
+                                    level);
+
+    if (digits < power) {
+        divide_and_conquer_stream(digits, level, min_count_token_values,
+                                  segment, consume);
+        return;
+    }
+
+    auto [high, low] = divide(digits, power);
+
+    std::string::size_type count_low_token_values =
+        static_cast<std::string::size_type>(token_chunk.count_tokens) << level;
+    std::string::size_type min_count_high_token_values =
+        (min_count_token_values > count_low_token_values)
+        ? (min_count_token_values - count_low_token_values)
+        : 0;
+
+    divide_and_conquer_stream(high, level, min_count_high_token_values,
+                              segment, consume);
+    high = SmallVector<digit_type>();
+
+    divide_and_conquer_stream(low, level, count_low_token_values,
+                              segment, consume);
+}
+
+void
+TokenValuesConverter::multiply_stream(
+    DigitsView                 digits,
+    std::string::size_type     min_count_token_values,
+    std::string               &segment,
+    const TokenValuesConsumer &consume
+) const
+{
+    segment.clear();
+
+    multiply_convert(digits, min_count_token_values, segment);
+
+    std::reverse(segment.begin(), segment.end());
+
+    consume(segment.data(), segment.data() + segment.size());
+}
+
+/**
+ * Appends the token values of @p digits to @p token_values.  Each digit, from
+ * most to least significant, is multiplied into a little-endian sequence of
+ * TokenChunk values in base `base^k`, such that each division is shared by `k`
+ * token values.  The chunk values are then split into their token values,
+ * which are zero-padded to @p min_count_token_values.  The chunk values are
+ * accumulated in a per-thread scratch buffer, so that repeated conversions do
+ * not allocate once it has grown to fit, unless it has grown beyond
+ * RETAINED_CHUNK_VALUES_CAPACITY.
+ */
+void
+TokenValuesConverter::multiply_convert(
+    DigitsView              digits,
+    std::string::size_type  min_count_token_values,
+    std::string            &token_values
+) const
+{
+    thread_local SmallVector<digit_type> chunk_values;
+
+    chunk_values.clear();
+    chunk_values.reserve(digits.size() + 1);
+
+    for(auto cursor = digits.rbegin(); cursor != digits.rend(); ++cursor)
+        accumulate_digit(chunk_values, *cursor);
+
+    auto offset = token_values.size();
+
+    append_token_values(chunk_values, token_values);
+
+    if (chunk_values.capacity() > RETAINED_CHUNK_VALUES_CAPACITY)
+        chunk_values = SmallVector<digit_type>();
+
+    // zero is presented as a single token value
+    auto count_token_values =
+        std::max<std::string::size_type>(min_count_token_values, 1);
+
+    if ((token_values.size() - offset) < count_token_values)
+        token_values.resize(offset + count_token_values, '\0');
+}
+
+void
+TokenValuesConverter::accumulate_digit(SmallVector<digit_type> &chunk_values,
+                                       digit_type               digit) const
+{
+    for (digit_type carry = multiply_accumulate(chunk_values, digit);
+         carry > 0; ) {
+        auto [quotient, remainder] = radix_power_divisor.divide(carry);
+
+        chunk_values.push_back(remainder);
+        carry = quotient;
+    }
+}
+
+/**
+ * Each chunk value is less than `base^k`, so every two-digit accumulator
+ * divided by `base^k` yields a single-digit quotient, which is carried as the
+ * next addend.
+ */
+digit_type
+TokenValuesConverter::multiply_accumulate(
+    SmallVector<digit_type> &chunk_values,
+    digit_type               addend
+) const
+{
+    for (digit_type &chunk_value : chunk_values) {
+        auto [quotient, remainder] = radix_power_divisor.divide(chunk_value,
+                                                                addend);
+
+        chunk_value = remainder;
+        addend      = quotient;
     }
 
     return addend;
 }
 
+/**
+ * Splits every chunk value into exactly `k` token values, except for the most
+ * significant, whose leading zeros are omitted.
+ */
+void
+TokenValuesConverter::append_token_values(
+    const SmallVector<digit_type> &chunk_values,
+    std::string                   &token_values
+) const
+{
+    if (chunk_values.empty())
+        return;
+
+    auto most_significant = std::prev(chunk_values.end());
+
+    for (auto cursor = chunk_values.begin(); cursor != most_significant;
+         ++cursor) {
+        digit_type chunk_value = *cursor;
+
+        for (unsigned int i = 0; i < token_chunk.count_tokens; ++i)
+            chunk_value = append_token_value(chunk_value, token_values);
+    }
+
+    for (digit_type chunk_value = *most_significant; chunk_value > 0; )
+        chunk_value = append_token_value(chunk_value, token_values);
+}
+
+/**
+ * Appends `chunk_value % base` to @p token_values.
+ *
+ * @return `chunk_value / base`
+ */
+digit_type
+TokenValuesConverter::append_token_value(digit_type   chunk_value,
+                                         std::string &token_values) const
+{
+    auto [quotient, remainder] = token_base_divisor.divide(chunk_value);
+
+    token_values.push_back(static_cast<char>(remainder));
+
+    return quotient;
+}
+
 } // namespace
 
 
 void
-token_values_from_digits(const std::vector<digit_type> &digits,
-                         unsigned int                   base,
-                         std::string                   &token_values)
+token_values_from_digits(DigitsView    digits,
+                         unsigned int  base,
+                         std::string  &token_values)
 {
     TokenValuesConverter token_values_converter(base);
+    RadixPowersScope     radix_powers_scope;
 
     token_values_converter.convert_to_token_values(digits, token_values);
 }
 
+void
+stream_token_values_from_digits(DigitsView                 digits,
+                                unsigned int               base,
+                                const TokenValuesConsumer &consume)
+{
+    TokenValuesConverter token_values_converter(base);
+    RadixPowersScope     radix_powers_scope;
+
+    token_values_converter.stream_token_values(digits, consume);
+}
+
 } // namespace conversions
 } // namespace detail
 } // namespace tasty_int
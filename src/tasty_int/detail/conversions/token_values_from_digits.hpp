@@ -1,10 +1,11 @@
 #ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_STRING_FROM_DIGITS_HPP
 #define TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_STRING_FROM_DIGITS_HPP
 
+#include <functional>
 #include <string>
-#include <vector>
 
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/digits_view.hpp"
 
 
 namespace tasty_int {
@@ -19,13 +20,37 @@ namespace conversions {
  * @param[out] token_values @p digits converted to base @base
  *
  * @pre @p digits is not empty
- * @pre `(base >= 2) && (base <= (std::numeric_limits<char>::max() + 1))`
+ * @pre `(base >= 2) && (base <= 64)`
  * @pre @p token_values is empty
  */
 void
-token_values_from_digits(const std::vector<digit_type> &digits,
-                         unsigned int                   base,
-                         std::string                   &token_values);
+token_values_from_digits(DigitsView    digits,
+                         unsigned int  base,
+                         std::string  &token_values);
+
+/**
+ * A callable that receives a segment of token values, most significant first,
+ * as the range [first, last).  The segment may be modified in place but is
+ * only valid for the duration of the call.
+ */
+using TokenValuesConsumer = std::function<void (char *first, char *last)>;
+
+/**
+ * Converts @p digits to base @p base token values, passing them to @p consume
+ * most significant first in segments of bounded length, such that the token
+ * values are never materialized in full.
+ *
+ * @param[in] digits  a little-endian sequence of digits
+ * @param[in] base    the desired numeric base/radix of the output
+ * @param[in] consume the receiver of the segments of token values
+ *
+ * @pre @p digits is not empty
+ * @pre `(base >= 2) && (base <= 64)`
+ */
+void
+stream_token_values_from_digits(DigitsView                 digits,
+                                unsigned int               base,
+                                const TokenValuesConsumer &consume);
 
 } // namespace conversions
 } // namespace detail
@@ -0,0 +1,199 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_TOKEN_WORD_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_TOKEN_WORD_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace tasty_int {
+namespace detail {
+namespace conversions {
+
+/**
+ * A token word packs eight consecutive ASCII tokens (or token values) into a
+ * single 64-bit integer, with the first token in the least significant byte,
+ * so that they may be validated and converted together with SIMD-within-a-
+ * register arithmetic.
+ */
+typedef std::uint64_t TokenWord;
+
+/**
+ * The number of tokens packed into a TokenWord.
+ */
+constexpr std::size_t TOKENS_PER_WORD = sizeof(TokenWord);
+
+namespace token_word_detail {
+
+constexpr TokenWord LOW_BITS  = 0x0101010101010101;
+constexpr TokenWord HIGH_BITS = 0x8080808080808080;
+
+/**
+ * @brief Marks the bytes of @p word in the range [@p low, @p high].
+ *
+ * @param[in] word a TokenWord
+ * @param[in] low  the minimum byte value
+ * @param[in] high the maximum byte value
+ * @return a TokenWord with the high bit set in each byte of @p word in the
+ *     range [@p low, @p high] and all other bits cleared
+ *
+ * @pre all bytes of @p word are less than `0x80`
+ * @pre `low <= high < 0x80`
+ */
+inline TokenWord
+mark_bytes_between(TokenWord     word,
+                   unsigned char low,
+                   unsigned char high)
+{
+    TokenWord at_least_low = word + (LOW_BITS * (0x80 - low));
+    TokenWord above_high   = word + (LOW_BITS * (0x7F - high));
+
+    return at_least_low & ~above_high & HIGH_BITS;
+}
+
+} // namespace token_word_detail
+
+
+/**
+ * @brief Loads a TokenWord from @p tokens.
+ *
+ * @param[in] tokens the first of TOKENS_PER_WORD tokens
+ * @return the TokenWord packing @p tokens
+ */
+inline TokenWord
+load_token_word(const char *tokens)
+{
+    TokenWord word = 0;
+    for (std::size_t i = 0; i < TOKENS_PER_WORD; ++i)
+        word |= static_cast<TokenWord>(static_cast<unsigned char>(tokens[i]))
+             << (i * 8);
+
+    return word;
+}
+
+/**
+ * @brief Stores @p word to @p tokens.
+ *
+ * @param[in]  word   a TokenWord
+ * @param[out] tokens the first of TOKENS_PER_WORD destination tokens
+ */
+inline void
+store_token_word(TokenWord  word,
+                 char      *tokens)
+{
+    for (std::size_t i = 0; i < TOKENS_PER_WORD; ++i)
+        tokens[i] = static_cast<char>((word >> (i * 8)) & 0xFF);
+}
+
+/**
+ * @brief Checks if @p word is made of decimal tokens only.
+ *
+ * @param[in] word a TokenWord
+ * @return true if every token of @p word is in `[0-9]`
+ */
+inline bool
+is_decimal_token_word(TokenWord word)
+{
+    using token_word_detail::HIGH_BITS;
+    using token_word_detail::mark_bytes_between;
+
+    return ((word & HIGH_BITS) == 0)
+        && (mark_bytes_between(word, '0', '9') == HIGH_BITS);
+}
+
+/**
+ * @brief Converts a TokenWord of decimal tokens to its value.
+ *
+ * @param[in] word a TokenWord of decimal tokens, most significant first
+ * @return the value of @p word
+ *
+ * @pre `is_decimal_token_word(word)`
+ */
+inline std::uint32_t
+value_from_decimal_token_word(TokenWord word)
+{
+    word -= token_word_detail::LOW_BITS * '0';
+
+    // combine adjacent byte values, then pairs of those, then quads
+    word = (word * 10) + (word >> 8);
+    word = (((word         & 0x000000FF000000FF) * (100 + (1000000ULL << 32)))
+          + (((word >> 16) & 0x000000FF000000FF) * (1   + (10000ULL   << 32))))
+         >> 32;
+
+    return static_cast<std::uint32_t>(word);
+}
+
+/**
+ * @brief Checks if @p word is made of hexadecimal tokens only.
+ *
+ * @param[in] word a TokenWord
+ * @return true if every token of @p word is in `[0-9A-Fa-f]`
+ */
+inline bool
+is_hexadecimal_token_word(TokenWord word)
+{
+    using token_word_detail::LOW_BITS;
+    using token_word_detail::HIGH_BITS;
+    using token_word_detail::mark_bytes_between;
+
+    if ((word & HIGH_BITS) != 0)
+        return false;
+
+    TokenWord lowercase_word = word | (LOW_BITS * 0x20);
+
+    return (  mark_bytes_between(word,           '0', '9')
+            | mark_bytes_between(lowercase_word, 'a', 'f')) == HIGH_BITS;
+}
+
+/**
+ * @brief Converts a TokenWord of hexadecimal tokens to its value.
+ *
+ * @param[in] word a TokenWord of hexadecimal tokens, most significant first
+ * @return the value of @p word
+ *
+ * @pre `is_hexadecimal_token_word(word)`
+ */
+inline std::uint32_t
+value_from_hexadecimal_token_word(TokenWord word)
+{
+    using token_word_detail::LOW_BITS;
+    using token_word_detail::mark_bytes_between;
+
+    TokenWord letters = mark_bytes_between(word | (LOW_BITS * 0x20), 'a', 'f');
+
+    // '0' -> 0x0 ... '9' -> 0x9, 'a'/'A' -> 0x1 + 9 ... 'f'/'F' -> 0x6 + 9
+    word = (word & (LOW_BITS * 0x0F)) + ((letters >> 7) * 9);
+
+    // combine adjacent nibbles, then pairs of those, then quads
+    word = ((word        & 0x00FF00FF00FF00FF) <<  4)
+         | ((word >>  8) & 0x00FF00FF00FF00FF);
+    word = ((word        & 0x0000FFFF0000FFFF) <<  8)
+         | ((word >> 16) & 0x0000FFFF0000FFFF);
+    word = ((word        & 0x00000000FFFFFFFF) << 16)
+         |  (word >> 32);
+
+    return static_cast<std::uint32_t>(word);
+}
+
+/**
+ * @brief Converts a TokenWord of Base36 values to their ASCII tokens.
+ *
+ * @param[in] values a TokenWord of values in the range [0, 36)
+ * @return the TokenWord of the ASCII tokens associated with @p values
+ */
+inline TokenWord
+base_36_token_word_from_values(TokenWord values)
+{
+    using token_word_detail::LOW_BITS;
+    using token_word_detail::HIGH_BITS;
+
+    // high bit is set in each byte of value >= 10
+    TokenWord letters = (values + (LOW_BITS * (0x80 - 10))) & HIGH_BITS;
+
+    return values + (LOW_BITS * '0') + ((letters >> 7) * ('a' - '0' - 10));
+}
+
+} // namespace conversions
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_CONVERSIONS_TOKEN_WORD_HPP
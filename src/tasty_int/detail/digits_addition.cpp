@@ -20,8 +20,8 @@ namespace detail {
 namespace {
 
 void
-pad_augend(std::vector<digit_type>::size_type  addend_size,
-           std::vector<digit_type>            &augend)
+pad_augend(SmallVector<digit_type>::size_type  addend_size,
+           SmallVector<digit_type>            &augend)
 {
     if (addend_size > augend.size()) {
         augend.reserve(addend_size + 1); // room for carry
@@ -29,36 +29,36 @@ pad_augend(std::vector<digit_type>::size_type  addend_size,
     }
 }
 
-std::vector<digit_type>
-allocate_augend(std::vector<digit_type>::size_type larger_addend_size)
+SmallVector<digit_type>
+allocate_augend(SmallVector<digit_type>::size_type larger_addend_size)
 {
-    std::vector<digit_type> augend;
+    SmallVector<digit_type> augend;
 
     augend.reserve(larger_addend_size + 1); // up to one extra carry digit
 
     return augend;
 }
 
-std::vector<digit_type>
-initialize_augend(const std::vector<digit_type>      &addend_digits,
-                  std::vector<digit_type>::size_type  larger_addend_size)
+SmallVector<digit_type>
+initialize_augend(const SmallVector<digit_type>      &addend_digits,
+                  SmallVector<digit_type>::size_type  larger_addend_size)
 {
-    std::vector<digit_type> augend = allocate_augend(larger_addend_size);
+    SmallVector<digit_type> augend = allocate_augend(larger_addend_size);
 
     augend.assign(addend_digits.begin(), addend_digits.end());
 
     return augend;
 }
 
-std::vector<digit_type>
-initialize_augend(const std::vector<digit_type> &addend_digits)
+SmallVector<digit_type>
+initialize_augend(const SmallVector<digit_type> &addend_digits)
 {
     return initialize_augend(addend_digits, addend_digits.size());
 }
 
-std::vector<digit_type>
+SmallVector<digit_type>
 initialize_augend_from_addends(
-    const std::vector<digit_type> &addend_digits,
+    const SmallVector<digit_type> &addend_digits,
     long double                    floating_point_addend
 )
 {
@@ -74,15 +74,15 @@ initialize_augend_from_addends(
 
 void
 append_carry_if_nonzero(digit_accumulator_type   carry,
-                        std::vector<digit_type>& augend)
+                        SmallVector<digit_type>& augend)
 {
     if (carry > 0)
         augend.emplace_back(static_cast<digit_type>(carry));
 }
 
 void
-add_in_place(const std::vector<digit_type> &addend,
-             std::vector<digit_type>       &augend)
+add_in_place(const SmallVector<digit_type> &addend,
+             SmallVector<digit_type>       &augend)
 {
     auto [carry, augend_cursor] = add_into(addend, augend);
 
@@ -94,7 +94,7 @@ add_in_place(const std::vector<digit_type> &addend,
 digit_accumulator_type
 fixed_add(digit_accumulator_type   addend_low,
           digit_accumulator_type   addend_high,
-          std::vector<digit_type> &augend)
+          SmallVector<digit_type> &augend)
 {
     auto augend_cursor = augend.begin();
 
@@ -106,7 +106,7 @@ fixed_add(digit_accumulator_type   addend_low,
 void
 add_in_place(digit_accumulator_type   addend_low,
              digit_accumulator_type   addend_high,
-             std::vector<digit_type> &augend)
+             SmallVector<digit_type> &augend)
 {
     auto carry = fixed_add(addend_low, addend_high, augend);
 
@@ -115,7 +115,7 @@ add_in_place(digit_accumulator_type   addend_low,
 
 digit_accumulator_type
 fixed_add(long double              addend,
-          std::vector<digit_type> &augend)
+          SmallVector<digit_type> &augend)
 {
     FloatingPointDigitsIterator addend_cursor(addend);
     digit_accumulator_type carry = 0;
@@ -135,11 +135,12 @@ fixed_add(long double              addend,
 
 void
 add_in_place(long double              addend,
-             std::vector<digit_type> &augend)
+             SmallVector<digit_type> &augend)
 {
     auto carry = fixed_add(addend, augend);
 
-    trim_trailing_zero(augend);
+    if (carry == 0)
+        trim_trailing_zero(augend);
 
     append_carry_if_nonzero(carry, augend);
 }
@@ -147,9 +148,9 @@ add_in_place(long double              addend,
 } // namespace
 
 
-std::vector<digit_type> &
-operator+=(std::vector<digit_type>       &lhs,
-           const std::vector<digit_type> &rhs)
+SmallVector<digit_type> &
+operator+=(SmallVector<digit_type>       &lhs,
+           const SmallVector<digit_type> &rhs)
 {
     assert(!lhs.empty());
     assert(!rhs.empty());
@@ -161,8 +162,8 @@ operator+=(std::vector<digit_type>       &lhs,
     return lhs;
 }
 
-std::vector<digit_type> &
-operator+=(std::vector<digit_type> &lhs,
+SmallVector<digit_type> &
+operator+=(SmallVector<digit_type> &lhs,
            std::uintmax_t           rhs)
 {
     assert(!lhs.empty());
@@ -176,8 +177,8 @@ operator+=(std::vector<digit_type> &lhs,
     return lhs;
 }
 
-std::vector<digit_type> &
-operator+=(std::vector<digit_type> &lhs,
+SmallVector<digit_type> &
+operator+=(SmallVector<digit_type> &lhs,
            long double              rhs)
 {
     assert(!lhs.empty());
@@ -192,9 +193,9 @@ operator+=(std::vector<digit_type> &lhs,
     return lhs;
 }
 
-std::vector<digit_type>
-operator+(const std::vector<digit_type> &lhs,
-          const std::vector<digit_type> &rhs)
+SmallVector<digit_type>
+operator+(const SmallVector<digit_type> &lhs,
+          const SmallVector<digit_type> &rhs)
 {
     assert(!lhs.empty());
     assert(!rhs.empty());
@@ -208,8 +209,8 @@ operator+(const std::vector<digit_type> &lhs,
     return augend;
 }
 
-std::vector<digit_type>
-operator+(const std::vector<digit_type> &lhs,
+SmallVector<digit_type>
+operator+(const SmallVector<digit_type> &lhs,
           std::uintmax_t                 rhs)
 {
     assert(!lhs.empty());
@@ -221,15 +222,15 @@ operator+(const std::vector<digit_type> &lhs,
     return augend;
 }
 
-std::vector<digit_type>
+SmallVector<digit_type>
 operator+(std::uintmax_t                 lhs,
-          const std::vector<digit_type> &rhs)
+          const SmallVector<digit_type> &rhs)
 {
     return rhs + lhs;
 }
 
-std::vector<digit_type>
-operator+(const std::vector<digit_type> &lhs,
+SmallVector<digit_type>
+operator+(const SmallVector<digit_type> &lhs,
           long double                    rhs)
 {
     assert(!lhs.empty());
@@ -243,16 +244,16 @@ operator+(const std::vector<digit_type> &lhs,
     return augend;
 }
 
-std::vector<digit_type>
+SmallVector<digit_type>
 operator+(long double                    lhs,
-          const std::vector<digit_type> &rhs)
+          const SmallVector<digit_type> &rhs)
 {
     return rhs + lhs;
 }
 
-std::pair<digit_accumulator_type, std::vector<digit_type>::iterator>
-add_into(const std::vector<digit_type> &addend,
-         std::vector<digit_type>       &augend)
+std::pair<digit_accumulator_type, SmallVector<digit_type>::iterator>
+add_into(const SmallVector<digit_type> &addend,
+         SmallVector<digit_type>       &augend)
 {
     assert(augend.size() >= addend.size());
 
@@ -272,8 +273,8 @@ add_into(const std::vector<digit_type> &addend,
 
 digit_accumulator_type
 propagate_carry(digit_accumulator_type                  carry,
-                std::vector<digit_type>::iterator       augend_cursor,
-                std::vector<digit_type>::const_iterator augend_end)
+                SmallVector<digit_type>::iterator       augend_cursor,
+                SmallVector<digit_type>::const_iterator augend_end)
 {
     while ((carry > 0) && (augend_cursor != augend_end)) {
         carry = add_at(carry, augend_cursor);
@@ -286,7 +287,7 @@ propagate_carry(digit_accumulator_type                  carry,
 
 digit_accumulator_type
 add_at(digit_accumulator_type            addend,
-       std::vector<digit_type>::iterator augend_cursor)
+       SmallVector<digit_type>::iterator augend_cursor)
 {
     assert((std::numeric_limits<digit_accumulator_type>::max() - addend) >=
            *augend_cursor);
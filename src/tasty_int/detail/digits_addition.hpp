@@ -4,9 +4,9 @@
 #include <cstdint>
 
 #include <utility>
-#include <vector>
 
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 
 
 namespace tasty_int {
@@ -15,19 +15,19 @@ namespace detail {
 /**
  * @defgroup DigitsAdditionOperators Digits Addition Operators
  *
- * These operations operate on little-endian `std::vector`s of `digit_type`.
+ * These operations operate on little-endian `SmallVector`s of `digit_type`.
  *
  * @pre input digits vectors must be non-empty
  * @pre input digits may have no leading zeros
  * @pre every element of input digits vectors must be `<= DIGIT_TYPE_MAX`
  */
 /// @{
-std::vector<digit_type> &
-operator+=(std::vector<digit_type>       &lhs,
-           const std::vector<digit_type> &rhs);
+SmallVector<digit_type> &
+operator+=(SmallVector<digit_type>       &lhs,
+           const SmallVector<digit_type> &rhs);
 
-std::vector<digit_type> &
-operator+=(std::vector<digit_type> &lhs,
+SmallVector<digit_type> &
+operator+=(SmallVector<digit_type> &lhs,
            std::uintmax_t           rhs);
 
 /**
@@ -43,31 +43,31 @@ operator+=(std::vector<digit_type> &lhs,
  *
  * /@pre `rhs >= 0.0`
  */
-std::vector<digit_type> &
-operator+=(std::vector<digit_type> &lhs,
+SmallVector<digit_type> &
+operator+=(SmallVector<digit_type> &lhs,
            long double              rhs);
 
-std::vector<digit_type>
-operator+(const std::vector<digit_type> &lhs,
-          const std::vector<digit_type> &rhs);
+SmallVector<digit_type>
+operator+(const SmallVector<digit_type> &lhs,
+          const SmallVector<digit_type> &rhs);
 
-std::vector<digit_type>
-operator+(const std::vector<digit_type> &lhs,
+SmallVector<digit_type>
+operator+(const SmallVector<digit_type> &lhs,
           std::uintmax_t                 rhs);
 
-std::vector<digit_type>
+SmallVector<digit_type>
 operator+(std::uintmax_t                 lhs,
-          const std::vector<digit_type> &rhs);
+          const SmallVector<digit_type> &rhs);
 
 /// @ingroup DigitsAdditionFloatingPointOverloads
-std::vector<digit_type>
-operator+(const std::vector<digit_type> &lhs,
+SmallVector<digit_type>
+operator+(const SmallVector<digit_type> &lhs,
           long double                    rhs);
 
 /// @ingroup DigitsAdditionFloatingPointOverloads
-std::vector<digit_type>
+SmallVector<digit_type>
 operator+(long double                    lhs,
-          const std::vector<digit_type> &rhs);
+          const SmallVector<digit_type> &rhs);
 /// @}
 
 /**
@@ -89,9 +89,9 @@ operator+(long double                    lhs,
  *
  * @pre `augend.size() >= addend.size()`
  */
-std::pair<digit_accumulator_type, std::vector<digit_type>::iterator>
-add_into(const std::vector<digit_type> &addend,
-         std::vector<digit_type>       &augend);
+std::pair<digit_accumulator_type, SmallVector<digit_type>::iterator>
+add_into(const SmallVector<digit_type> &addend,
+         SmallVector<digit_type>       &augend);
 
 /**
  * @brief Perform a carry operation.
@@ -108,8 +108,8 @@ add_into(const std::vector<digit_type> &addend,
  */
 digit_accumulator_type
 propagate_carry(digit_accumulator_type                  carry,
-                std::vector<digit_type>::iterator       augend_cursor,
-                std::vector<digit_type>::const_iterator augend_end);
+                SmallVector<digit_type>::iterator       augend_cursor,
+                SmallVector<digit_type>::const_iterator augend_end);
 
 /**
  * @brief Add into a single digit.
@@ -123,7 +123,7 @@ propagate_carry(digit_accumulator_type                  carry,
  */
 digit_accumulator_type
 add_at(digit_accumulator_type            addend,
-       std::vector<digit_type>::iterator augend_cursor);
+       SmallVector<digit_type>::iterator augend_cursor);
 /// @}
 
 } // namespace detail
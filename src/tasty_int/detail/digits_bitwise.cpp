@@ -15,8 +15,8 @@ namespace detail {
 namespace {
 
 void
-left_shift_nonzero_in_place(std::vector<digit_type>::size_type digit_offset,
-                            std::vector<digit_type> &digits)
+left_shift_nonzero_in_place(SmallVector<digit_type>::size_type digit_offset,
+                            SmallVector<digit_type> &digits)
 {
     auto initial_size = digits.size();
     digits.resize(initial_size + digit_offset);
@@ -28,8 +28,8 @@ left_shift_nonzero_in_place(std::vector<digit_type>::size_type digit_offset,
                      digits.rbegin());
 }
 
-std::vector<digit_type>
-allocate_nonzero_left_shift_result(const std::vector<digit_type> &digits,
+SmallVector<digit_type>
+allocate_nonzero_left_shift_result(const SmallVector<digit_type> &digits,
                                    DigitsShiftOffset              offset)
 {
     auto have_leading_digit_overflow =
@@ -40,14 +40,14 @@ allocate_nonzero_left_shift_result(const std::vector<digit_type> &digits,
 
     auto result_size = digits.size() + shift_offset;
 
-    std::vector<digit_type> result;
+    SmallVector<digit_type> result;
     result.reserve(result_size);
 
     return result;
 }
 
-std::vector<digit_type>
-left_shift_nonzero(const std::vector<digit_type> &digits,
+SmallVector<digit_type>
+left_shift_nonzero(const SmallVector<digit_type> &digits,
                    DigitsShiftOffset              offset)
 {
     auto result = allocate_nonzero_left_shift_result(digits, offset);
@@ -73,9 +73,9 @@ left_shift_nonzero(const std::vector<digit_type> &digits,
     return result;
 }
 
-std::vector<digit_type>::size_type
+SmallVector<digit_type>::size_type
 right_shift_size(DigitsShiftOffset              offset,
-                 const std::vector<digit_type> &digits)
+                 const SmallVector<digit_type> &digits)
 {
     auto leading_digit_bit_size =
         DIGIT_TYPE_BITS - count_leading_zero_bits_from_digit(digits.back());
@@ -85,17 +85,17 @@ right_shift_size(DigitsShiftOffset              offset,
 }
 
 void
-make_zero(std::vector<digit_type> &digits)
+make_zero(SmallVector<digit_type> &digits)
 {
     digits.front() = 0;
     digits.resize(1);
 }
 
-std::vector<digit_type>::const_iterator
+SmallVector<digit_type>::const_iterator
 right_shift_no_underflow_in_place(
     DigitsShiftOffset                       offset,
-    std::vector<digit_type>::iterator       dst_cursor,
-    std::vector<digit_type>::const_iterator end
+    SmallVector<digit_type>::iterator       dst_cursor,
+    SmallVector<digit_type>::const_iterator end
 )
 {
     assert((dst_cursor + offset.digits) < end);
@@ -128,7 +128,7 @@ right_shift_no_underflow_in_place(
 
 void
 right_shift_no_underflow_in_place(DigitsShiftOffset        offset,
-                                  std::vector<digit_type> &digits)
+                                  SmallVector<digit_type> &digits)
 {
     auto lead_digit_cursor = right_shift_no_underflow_in_place(offset,
                                                                digits.begin(),
@@ -143,7 +143,7 @@ right_shift_no_underflow_in_place(DigitsShiftOffset        offset,
 
 void
 right_shift_nonzero_in_place(DigitsShiftOffset        offset,
-                             std::vector<digit_type> &digits)
+                             SmallVector<digit_type> &digits)
 {
     if (right_shift_size(offset, digits) < digits.size())
         right_shift_no_underflow_in_place(offset, digits);
@@ -162,9 +162,9 @@ count_leading_zero_bits_from_digit(digit_type digit)
     return count_leading_zero_bits(digit) - BIT_DIFFERENCE;
 }
 
-std::vector<digit_type> &
-operator<<=(std::vector<digit_type>            &digits,
-            std::vector<digit_type>::size_type  digit_offset)
+SmallVector<digit_type> &
+operator<<=(SmallVector<digit_type>            &digits,
+            SmallVector<digit_type>::size_type  digit_offset)
 {
     assert(!digits.empty());
 
@@ -174,8 +174,8 @@ operator<<=(std::vector<digit_type>            &digits,
     return digits;
 }
 
-std::vector<digit_type>
-operator<<(const std::vector<digit_type> &digits,
+SmallVector<digit_type>
+operator<<(const SmallVector<digit_type> &digits,
            DigitsShiftOffset              offset)
 {
     assert(offset.bits <= DIGIT_TYPE_BITS);
@@ -186,8 +186,8 @@ operator<<(const std::vector<digit_type> &digits,
          : left_shift_nonzero(digits, offset);
 }
 
-std::vector<digit_type> &
-operator>>=(std::vector<digit_type> &digits,
+SmallVector<digit_type> &
+operator>>=(SmallVector<digit_type> &digits,
             DigitsShiftOffset        offset)
 {
     assert(offset.bits <= DIGIT_TYPE_BITS);
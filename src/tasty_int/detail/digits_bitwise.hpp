@@ -1,9 +1,8 @@
 #ifndef TASTY_INT_TASTY_INT_DETAIL_DIGITS_BITWISE_HPP
 #define TASTY_INT_TASTY_INT_DETAIL_DIGITS_BITWISE_HPP
 
-#include <vector>
-
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 
 
 namespace tasty_int {
@@ -16,7 +15,7 @@ namespace detail {
 struct DigitsShiftOffset
 {
     /// number of digits
-    std::vector<digit_type>::size_type digits;
+    SmallVector<digit_type>::size_type digits;
     /// number of leftover bits (require < DIGIT_TYPE_BITS)
     unsigned int                       bits;
 }; // struct DigitsShiftOffset
@@ -36,9 +35,9 @@ count_leading_zero_bits_from_digit(digit_type digit);
  * @param[in] digit_offset the desired number of digits to be shifted
  * @return a reference to @p digits
  */
-std::vector<digit_type> &
-operator<<=(std::vector<digit_type>            &digits,
-            std::vector<digit_type>::size_type  digit_offset);
+SmallVector<digit_type> &
+operator<<=(SmallVector<digit_type>            &digits,
+            SmallVector<digit_type>::size_type  digit_offset);
 
 /**
  * @brief Left shift @p digits by @p offset.
@@ -52,8 +51,8 @@ operator<<=(std::vector<digit_type>            &digits,
  *
  * @pre `offset.bits < DIGIT_TYPE_BITS`
  */
-std::vector<digit_type>
-operator<<(const std::vector<digit_type> &digits,
+SmallVector<digit_type>
+operator<<(const SmallVector<digit_type> &digits,
            DigitsShiftOffset              offset);
 
 /**
@@ -68,8 +67,8 @@ operator<<(const std::vector<digit_type> &digits,
  *
  * @pre `offset.bits < DIGIT_TYPE_BITS`
  */
-std::vector<digit_type> &
-operator>>=(std::vector<digit_type> &digits,
+SmallVector<digit_type> &
+operator>>=(SmallVector<digit_type> &digits,
             DigitsShiftOffset        offset);
 
 } // namespace detail
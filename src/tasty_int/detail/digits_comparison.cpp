@@ -14,7 +14,7 @@ namespace detail {
 namespace {
 
 bool
-have_unequal_high_digits(const std::vector<digit_type> &lhs,
+have_unequal_high_digits(const SmallVector<digit_type> &lhs,
                          IntegralDigitsView             rhs_view)
 {
     return (lhs.size() == DIGITS_PER_DIGIT_ACCUMULATOR)
@@ -24,7 +24,7 @@ have_unequal_high_digits(const std::vector<digit_type> &lhs,
 template<template <typename> typename Compare>
 std::pair<bool, digit_type>
 sequence_inequality_common_compare(
-    const std::vector<digit_type> &lhs,
+    const SmallVector<digit_type> &lhs,
     long double                    rhs,
     bool                           equal_comparison
 )
@@ -51,7 +51,7 @@ sequence_inequality_common_compare(
 
 template<template <typename> typename Compare>
 bool
-sequence_inequality_compare(const std::vector<digit_type> &lhs,
+sequence_inequality_compare(const SmallVector<digit_type> &lhs,
                             long double                    rhs,
                             bool                           equal_comparison)
 {
@@ -68,10 +68,10 @@ template<template <typename> typename Compare>
 struct StrictSequenceInequality
 {
     bool
-    operator()(std::vector<digit_type>::const_reverse_iterator lhs_rbegin,
-               std::vector<digit_type>::const_reverse_iterator lhs_rend,
-               std::vector<digit_type>::const_reverse_iterator rhs_rbegin,
-               std::vector<digit_type>::const_reverse_iterator rhs_rend)
+    operator()(SmallVector<digit_type>::const_reverse_iterator lhs_rbegin,
+               SmallVector<digit_type>::const_reverse_iterator lhs_rend,
+               SmallVector<digit_type>::const_reverse_iterator rhs_rbegin,
+               SmallVector<digit_type>::const_reverse_iterator rhs_rend)
     {
         return std::lexicographical_compare(lhs_rbegin, lhs_rend,
                                             rhs_rbegin, rhs_rend,
@@ -79,15 +79,15 @@ struct StrictSequenceInequality
     }
 
     bool
-    operator()(const std::vector<digit_type> &lhs,
-               const std::vector<digit_type> &rhs)
+    operator()(const SmallVector<digit_type> &lhs,
+               const SmallVector<digit_type> &rhs)
     {
         return operator()(lhs.rbegin(), lhs.rend(),
                           rhs.rbegin(), rhs.rend());
     }
 
     bool
-    operator()(const std::vector<digit_type> &lhs,
+    operator()(const SmallVector<digit_type> &lhs,
                IntegralDigitsView             rhs_view)
     {
         if (have_unequal_high_digits(lhs, rhs_view))
@@ -97,7 +97,7 @@ struct StrictSequenceInequality
     }
 
     bool
-    operator()(const std::vector<digit_type> &lhs,
+    operator()(const SmallVector<digit_type> &lhs,
                long double                    rhs)
     {
         bool equal_comparison = false;
@@ -110,8 +110,8 @@ template<template <typename> typename Compare>
 struct NonStrictSequenceInequality
 {
     bool
-    operator()(const std::vector<digit_type> &lhs,
-               const std::vector<digit_type> &rhs)
+    operator()(const SmallVector<digit_type> &lhs,
+               const SmallVector<digit_type> &rhs)
     {
         auto mismatch = std::mismatch(lhs.rbegin(), lhs.rend(),
                                       rhs.rbegin());
@@ -121,7 +121,7 @@ struct NonStrictSequenceInequality
     }
 
     bool
-    operator()(const std::vector<digit_type> &lhs,
+    operator()(const SmallVector<digit_type> &lhs,
                IntegralDigitsView             rhs_view)
     {
         if (have_unequal_high_digits(lhs, rhs_view))
@@ -132,7 +132,7 @@ struct NonStrictSequenceInequality
     }
 
     bool
-    operator()(const std::vector<digit_type> &lhs,
+    operator()(const SmallVector<digit_type> &lhs,
                long double                    rhs)
     {
         bool equal_comparison = true;
@@ -144,15 +144,15 @@ struct NonStrictSequenceInequality
 template<template <typename> typename Compare,
          template <template <typename> typename> typename SequenceCompare>
 bool
-have_inequality(std::vector<digit_type>::const_iterator lhs_begin,
-                std::vector<digit_type>::const_iterator lhs_end,
-                std::vector<digit_type>::const_iterator rhs_begin,
-                std::vector<digit_type>::const_iterator rhs_end)
+have_inequality(SmallVector<digit_type>::const_iterator lhs_begin,
+                SmallVector<digit_type>::const_iterator lhs_end,
+                SmallVector<digit_type>::const_iterator rhs_begin,
+                SmallVector<digit_type>::const_iterator rhs_end)
 {
     auto lhs_size = lhs_end - lhs_begin;
     auto rhs_size = rhs_end - rhs_begin;
 
-    return Compare<std::vector<digit_type>::size_type>{}(lhs_size, rhs_size)
+    return Compare<SmallVector<digit_type>::size_type>{}(lhs_size, rhs_size)
         || ((lhs_size == rhs_size) &&
             SequenceCompare<Compare>{}(std::make_reverse_iterator(lhs_end),
                                        std::make_reverse_iterator(lhs_begin),
@@ -163,10 +163,10 @@ have_inequality(std::vector<digit_type>::const_iterator lhs_begin,
 template<template <typename> typename Compare,
          template <template <typename> typename> typename SequenceCompare>
 bool
-have_inequality(const std::vector<digit_type> &lhs,
-                const std::vector<digit_type> &rhs)
+have_inequality(const SmallVector<digit_type> &lhs,
+                const SmallVector<digit_type> &rhs)
 {
-    return Compare<std::vector<digit_type>::size_type>{}(lhs.size(), rhs.size())
+    return Compare<SmallVector<digit_type>::size_type>{}(lhs.size(), rhs.size())
         || ((lhs.size() == rhs.size()) &&
             SequenceCompare<Compare>{}(lhs, rhs));
 }
@@ -174,12 +174,12 @@ have_inequality(const std::vector<digit_type> &lhs,
 template<template <typename> typename Compare,
          template <template <typename> typename> typename SequenceCompare>
 bool
-have_inequality(const std::vector<digit_type> &lhs,
+have_inequality(const SmallVector<digit_type> &lhs,
                 std::uintmax_t                 rhs)
 {
     IntegralDigitsView rhs_view(rhs);
 
-    return Compare<std::vector<digit_type>::size_type>{}(lhs.size(),
+    return Compare<SmallVector<digit_type>::size_type>{}(lhs.size(),
                                                          rhs_view.digits_size())
         || ((lhs.size() == rhs_view.digits_size()) &&
             SequenceCompare<Compare>{}(lhs, rhs_view));
@@ -188,7 +188,7 @@ have_inequality(const std::vector<digit_type> &lhs,
 template<template <typename> typename Compare,
          template <template <typename> typename> typename SequenceCompare>
 bool
-have_inequality(const std::vector<digit_type> &lhs,
+have_inequality(const SmallVector<digit_type> &lhs,
                 long double                    rhs)
 {
     std::size_t rhs_max_digits =
@@ -205,7 +205,7 @@ have_inequality(const std::vector<digit_type> &lhs,
 
 template<typename RhsType>
 bool
-less_than(const std::vector<digit_type> &lhs,
+less_than(const SmallVector<digit_type> &lhs,
           RhsType                        rhs)
 {
     return have_inequality<std::less, StrictSequenceInequality>(lhs, rhs);
@@ -213,7 +213,7 @@ less_than(const std::vector<digit_type> &lhs,
 
 template<typename RhsType>
 bool
-greater_than(const std::vector<digit_type> &lhs,
+greater_than(const SmallVector<digit_type> &lhs,
              RhsType                        rhs)
 {
     return have_inequality<std::greater, StrictSequenceInequality>(lhs, rhs);
@@ -221,7 +221,7 @@ greater_than(const std::vector<digit_type> &lhs,
 
 template<typename RhsType>
 bool
-less_than_or_equal_to(const std::vector<digit_type> &lhs,
+less_than_or_equal_to(const SmallVector<digit_type> &lhs,
                       RhsType                        rhs)
 {
     return have_inequality<std::less, NonStrictSequenceInequality>(lhs, rhs);
@@ -229,7 +229,7 @@ less_than_or_equal_to(const std::vector<digit_type> &lhs,
 
 template<typename RhsType>
 bool
-greater_than_or_equal_to(const std::vector<digit_type> &lhs,
+greater_than_or_equal_to(const SmallVector<digit_type> &lhs,
                          RhsType                        rhs)
 {
     return have_inequality<std::greater, NonStrictSequenceInequality>(lhs, rhs);
@@ -239,14 +239,7 @@ greater_than_or_equal_to(const std::vector<digit_type> &lhs,
 
 
 bool
-operator==(const std::vector<digit_type> &lhs,
-           const std::vector<digit_type> &rhs)
-{
-    return std::operator==(lhs, rhs);
-}
-
-bool
-operator==(const std::vector<digit_type> &lhs,
+operator==(const SmallVector<digit_type> &lhs,
            std::uintmax_t                 rhs)
 {
     IntegralDigitsView rhs_view(rhs);
@@ -259,39 +252,39 @@ operator==(const std::vector<digit_type> &lhs,
 
 bool
 operator==(std::uintmax_t                 lhs,
-           const std::vector<digit_type> &rhs)
+           const SmallVector<digit_type> &rhs)
 {
     return rhs == lhs;
 }
 
 bool
-operator==(const std::vector<digit_type> &lhs,
+operator==(const SmallVector<digit_type> &lhs,
            long double                    rhs)
 {
     auto mismatch = std::mismatch(lhs.begin(), lhs.end(),
                                   FloatingPointDigitsIterator(rhs));
 
     return (mismatch.first == lhs.end())
-        && (mismatch.second.remaining_value() < 1.0L);
+        && !mismatch.second.has_remaining_digits();
 }
 
 bool
 operator==(long double                    lhs,
-           const std::vector<digit_type> &rhs)
+           const SmallVector<digit_type> &rhs)
 {
     return rhs == lhs;
 }
 
 
 bool
-operator!=(const std::vector<digit_type> &lhs,
-           const std::vector<digit_type> &rhs)
+operator!=(const SmallVector<digit_type> &lhs,
+           const SmallVector<digit_type> &rhs)
 {
     return !(lhs == rhs);
 }
 
 bool
-operator!=(const std::vector<digit_type> &lhs,
+operator!=(const SmallVector<digit_type> &lhs,
            std::uintmax_t                 rhs)
 {
     return !(lhs == rhs);
@@ -299,13 +292,13 @@ operator!=(const std::vector<digit_type> &lhs,
 
 bool
 operator!=(std::uintmax_t                 lhs,
-           const std::vector<digit_type> &rhs)
+           const SmallVector<digit_type> &rhs)
 {
     return rhs != lhs;
 }
 
 bool
-operator!=(const std::vector<digit_type> &lhs,
+operator!=(const SmallVector<digit_type> &lhs,
            long double                    rhs)
 {
     return !(lhs == rhs);
@@ -313,21 +306,21 @@ operator!=(const std::vector<digit_type> &lhs,
 
 bool
 operator!=(long double                    lhs,
-           const std::vector<digit_type> &rhs)
+           const SmallVector<digit_type> &rhs)
 {
     return rhs != lhs;
 }
 
 
 bool
-operator<(const std::vector<digit_type> &lhs,
-          const std::vector<digit_type> &rhs)
+operator<(const SmallVector<digit_type> &lhs,
+          const SmallVector<digit_type> &rhs)
 {
     return less_than(lhs, rhs);
 }
 
 bool
-operator<(const std::vector<digit_type> &lhs,
+operator<(const SmallVector<digit_type> &lhs,
           std::uintmax_t                 rhs)
 {
     return less_than(lhs, rhs);
@@ -335,13 +328,13 @@ operator<(const std::vector<digit_type> &lhs,
 
 bool
 operator<(std::uintmax_t                 lhs,
-          const std::vector<digit_type> &rhs)
+          const SmallVector<digit_type> &rhs)
 {
     return rhs > lhs;
 }
 
 bool
-operator<(const std::vector<digit_type> &lhs,
+operator<(const SmallVector<digit_type> &lhs,
           long double                    rhs)
 {
     return less_than(lhs, rhs);
@@ -350,21 +343,21 @@ operator<(const std::vector<digit_type> &lhs,
 
 bool
 operator<(long double                    lhs,
-          const std::vector<digit_type> &rhs)
+          const SmallVector<digit_type> &rhs)
 {
     return rhs > lhs;
 }
 
 
 bool
-operator>(const std::vector<digit_type> &lhs,
-          const std::vector<digit_type> &rhs)
+operator>(const SmallVector<digit_type> &lhs,
+          const SmallVector<digit_type> &rhs)
 {
     return greater_than(lhs, rhs);
 }
 
 bool
-operator>(const std::vector<digit_type> &lhs,
+operator>(const SmallVector<digit_type> &lhs,
           std::uintmax_t                 rhs)
 {
     return greater_than(lhs, rhs);
@@ -372,13 +365,13 @@ operator>(const std::vector<digit_type> &lhs,
 
 bool
 operator>(std::uintmax_t                 lhs,
-          const std::vector<digit_type> &rhs)
+          const SmallVector<digit_type> &rhs)
 {
     return rhs < lhs;
 }
 
 bool
-operator>(const std::vector<digit_type> &lhs,
+operator>(const SmallVector<digit_type> &lhs,
           long double                    rhs)
 {
     return greater_than(lhs, rhs);
@@ -386,21 +379,21 @@ operator>(const std::vector<digit_type> &lhs,
 
 bool
 operator>(long double                    lhs,
-          const std::vector<digit_type> &rhs)
+          const SmallVector<digit_type> &rhs)
 {
     return rhs < lhs;
 }
 
 
 bool
-operator<=(const std::vector<digit_type> &lhs,
-           const std::vector<digit_type> &rhs)
+operator<=(const SmallVector<digit_type> &lhs,
+           const SmallVector<digit_type> &rhs)
 {
     return less_than_or_equal_to(lhs, rhs);
 }
 
 bool
-operator<=(const std::vector<digit_type> &lhs,
+operator<=(const SmallVector<digit_type> &lhs,
            std::uintmax_t                 rhs)
 {
     return less_than_or_equal_to(lhs, rhs);
@@ -408,13 +401,13 @@ operator<=(const std::vector<digit_type> &lhs,
 
 bool
 operator<=(std::uintmax_t                 lhs,
-           const std::vector<digit_type> &rhs)
+           const SmallVector<digit_type> &rhs)
 {
     return rhs >= lhs;
 }
 
 bool
-operator<=(const std::vector<digit_type> &lhs,
+operator<=(const SmallVector<digit_type> &lhs,
            long double                    rhs)
 {
     return less_than_or_equal_to(lhs, rhs);
@@ -422,21 +415,21 @@ operator<=(const std::vector<digit_type> &lhs,
 
 bool
 operator<=(long double                    lhs,
-           const std::vector<digit_type> &rhs)
+           const SmallVector<digit_type> &rhs)
 {
     return rhs >= lhs;
 }
 
 
 bool
-operator>=(const std::vector<digit_type> &lhs,
-           const std::vector<digit_type> &rhs)
+operator>=(const SmallVector<digit_type> &lhs,
+           const SmallVector<digit_type> &rhs)
 {
     return greater_than_or_equal_to(lhs, rhs);
 }
 
 bool
-operator>=(const std::vector<digit_type> &lhs,
+operator>=(const SmallVector<digit_type> &lhs,
            std::uintmax_t                 rhs)
 {
     return greater_than_or_equal_to(lhs, rhs);
@@ -444,13 +437,13 @@ operator>=(const std::vector<digit_type> &lhs,
 
 bool
 operator>=(std::uintmax_t                 lhs,
-           const std::vector<digit_type> &rhs)
+           const SmallVector<digit_type> &rhs)
 {
     return rhs <= lhs;
 }
 
 bool
-operator>=(const std::vector<digit_type> &lhs,
+operator>=(const SmallVector<digit_type> &lhs,
            long double                    rhs)
 {
     return greater_than_or_equal_to(lhs, rhs);
@@ -458,16 +451,16 @@ operator>=(const std::vector<digit_type> &lhs,
 
 bool
 operator>=(long double                    lhs,
-           const std::vector<digit_type> &rhs)
+           const SmallVector<digit_type> &rhs)
 {
     return rhs <= lhs;
 }
 
 bool
-less_than(std::vector<digit_type>::const_iterator lhs_begin,
-          std::vector<digit_type>::const_iterator lhs_end,
-          std::vector<digit_type>::const_iterator rhs_begin,
-          std::vector<digit_type>::const_iterator rhs_end)
+less_than(SmallVector<digit_type>::const_iterator lhs_begin,
+          SmallVector<digit_type>::const_iterator lhs_end,
+          SmallVector<digit_type>::const_iterator rhs_begin,
+          SmallVector<digit_type>::const_iterator rhs_end)
 {
     return have_inequality<std::less, StrictSequenceInequality>(lhs_begin,
                                                                 lhs_end,
@@ -475,5 +468,20 @@ less_than(std::vector<digit_type>::const_iterator lhs_begin,
                                                                 rhs_end);
 }
 
+std::strong_ordering
+compare_digits(DigitsView lhs,
+               DigitsView rhs)
+{
+    if (lhs.size() != rhs.size())
+        return lhs.size() <=> rhs.size();
+
+    auto [lhs_mismatch, rhs_mismatch] = std::mismatch(lhs.rbegin(), lhs.rend(),
+                                                      rhs.rbegin());
+    if (lhs_mismatch == lhs.rend())
+        return std::strong_ordering::equal;
+
+    return *lhs_mismatch <=> *rhs_mismatch;
+}
+
 } // namespace detail
 } // namespace tasty_int
@@ -1,9 +1,11 @@
 #ifndef TASTY_INT_TASTY_INT_DETAIL_DIGITS_COMPARISON_OPERATORS_HPP
 #define TASTY_INT_TASTY_INT_DETAIL_DIGITS_COMPARISON_OPERATORS_HPP
 
-#include <vector>
+#include <compare>
 
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/digits_view.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 
 namespace tasty_int {
 namespace detail {
@@ -11,7 +13,7 @@ namespace detail {
 /**
  * @defgroup DigitsComparisonOperators Digits Comparison Operators
  *
- * These operations operate on little-endian `std::vector`s of `digit_type`.
+ * These operations operate on little-endian `SmallVector`s of `digit_type`.
  * For inputs of inequal magnitudes, the larger-magnitude input is considered
  * greater.  For inputs of equal magntitudes, the digit sequences are compared
  * from most to least-signficant digit, and the first mismatch determines the
@@ -19,108 +21,120 @@ namespace detail {
  */
 /// @{
 bool
-operator==(const std::vector<digit_type> &lhs,
-           const std::vector<digit_type> &rhs);
-bool
-operator==(const std::vector<digit_type> &lhs,
+operator==(const SmallVector<digit_type> &lhs,
            std::uintmax_t                 rhs);
 bool
 operator==(std::uintmax_t                 lhs,
-           const std::vector<digit_type> &rhs);
+           const SmallVector<digit_type> &rhs);
 bool
-operator==(const std::vector<digit_type> &lhs,
+operator==(const SmallVector<digit_type> &lhs,
            long double                    rhs);
 bool
 operator==(long double                    lhs,
-           const std::vector<digit_type> &rhs);
+           const SmallVector<digit_type> &rhs);
 
 bool
-operator!=(const std::vector<digit_type> &lhs,
-           const std::vector<digit_type> &rhs);
+operator!=(const SmallVector<digit_type> &lhs,
+           const SmallVector<digit_type> &rhs);
 bool
-operator!=(const std::vector<digit_type> &lhs,
+operator!=(const SmallVector<digit_type> &lhs,
            std::uintmax_t                 rhs);
 bool
 operator!=(std::uintmax_t                 lhs,
-           const std::vector<digit_type> &rhs);
+           const SmallVector<digit_type> &rhs);
 bool
-operator!=(const std::vector<digit_type> &lhs,
+operator!=(const SmallVector<digit_type> &lhs,
            long double                    rhs);
 bool
 operator!=(long double                    lhs,
-           const std::vector<digit_type> &rhs);
+           const SmallVector<digit_type> &rhs);
 
 bool
-operator<(const std::vector<digit_type> &lhs,
-          const std::vector<digit_type> &rhs);
+operator<(const SmallVector<digit_type> &lhs,
+          const SmallVector<digit_type> &rhs);
 bool
-operator<(const std::vector<digit_type> &lhs,
+operator<(const SmallVector<digit_type> &lhs,
           std::uintmax_t                 rhs);
 bool
 operator<(std::uintmax_t                 lhs,
-          const std::vector<digit_type> &rhs);
+          const SmallVector<digit_type> &rhs);
 bool
-operator<(const std::vector<digit_type> &lhs,
+operator<(const SmallVector<digit_type> &lhs,
           long double                    rhs);
 bool
 operator<(long double                    lhs,
-          const std::vector<digit_type> &rhs);
+          const SmallVector<digit_type> &rhs);
 
 bool
-operator>(const std::vector<digit_type> &lhs,
-          const std::vector<digit_type> &rhs);
+operator>(const SmallVector<digit_type> &lhs,
+          const SmallVector<digit_type> &rhs);
 bool
-operator>(const std::vector<digit_type> &lhs,
+operator>(const SmallVector<digit_type> &lhs,
           std::uintmax_t                 rhs);
 bool
 operator>(std::uintmax_t                 lhs,
-          const std::vector<digit_type> &rhs);
+          const SmallVector<digit_type> &rhs);
 bool
-operator>(const std::vector<digit_type> &lhs,
+operator>(const SmallVector<digit_type> &lhs,
           long double                    rhs);
 bool
 operator>(long double                    lhs,
-          const std::vector<digit_type> &rhs);
+          const SmallVector<digit_type> &rhs);
 
 bool
-operator<=(const std::vector<digit_type> &lhs,
-           const std::vector<digit_type> &rhs);
+operator<=(const SmallVector<digit_type> &lhs,
+           const SmallVector<digit_type> &rhs);
 bool
-operator<=(const std::vector<digit_type> &lhs,
+operator<=(const SmallVector<digit_type> &lhs,
            std::uintmax_t                 rhs);
 bool
 operator<=(std::uintmax_t                 lhs,
-           const std::vector<digit_type> &rhs);
+           const SmallVector<digit_type> &rhs);
 bool
-operator<=(const std::vector<digit_type> &lhs,
+operator<=(const SmallVector<digit_type> &lhs,
            long double                    rhs);
 bool
 operator<=(long double                    lhs,
-           const std::vector<digit_type> &rhs);
+           const SmallVector<digit_type> &rhs);
 
 bool
-operator>=(const std::vector<digit_type> &lhs,
-           const std::vector<digit_type> &rhs);
+operator>=(const SmallVector<digit_type> &lhs,
+           const SmallVector<digit_type> &rhs);
 bool
-operator>=(const std::vector<digit_type> &lhs,
+operator>=(const SmallVector<digit_type> &lhs,
            std::uintmax_t                 rhs);
 bool
 operator>=(std::uintmax_t                 lhs,
-           const std::vector<digit_type> &rhs);
+           const SmallVector<digit_type> &rhs);
 bool
-operator>=(const std::vector<digit_type> &lhs,
+operator>=(const SmallVector<digit_type> &lhs,
            long double                    rhs);
 bool
 operator>=(long double                    lhs,
-           const std::vector<digit_type> &rhs);
+           const SmallVector<digit_type> &rhs);
 
 bool
-less_than(std::vector<digit_type>::const_iterator lhs_begin,
-          std::vector<digit_type>::const_iterator lhs_end,
-          std::vector<digit_type>::const_iterator rhs_begin,
-          std::vector<digit_type>::const_iterator rhs_end);
+less_than(SmallVector<digit_type>::const_iterator lhs_begin,
+          SmallVector<digit_type>::const_iterator lhs_end,
+          SmallVector<digit_type>::const_iterator rhs_begin,
+          SmallVector<digit_type>::const_iterator rhs_end);
 /// @}
 
+/**
+ * @brief Three-way compares two read-only digit sequences according to the
+ *     ordering of @ref DigitsComparisonOperators.
+ *
+ * @param[in] lhs the left-hand digits
+ * @param[in] rhs the right-hand digits
+ * @return the ordering of @p lhs relative to @p rhs
+ *
+ * @pre input digits must be non-empty
+ * @pre input digits may have no leading zeros
+ */
+std::strong_ordering
+compare_digits(DigitsView lhs,
+               DigitsView rhs);
+
 } // namespace detail
 } // namespace tasty_int
 
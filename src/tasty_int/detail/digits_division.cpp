@@ -8,12 +8,14 @@
 #include <utility>
 
 #include "tasty_int/detail/digit_from_nonnegative_value.hpp"
+#include "tasty_int/detail/tuning_thresholds.hpp"
 #include "tasty_int/detail/is_zero.hpp"
 #include "tasty_int/detail/trailing_zero.hpp"
 #include "tasty_int/detail/split_digits.hpp"
 #include "tasty_int/detail/next_power_of_two.hpp"
 #include "tasty_int/detail/integral_digits_view.hpp"
 #include "tasty_int/detail/extended_digit_accumulator.hpp"
+#include "tasty_int/detail/invariant_digit_divisor.hpp"
 #include "tasty_int/detail/digits_comparison.hpp"
 #include "tasty_int/detail/digits_bitwise.hpp"
 #include "tasty_int/detail/digits_addition.hpp"
@@ -26,15 +28,24 @@ namespace tasty_int {
 namespace detail {
 namespace {
 
+/**
+ * The divisor magnitude below which divide_and_conquer_divide() delegates to
+ * long division, and the size of the pieces into which it splits larger
+ * divisors.
+ *
+ * @todo TODO: tune
+ */
+constexpr SmallVector<digit_type>::size_type DIVISION_PIECE_MAGNITUDE = 32;
+
 DigitsDivisionResult
-make_zero_quotient_result(const std::vector<digit_type> &dividend)
+make_zero_quotient_result(const SmallVector<digit_type> &dividend)
 {
     return { .quotient = { 0 }, .remainder = dividend };
 }
 
 template<typename RhsType>
-std::vector<digit_type> &
-operator-=(std::vector<digit_type> &lhs,
+SmallVector<digit_type> &
+operator-=(SmallVector<digit_type> &lhs,
            const RhsType           &rhs)
 {
     [[maybe_unused]] auto sign = subtract_in_place(rhs, lhs);
@@ -43,13 +54,6 @@ operator-=(std::vector<digit_type> &lhs,
     return lhs;
 }
 
-std::vector<digit_type>
-operator*(const std::vector<digit_type> &lhs,
-          digit_type                     rhs)
-{
-    return tasty_int::detail::operator*(lhs, std::uintmax_t(rhs));
-}
-
 template<typename DigitsType>
 auto
 magnitude(DigitsType digits) -> decltype(digits.digits_size())
@@ -57,8 +61,8 @@ magnitude(DigitsType digits) -> decltype(digits.digits_size())
     return digits.digits_size();
 }
 
-std::vector<digit_type>::size_type
-magnitude(const std::vector<digit_type>& digits)
+SmallVector<digit_type>::size_type
+magnitude(const SmallVector<digit_type>& digits)
 {
     return digits.size();
 }
@@ -70,7 +74,7 @@ most_significant_digit(IntegralDigitsView digits)
 }
 
 digit_type
-most_significant_digit(const std::vector<digit_type>& digits)
+most_significant_digit(const SmallVector<digit_type>& digits)
 {
     return digits.back();
 }
@@ -87,14 +91,14 @@ long_divide_normal_shift_offset(const DivisorType &divisor)
     return normal_offset;
 }
 
-std::vector<digit_type>
+SmallVector<digit_type>
 digits_from_remainder_accumulator(ExtendedDigitAccumulator remainder)
 {
     assert(remainder.digits_size() <= DIGITS_PER_DIGIT_ACCUMULATOR);
 
     auto have_middle_digit = (remainder.middle_digit() != 0);
 
-    std::vector<digit_type> digits;
+    SmallVector<digit_type> digits;
     digits.reserve(1 + have_middle_digit);
 
     digits.emplace_back(remainder.low_digit());
@@ -118,7 +122,7 @@ estimate_digit_quotient(digit_accumulator_type sig_dividend,
 }
 
 digit_accumulator_type
-significant_dividend_digits(const std::vector<digit_type> &dividend,
+significant_dividend_digits(const SmallVector<digit_type> &dividend,
                             std::size_t                    divisor_mag)
 {
     digit_accumulator_type sig_dividend = dividend.back();
@@ -179,7 +183,7 @@ quotient_divisor_product(digit_type          tentative_quotient,
                          const DivisorType  &divisor,
                          const DividendType &dividend)
 {
-    auto product = divisor * tentative_quotient;
+    auto product = divisor * std::uintmax_t(tentative_quotient);
 
     if (product > dividend) {
         product -= divisor;
@@ -214,7 +218,7 @@ divide_similar_magnitude_in_place(const DivisorType &divisor,
 
 void
 multiply_digit_base_accumulate_in_place(digit_type               addend,
-                                        std::vector<digit_type> &result)
+                                        SmallVector<digit_type> &result)
 {
     result <<= 1;
     result.front() = addend;
@@ -228,50 +232,69 @@ multiply_digit_base_accumulate_in_place(digit_type                addend,
 }
 
 template<typename DivisorType>
-std::vector<digit_type>
-allocate_quotient(const std::vector<digit_type> &dividend,
+SmallVector<digit_type>
+allocate_quotient(const SmallVector<digit_type> &dividend,
                   const DivisorType             &divisor)
 {
     auto max_quotient_mag = magnitude(dividend) + 1
                           - magnitude(divisor);
-    std::vector<digit_type> quotient;
+    SmallVector<digit_type> quotient;
     quotient.reserve(max_quotient_mag);
 
     return quotient;
 }
 
-std::vector<digit_type>
-allocate_remainder(const std::vector<digit_type> &divisor)
+SmallVector<digit_type>
+allocate_remainder(const SmallVector<digit_type> &divisor)
 {
     auto max_remainder_mag = magnitude(divisor) + 1;
-    std::vector<digit_type> remainder;
+    SmallVector<digit_type> remainder;
     remainder.reserve(max_remainder_mag);
 
     return remainder;
 }
 
-template<typename DivisorType, typename RemainderType>
-std::vector<digit_type>
-build_reversed_quotient(const std::vector<digit_type> &dividend,
-                        const DivisorType             &divisor,
-                        RemainderType                 &remainder)
+/**
+ * Brings down each digit of @p dividend into @p remainder, most significant
+ * first, and passes each quotient digit to @p handle_quotient_digit.
+ */
+template<typename DivisorType,
+         typename RemainderType,
+         typename QuotientDigitHandler>
+void
+long_divide_digits(const SmallVector<digit_type> &dividend,
+                   const DivisorType             &divisor,
+                   RemainderType                 &remainder,
+                   QuotientDigitHandler         &&handle_quotient_digit)
 {
-    auto quotient = allocate_quotient(dividend, divisor);
-
     auto dividend_cursor = dividend.rbegin();
     do {
         multiply_digit_base_accumulate_in_place(*dividend_cursor, remainder);
 
-        auto quotient_digit = divide_similar_magnitude_in_place(divisor,
-                                                                remainder);
-        quotient.emplace_back(quotient_digit);
+        handle_quotient_digit(
+            divide_similar_magnitude_in_place(divisor, remainder)
+        );
     } while (++dividend_cursor != dividend.rend());
+}
+
+template<typename DivisorType, typename RemainderType>
+SmallVector<digit_type>
+build_reversed_quotient(const SmallVector<digit_type> &dividend,
+                        const DivisorType             &divisor,
+                        RemainderType                 &remainder)
+{
+    auto quotient = allocate_quotient(dividend, divisor);
+
+    long_divide_digits(dividend, divisor, remainder,
+                       [&](digit_type quotient_digit) {
+                           quotient.emplace_back(quotient_digit);
+                       });
 
     return quotient;
 }
 
 void
-correct_reversed_quotient(std::vector<digit_type> &quotient)
+correct_reversed_quotient(SmallVector<digit_type> &quotient)
 {
     std::reverse(quotient.begin(), quotient.end());
 
@@ -279,8 +302,8 @@ correct_reversed_quotient(std::vector<digit_type> &quotient)
 }
 
 template<typename DivisorType, typename RemainderType>
-std::vector<digit_type>
-normalized_long_divide(const std::vector<digit_type> &dividend,
+SmallVector<digit_type>
+normalized_long_divide(const SmallVector<digit_type> &dividend,
                        const DivisorType             &divisor,
                        RemainderType                 &remainder)
 {
@@ -291,30 +314,65 @@ normalized_long_divide(const std::vector<digit_type> &dividend,
     return quotient;
 }
 
+/**
+ * Divides @p dividend one digit at a time, most significant first, by
+ * multiplying each by the reciprocal of @p divisor rather than dividing.
+ */
+DigitsDivisionResult
+long_divide_digit(const SmallVector<digit_type> &dividend,
+                  const InvariantDigitDivisor   &divisor)
+{
+    DigitsDivisionResult result;
+
+    auto &quotient = result.quotient;
+    quotient.resize(dividend.size());
+
+    digit_type remainder = 0;
+    for (auto index = dividend.size(); index-- > 0; ) {
+        auto digit_result = divisor.divide(remainder, dividend[index]);
+
+        quotient[index] = digit_result.quotient;
+        remainder       = digit_result.remainder;
+    }
+
+    trim_trailing_zeros(quotient);
+
+    result.remainder.assign(1, remainder);
+
+    return result;
+}
+
+digit_type
+long_divide_digit_remainder(const SmallVector<digit_type> &dividend,
+                            const InvariantDigitDivisor   &divisor)
+{
+    digit_type remainder = 0;
+    for (auto cursor = dividend.rbegin(); cursor != dividend.rend(); ++cursor)
+        remainder = divisor.divide(remainder, *cursor).remainder;
+
+    return remainder;
+}
+
 bool
-is_odd(std::vector<digit_type>::size_type value)
+is_odd(SmallVector<digit_type>::size_type value)
 {
     return (value & 1) != 0;
 }
 
 bool
 is_divide_and_conquer_divide_base_case(
-    std::vector<digit_type>::size_type divisor_mag
+    SmallVector<digit_type>::size_type divisor_mag
 )
 {
-    /// @todo TODO: tune
-    constexpr std::vector<digit_type>::size_type
-        LONG_DIVIDE_THRESHOLD_DIVISOR_MAGNITUDE = 32;
-
     return is_odd(divisor_mag)
-        || (divisor_mag <= LONG_DIVIDE_THRESHOLD_DIVISOR_MAGNITUDE);
+        || (divisor_mag <= codegen::LONG_DIVIDE_THRESHOLD_DIVISOR_MAGNITUDE);
 }
 
 void
 append_2n_1n_split_piece(
-    const std::vector<digit_type>      &piece,
-    std::vector<digit_type>::size_type  split_size,
-    std::vector<digit_type>            &digits
+    const SmallVector<digit_type>      &piece,
+    SmallVector<digit_type>::size_type  split_size,
+    SmallVector<digit_type>            &digits
 )
 {
     if (!is_zero(piece)) {
@@ -326,8 +384,8 @@ append_2n_1n_split_piece(
 }
 
 DigitsDivisionResult
-divide_normalized_3n_2n_split_upper(std::vector<digit_type> &&dividend_upper,
-                                    std::vector<digit_type> &&divisor_high)
+divide_normalized_3n_2n_split_upper(SmallVector<digit_type> &&dividend_upper,
+                                    SmallVector<digit_type> &&divisor_high)
 {
     DigitsDivisionResult result;
 
@@ -346,7 +404,7 @@ divide_normalized_3n_2n_split_upper(std::vector<digit_type> &&dividend_upper,
 void
 correct_divide_normalized_3n_2n_split_remainder(
     Sign                           remainder_sign,
-    const std::vector<digit_type> &divisor,
+    const SmallVector<digit_type> &divisor,
     DigitsDivisionResult          &result
 )
 {
@@ -363,8 +421,8 @@ correct_divide_normalized_3n_2n_split_remainder(
 
 DigitsShiftOffset
 divide_and_conquer_normal_shift_offset(
-    const std::vector<digit_type>      &divisor,
-    std::vector<digit_type>::size_type  divisor_piece_mag
+    const SmallVector<digit_type>      &divisor,
+    SmallVector<digit_type>::size_type  divisor_piece_mag
 )
 {
     auto count_divisor_pieces =
@@ -380,8 +438,8 @@ divide_and_conquer_normal_shift_offset(
 }
 
 std::size_t
-ceil_divide(std::vector<digit_type>::size_type dividend,
-            std::vector<digit_type>::size_type divisor)
+ceil_divide(SmallVector<digit_type>::size_type dividend,
+            SmallVector<digit_type>::size_type divisor)
 {
     auto quotient  = (dividend / divisor);
     auto remainder = (dividend % divisor);
@@ -390,16 +448,16 @@ ceil_divide(std::vector<digit_type>::size_type dividend,
 }
 
 bool
-have_most_significant_one_bit(const std::vector<digit_type> &digits)
+have_most_significant_one_bit(const SmallVector<digit_type> &digits)
 {
     constexpr digit_type MOST_SIGNIFICANT_DIGIT_BIT = DIGIT_BASE >> 1;
 
     return digits.back() >= MOST_SIGNIFICANT_DIGIT_BIT;
 }
 
-std::vector<digit_type>::size_type
-padded_dividend_magnitude(const std::vector<digit_type> &normalized_dividend,
-                          const std::vector<digit_type> &normalized_divisor)
+SmallVector<digit_type>::size_type
+padded_dividend_magnitude(const SmallVector<digit_type> &normalized_dividend,
+                          const SmallVector<digit_type> &normalized_divisor)
 {
     auto count_dividend_pieces = std::max<std::size_t>(
         2,
@@ -418,9 +476,9 @@ padded_dividend_magnitude(const std::vector<digit_type> &normalized_dividend,
 
 void
 append_reversed_quotient_piece(
-    const std::vector<digit_type>      &quotient_piece,
-    std::vector<digit_type>::size_type  divisor_mag,
-    std::vector<digit_type>            &quotient
+    const SmallVector<digit_type>      &quotient_piece,
+    SmallVector<digit_type>::size_type  divisor_mag,
+    SmallVector<digit_type>            &quotient
 )
 {
     quotient.insert(quotient.end(),
@@ -432,8 +490,8 @@ append_reversed_quotient_piece(
 }
 
 void
-append_remainder_piece(const std::vector<digit_type> &remainder_piece,
-                       std::vector<digit_type>       &remainder)
+append_remainder_piece(const SmallVector<digit_type> &remainder_piece,
+                       SmallVector<digit_type>       &remainder)
 {
     remainder.insert(remainder.end(),
                      remainder_piece.begin(),
@@ -441,49 +499,307 @@ append_remainder_piece(const std::vector<digit_type> &remainder_piece,
     trim_trailing_zeros(remainder);
 }
 
-DigitsDivisionResult
-divide_and_conquer_divide_normalized(const std::vector<digit_type> &dividend,
-                                     const std::vector<digit_type> &divisor)
+/**
+ * Consumes @p dividend a piece of the magnitude of @p divisor at a time, most
+ * significant piece first, dividing two pieces at a time by the 2n/1n split
+ * and passing each quotient piece to @p handle_quotient_piece.
+ *
+ * @return the remainder
+ */
+template<typename QuotientPieceHandler>
+SmallVector<digit_type>
+divide_and_conquer_divide_normalized(
+    const SmallVector<digit_type> &dividend,
+    const SmallVector<digit_type> &divisor,
+    QuotientPieceHandler         &&handle_quotient_piece
+)
 {
-    DigitsDivisionResult result;
-    auto &quotient  = result.quotient;
-    auto &remainder = result.remainder;
-
     auto dividend_offset =
         padded_dividend_magnitude(dividend, divisor)
         - (2 * divisor.size());
 
     auto dividend_cursor = dividend.begin() + dividend_offset;
 
-    remainder.assign(dividend_cursor, dividend.end());
+    SmallVector<digit_type> remainder(dividend_cursor, dividend.end());
 
     while (true) {
         auto sub_result = divide_normalized_2n_1n_split(remainder, divisor);
 
-        append_reversed_quotient_piece(sub_result.quotient,
-                                       divisor.size(),
-                                       quotient);
+        handle_quotient_piece(sub_result.quotient);
+
+        if (dividend_cursor == dividend.begin())
+            return std::move(sub_result.remainder);
 
-        if (dividend_cursor == dividend.begin()) {
-            remainder = std::move(sub_result.remainder);
-            break;
-        }
         auto dividend_piece_end = dividend_cursor;
         dividend_cursor -= divisor.size();
 
         remainder.assign(dividend_cursor, dividend_piece_end);
         append_remainder_piece(sub_result.remainder, remainder);
     }
+}
+
+DigitsDivisionResult
+divide_and_conquer_divide_normalized(const SmallVector<digit_type> &dividend,
+                                     const SmallVector<digit_type> &divisor)
+{
+    DigitsDivisionResult result;
+    auto &quotient = result.quotient;
+
+    result.remainder = divide_and_conquer_divide_normalized(
+        dividend, divisor,
+        [&](const SmallVector<digit_type> &quotient_piece) {
+            append_reversed_quotient_piece(quotient_piece,
+                                           divisor.size(),
+                                           quotient);
+        }
+    );
 
-    correct_reversed_quotient(result.quotient);
+    correct_reversed_quotient(quotient);
 
     return result;
 }
 
+SmallVector<digit_type>
+divide_and_conquer_remainder_normalized(
+    const SmallVector<digit_type> &dividend,
+    const SmallVector<digit_type> &divisor
+)
+{
+    return divide_and_conquer_divide_normalized(
+        dividend, divisor,
+        [](const SmallVector<digit_type> &) {}
+    );
+}
+
+bool
+is_newton_divide_base_case(SmallVector<digit_type>::size_type divisor_mag)
+{
+    return divisor_mag
+        <= codegen::DIVIDE_AND_CONQUER_DIVIDE_THRESHOLD_DIVISOR_MAGNITUDE;
+}
+
+SmallVector<digit_type>
+power_of_digit_base(SmallVector<digit_type>::size_type exponent)
+{
+    SmallVector<digit_type> power(exponent + 1, 0);
+    power.back() = 1;
+
+    return power;
+}
+
+SmallVector<digit_type>
+shift_right_digits(SmallVector<digit_type>            &&digits,
+                   SmallVector<digit_type>::size_type   digit_offset)
+{
+    digits >>= DigitsShiftOffset{ .digits = digit_offset, .bits = 0 };
+
+    return std::move(digits);
+}
+
+// Reciprocals of magnitude-n divisors almost always take the form
+// DIGIT_BASE^n + low, where low fits in n digits.  Multiplying by low and
+// adding the shifted multiplicand keeps the product operands at n digits.
+SmallVector<digit_type>
+multiply_by_reciprocal(const SmallVector<digit_type>      &multiplicand,
+                       const SmallVector<digit_type>      &reciprocal,
+                       SmallVector<digit_type>::size_type  divisor_mag)
+{
+    if ((reciprocal.size() != (divisor_mag + 1)) || (reciprocal.back() != 1))
+        return multiplicand * reciprocal;
+
+    SmallVector<digit_type> reciprocal_low(reciprocal.begin(),
+                                           reciprocal.end() - 1);
+    trim_trailing_zeros(reciprocal_low);
+
+    auto product              = multiplicand * reciprocal_low;
+    auto shifted_multiplicand = multiplicand;
+    shifted_multiplicand <<= divisor_mag;
+    product += shifted_multiplicand;
+
+    return product;
+}
+
+/**
+ * Approximates `floor(DIGIT_BASE^(2n) / divisor)` from below for a normalized
+ * divisor of magnitude `n`.
+ *
+ * The reciprocal `X` of the high `h = n/2 + 1` digits of divisor is accurate
+ * to about `h` digits, so `X*DIGIT_BASE^(n-h)` is a starting point of that
+ * precision.  A single Newton step,
+ *
+ *     X' = X + X*(DIGIT_BASE^(2n) - divisor*X) / DIGIT_BASE^(2n)
+ *
+ * roughly doubles the number of accurate digits and never overshoots.  The
+ * extra digit of `h` keeps the shortfall within a few units at every level of
+ * recursion, and only the high digits of the error term contribute to the
+ * step.
+ */
+SmallVector<digit_type>
+newton_reciprocal(const SmallVector<digit_type> &divisor)
+{
+    auto divisor_mag = divisor.size();
+
+    if (is_newton_divide_base_case(divisor_mag))
+        return divide_and_conquer_divide(power_of_digit_base(2 * divisor_mag),
+                                         divisor).quotient;
+
+    auto high_mag = (divisor_mag / 2) + 1;
+    auto low_mag  = divisor_mag - high_mag;
+    assert(high_mag < divisor_mag);
+
+    SmallVector<digit_type> divisor_high(divisor.begin() + low_mag,
+                                         divisor.end());
+    auto reciprocal_high = newton_reciprocal(divisor_high);
+
+    auto reciprocal = reciprocal_high;
+    reciprocal <<= low_mag;
+
+    // The error of the starting point scaled down by DIGIT_BASE^(n-h).  Its
+    // low h-1 digits change the step by less than one unit.
+    auto product = multiply_by_reciprocal(divisor, reciprocal_high, high_mag);
+    auto error   = power_of_digit_base(divisor_mag + high_mag);
+
+    if (product <= error) {
+        error -= product;
+        error  = shift_right_digits(std::move(error), high_mag - 1);
+
+        reciprocal += shift_right_digits(
+            multiply_by_reciprocal(error, reciprocal_high, high_mag),
+            high_mag + 1
+        );
+    } else {
+        product -= error;
+        product  = shift_right_digits(std::move(product), high_mag - 1);
+
+        reciprocal -= shift_right_digits(
+            multiply_by_reciprocal(product, reciprocal_high, high_mag),
+            high_mag + 1
+        );
+        reciprocal -= std::uintmax_t(2);
+    }
+
+    return reciprocal;
+}
+
+/**
+ * @pre `dividend < divisor*DIGIT_BASE^n` where `n` is the magnitude of
+ *     @p divisor
+ */
+DigitsDivisionResult
+divide_by_reciprocal(const SmallVector<digit_type> &dividend,
+                     const SmallVector<digit_type> &divisor,
+                     const SmallVector<digit_type> &reciprocal)
+{
+    auto divisor_mag = divisor.size();
+
+    DigitsDivisionResult result;
+    auto &quotient  = result.quotient;
+    auto &remainder = result.remainder;
+
+    // never exceeds the true quotient and falls short by only a few units
+    if (dividend.size() > divisor_mag) {
+        SmallVector<digit_type> dividend_high(dividend.begin() + divisor_mag,
+                                              dividend.end());
+        quotient = shift_right_digits(
+            multiply_by_reciprocal(dividend_high, reciprocal, divisor_mag),
+            divisor_mag
+        );
+    } else {
+        quotient.assign(1, 0);
+    }
+
+    remainder  = dividend;
+    remainder -= quotient * divisor;
+
+    while (remainder >= divisor) {
+        quotient  += std::uintmax_t(1);
+        remainder -= divisor;
+    }
+
+    return result;
+}
+
+/**
+ * Consumes @p dividend a piece of the magnitude of @p divisor at a time, most
+ * significant piece first, and passes each quotient piece to
+ * @p handle_quotient_piece.
+ *
+ * @return the remainder
+ */
+template<typename QuotientPieceHandler>
+SmallVector<digit_type>
+divide_normalized_by_reciprocal(
+    const SmallVector<digit_type> &dividend,
+    const SmallVector<digit_type> &divisor,
+    const SmallVector<digit_type> &reciprocal,
+    QuotientPieceHandler         &&handle_quotient_piece
+)
+{
+    auto divisor_mag = divisor.size();
+
+    auto count_dividend_pieces = ceil_divide(dividend.size(), divisor_mag);
+
+    auto dividend_cursor = dividend.begin()
+                         + ((count_dividend_pieces - 1) * divisor_mag);
+
+    SmallVector<digit_type> remainder(dividend_cursor, dividend.end());
+
+    while (true) {
+        auto sub_result = divide_by_reciprocal(remainder, divisor, reciprocal);
+
+        handle_quotient_piece(sub_result.quotient);
+
+        if (dividend_cursor == dividend.begin())
+            return std::move(sub_result.remainder);
+
+        auto dividend_piece_end = dividend_cursor;
+        dividend_cursor -= divisor_mag;
+
+        remainder.assign(dividend_cursor, dividend_piece_end);
+        append_remainder_piece(sub_result.remainder, remainder);
+    }
+}
+
+DigitsDivisionResult
+divide_normalized_by_reciprocal(const SmallVector<digit_type> &dividend,
+                                const SmallVector<digit_type> &divisor,
+                                const SmallVector<digit_type> &reciprocal)
+{
+    auto divisor_mag = divisor.size();
+
+    DigitsDivisionResult result;
+    auto &quotient = result.quotient;
+    quotient.reserve(ceil_divide(dividend.size(), divisor_mag) * divisor_mag);
+
+    result.remainder = divide_normalized_by_reciprocal(
+        dividend, divisor, reciprocal,
+        [&](const SmallVector<digit_type> &quotient_piece) {
+            append_reversed_quotient_piece(quotient_piece,
+                                           divisor_mag,
+                                           quotient);
+        }
+    );
+
+    correct_reversed_quotient(quotient);
+
+    return result;
+}
+
+SmallVector<digit_type>
+reduce_normalized_by_reciprocal(const SmallVector<digit_type> &dividend,
+                                const SmallVector<digit_type> &divisor,
+                                const SmallVector<digit_type> &reciprocal)
+{
+    return divide_normalized_by_reciprocal(
+        dividend, divisor, reciprocal,
+        [](const SmallVector<digit_type> &) {}
+    );
+}
+
 template<typename DivisorType>
-std::vector<digit_type>
+SmallVector<digit_type>
 divide_replace_dividend(const DivisorType       &divisor,
-                        std::vector<digit_type> &dividend)
+                        SmallVector<digit_type> &dividend)
 {
     auto result = divide(dividend, divisor);
 
@@ -495,40 +811,49 @@ divide_replace_dividend(const DivisorType       &divisor,
 } // namespace
 
 
-std::vector<digit_type>
-divide_in_place(const std::vector<digit_type> &divisor,
-                std::vector<digit_type>       &dividend)
+SmallVector<digit_type>
+divide_in_place(const SmallVector<digit_type> &divisor,
+                SmallVector<digit_type>       &dividend)
 {
     return divide_replace_dividend(divisor, dividend);
 }
 
-std::vector<digit_type>
+SmallVector<digit_type>
 divide_in_place(std::uintmax_t           divisor,
-                std::vector<digit_type> &dividend)
+                SmallVector<digit_type> &dividend)
 {
     return divide_replace_dividend(divisor, dividend);
 }
 
-std::vector<digit_type>
+SmallVector<digit_type>
 divide_in_place(long double              divisor,
-                std::vector<digit_type> &dividend)
+                SmallVector<digit_type> &dividend)
 {
     return divide_replace_dividend(divisor, dividend);
 }
 
+/**
+ * Single-digit divisors skip normalization and are divided by their
+ * reciprocal.
+ */
 DigitsDivisionResult
-divide(const std::vector<digit_type> &dividend,
-       const std::vector<digit_type> &divisor)
+divide(const SmallVector<digit_type> &dividend,
+       const SmallVector<digit_type> &divisor)
 {
     assert(!is_zero(divisor));
 
-    return (divisor <= dividend)
-         ? divide_and_conquer_divide(dividend, divisor)
-         : make_zero_quotient_result(dividend);
+    if (dividend < divisor)
+        return make_zero_quotient_result(dividend);
+
+    if (divisor.size() == 1)
+        return long_divide_digit(dividend,
+                                 InvariantDigitDivisor(divisor.front()));
+
+    return newton_divide(dividend, divisor);
 }
 
 DigitsDivisionResult
-divide(const std::vector<digit_type> &dividend,
+divide(const SmallVector<digit_type> &dividend,
        std::uintmax_t                 divisor)
 {
     assert(divisor > 0);
@@ -539,23 +864,72 @@ divide(const std::vector<digit_type> &dividend,
 }
 
 DigitsDivisionResult
-divide(const std::vector<digit_type> &dividend,
+divide(const SmallVector<digit_type> &dividend,
        long double                    divisor)
 {
     assert(std::isfinite(divisor));
     assert(divisor >= 1.0L);
 
     return (divisor <= dividend)
-         ? divide_and_conquer_divide(
+         ? newton_divide(
                dividend,
                conversions::digits_from_floating_point(divisor)
            )
          : make_zero_quotient_result(dividend);
 }
 
+/**
+ * Single-digit divisors are reduced like in divide().
+ */
+SmallVector<digit_type>
+remainder(const SmallVector<digit_type> &dividend,
+          const SmallVector<digit_type> &divisor)
+{
+    assert(!is_zero(divisor));
+
+    if (dividend < divisor)
+        return dividend;
+
+    if (divisor.size() == 1)
+        return {
+            long_divide_digit_remainder(
+                dividend,
+                InvariantDigitDivisor(divisor.front())
+            )
+        };
+
+    return newton_divide_remainder(dividend, divisor);
+}
+
+SmallVector<digit_type>
+remainder(const SmallVector<digit_type> &dividend,
+          std::uintmax_t                 divisor)
+{
+    assert(divisor > 0);
+
+    return (divisor <= dividend)
+         ? long_divide_remainder(dividend, divisor)
+         : dividend;
+}
+
+SmallVector<digit_type>
+remainder(const SmallVector<digit_type> &dividend,
+          long double                    divisor)
+{
+    assert(std::isfinite(divisor));
+    assert(divisor >= 1.0L);
+
+    return (divisor <= dividend)
+         ? newton_divide_remainder(
+               dividend,
+               conversions::digits_from_floating_point(divisor)
+           )
+         : dividend;
+}
+
 DigitsDivisionResult
-long_divide(const std::vector<digit_type> &dividend,
-            const std::vector<digit_type> &divisor)
+long_divide(const SmallVector<digit_type> &dividend,
+            const SmallVector<digit_type> &divisor)
 {
     assert(!is_zero(divisor));
     assert(dividend.size() >= divisor.size());
@@ -581,9 +955,14 @@ long_divide(const std::vector<digit_type> &dividend,
 }
 
 DigitsDivisionResult
-long_divide(const std::vector<digit_type> &dividend,
+long_divide(const SmallVector<digit_type> &dividend,
             std::uintmax_t                 divisor)
 {
+    if (divisor <= DIGIT_TYPE_MAX)
+        return long_divide_digit(
+            dividend,
+            InvariantDigitDivisor(static_cast<digit_type>(divisor))
+        );
 
     auto normal_offset =
         long_divide_normal_shift_offset(IntegralDigitsView(divisor));
@@ -605,14 +984,62 @@ long_divide(const std::vector<digit_type> &dividend,
     return result;
 }
 
+SmallVector<digit_type>
+long_divide_remainder(const SmallVector<digit_type> &dividend,
+                      const SmallVector<digit_type> &divisor)
+{
+    assert(!is_zero(divisor));
+    assert(dividend.size() >= divisor.size());
 
-DigitsDivisionResult
-divide_and_conquer_divide(const std::vector<digit_type> &dividend,
-                          const std::vector<digit_type> &divisor)
+    auto normal_offset = long_divide_normal_shift_offset(divisor);
+
+    auto normalized_dividend = dividend << normal_offset;
+    auto normalized_divisor  = divisor  << normal_offset;
+
+    auto remainder = allocate_remainder(normalized_divisor);
+    remainder.emplace_back(0);
+
+    long_divide_digits(normalized_dividend, normalized_divisor, remainder,
+                       [](digit_type) {});
+
+    remainder >>= normal_offset;
+
+    return remainder;
+}
+
+SmallVector<digit_type>
+long_divide_remainder(const SmallVector<digit_type> &dividend,
+                      std::uintmax_t                 divisor)
 {
-    /// @todo TODO: tune
-    constexpr std::vector<digit_type>::size_type DIVISION_PIECE_MAGNITUDE = 32;
+    if (divisor <= DIGIT_TYPE_MAX)
+        return {
+            long_divide_digit_remainder(
+                dividend,
+                InvariantDigitDivisor(static_cast<digit_type>(divisor))
+            )
+        };
 
+    auto normal_offset =
+        long_divide_normal_shift_offset(IntegralDigitsView(divisor));
+
+    auto normalized_dividend = dividend << normal_offset;
+    auto normalized_divisor  = divisor  << normal_offset.bits;
+
+    IntegralDigitsView normalized_divisor_view(normalized_divisor);
+    ExtendedDigitAccumulator remainder{};
+    long_divide_digits(normalized_dividend, normalized_divisor_view,
+                       remainder, [](digit_type) {});
+
+    remainder >>= normal_offset.bits;
+
+    return digits_from_remainder_accumulator(remainder);
+}
+
+
+DigitsDivisionResult
+divide_and_conquer_divide(const SmallVector<digit_type> &dividend,
+                          const SmallVector<digit_type> &divisor)
+{
     if (divisor.size() < DIVISION_PIECE_MAGNITUDE)
         return long_divide(dividend, divisor);
 
@@ -636,8 +1063,187 @@ divide_and_conquer_divide(const std::vector<digit_type> &dividend,
 }
 
 DigitsDivisionResult
-divide_normalized_2n_1n_split(const std::vector<digit_type> &dividend,
-                              const std::vector<digit_type> &divisor)
+newton_divide(const SmallVector<digit_type> &dividend,
+              const SmallVector<digit_type> &divisor)
+{
+    if (is_newton_divide_base_case(divisor.size()))
+        return divide_and_conquer_divide(dividend, divisor);
+
+    auto normal_offset = long_divide_normal_shift_offset(divisor);
+
+    auto normalized_dividend = dividend << normal_offset;
+    auto normalized_divisor  = divisor  << normal_offset;
+
+    assert(have_most_significant_one_bit(normalized_divisor));
+
+    auto result = divide_normalized_by_reciprocal(
+        normalized_dividend,
+        normalized_divisor,
+        newton_reciprocal(normalized_divisor)
+    );
+
+    result.remainder >>= normal_offset;
+
+    assert(result.remainder < divisor);
+
+    return result;
+}
+
+SmallVector<digit_type>
+divide_and_conquer_divide_remainder(const SmallVector<digit_type> &dividend,
+                                    const SmallVector<digit_type> &divisor)
+{
+    if (divisor.size() < DIVISION_PIECE_MAGNITUDE)
+        return long_divide_remainder(dividend, divisor);
+
+    auto normal_offset =
+        divide_and_conquer_normal_shift_offset(divisor,
+                                               DIVISION_PIECE_MAGNITUDE);
+
+    auto normalized_dividend = dividend << normal_offset;
+    auto normalized_divisor  = divisor  << normal_offset;
+
+    assert(have_most_significant_one_bit(normalized_divisor));
+
+    auto remainder = divide_and_conquer_remainder_normalized(
+        normalized_dividend,
+        normalized_divisor
+    );
+
+    remainder >>= normal_offset;
+
+    assert(remainder < divisor);
+
+    return remainder;
+}
+
+SmallVector<digit_type>
+newton_divide_remainder(const SmallVector<digit_type> &dividend,
+                        const SmallVector<digit_type> &divisor)
+{
+    if (is_newton_divide_base_case(divisor.size()))
+        return divide_and_conquer_divide_remainder(dividend, divisor);
+
+    auto normal_offset = long_divide_normal_shift_offset(divisor);
+
+    auto normalized_dividend = dividend << normal_offset;
+    auto normalized_divisor  = divisor  << normal_offset;
+
+    assert(have_most_significant_one_bit(normalized_divisor));
+
+    auto remainder = reduce_normalized_by_reciprocal(
+        normalized_dividend,
+        normalized_divisor,
+        newton_reciprocal(normalized_divisor)
+    );
+
+    remainder >>= normal_offset;
+
+    assert(remainder < divisor);
+
+    return remainder;
+}
+
+/**
+ * The normalized divisor is stored for every size.  Single-digit divisors
+ * also store their InvariantDigitDivisor reciprocal, and divisors beyond the
+ * long division threshold their fixed-point reciprocal.
+ */
+DigitsDivisor::DigitsDivisor(const SmallVector<digit_type> &digits)
+    : divisor(digits)
+    , normal_shift(0)
+    , digit_reciprocal(0)
+{
+    assert(!is_zero(divisor));
+    assert(!have_trailing_zero(divisor));
+
+    auto normal_offset = long_divide_normal_shift_offset(divisor);
+    normal_shift       = normal_offset.bits;
+    normalized_divisor = divisor << normal_offset;
+
+    if (divisor.size() == 1)
+        digit_reciprocal =
+            InvariantDigitDivisor(divisor.front()).normalized_reciprocal();
+    else if (divisor.size() > codegen::LONG_DIVIDE_THRESHOLD_DIVISOR_MAGNITUDE)
+        reciprocal = newton_reciprocal(normalized_divisor);
+}
+
+DigitsDivisionResult
+DigitsDivisor::divide(const SmallVector<digit_type> &dividend) const
+{
+    if (dividend < divisor)
+        return make_zero_quotient_result(dividend);
+
+    if (divisor.size() == 1)
+        return long_divide_digit(
+            dividend,
+            InvariantDigitDivisor(divisor.front(), digit_reciprocal)
+        );
+
+    DigitsShiftOffset normal_offset = { .digits = 0, .bits = normal_shift };
+
+    DigitsDivisionResult result;
+
+    if (have_reciprocal()) {
+        result = divide_normalized_by_reciprocal(dividend << normal_offset,
+                                                 normalized_divisor,
+                                                 reciprocal);
+    } else {
+        result.remainder = allocate_remainder(normalized_divisor);
+        result.remainder.emplace_back(0);
+
+        result.quotient = normalized_long_divide(dividend << normal_offset,
+                                                 normalized_divisor,
+                                                 result.remainder);
+    }
+
+    result.remainder >>= normal_offset;
+
+    assert(result.remainder < divisor);
+
+    return result;
+}
+
+SmallVector<digit_type>
+DigitsDivisor::reduce(const SmallVector<digit_type> &dividend) const
+{
+    if (dividend < divisor)
+        return dividend;
+
+    if (divisor.size() == 1)
+        return {
+            long_divide_digit_remainder(
+                dividend,
+                InvariantDigitDivisor(divisor.front(), digit_reciprocal)
+            )
+        };
+
+    DigitsShiftOffset normal_offset = { .digits = 0, .bits = normal_shift };
+
+    SmallVector<digit_type> remainder;
+
+    if (have_reciprocal()) {
+        remainder = reduce_normalized_by_reciprocal(dividend << normal_offset,
+                                                    normalized_divisor,
+                                                    reciprocal);
+    } else {
+        remainder = allocate_remainder(normalized_divisor);
+        remainder.emplace_back(0);
+
+        long_divide_digits(dividend << normal_offset, normalized_divisor,
+                           remainder, [](digit_type) {});
+    }
+
+    remainder >>= normal_offset;
+
+    assert(remainder < divisor);
+
+    return remainder;
+}
+
+DigitsDivisionResult
+divide_normalized_2n_1n_split(const SmallVector<digit_type> &dividend,
+                              const SmallVector<digit_type> &divisor)
 {
     assert(!dividend.empty());
     assert(!divisor.empty());
@@ -668,8 +1274,8 @@ divide_normalized_2n_1n_split(const std::vector<digit_type> &dividend,
 }
 
 DigitsDivisionResult
-divide_normalized_3n_2n_split(const std::vector<digit_type> &dividend,
-                              const std::vector<digit_type> &divisor)
+divide_normalized_3n_2n_split(const SmallVector<digit_type> &dividend,
+                              const SmallVector<digit_type> &divisor)
 {
     assert(!dividend.empty());
     assert(!divisor.empty());
@@ -3,9 +3,9 @@
 
 #include <cstddef>
 
-#include <vector>
-
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/digits_divisor.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 
 
 namespace tasty_int {
@@ -16,15 +16,15 @@ namespace detail {
  */
 struct DigitsDivisionResult
 {
-    std::vector<digit_type> quotient;  ///< the division quotient
-    std::vector<digit_type> remainder; ///< the division remainder
+    SmallVector<digit_type> quotient;  ///< the division quotient
+    SmallVector<digit_type> remainder; ///< the division remainder
 }; // struct DigitsDivisionResult
 
 
 /**
  * @defgroup DigitsDivisionOperations Digits Division Operations
  *
- * These operations operate on little-endian `std::vector`s of `digit_type`.
+ * These operations operate on little-endian `SmallVector`s of `digit_type`.
  * They produce the quotient and remainder of `dividend / divisor`.
  *
  * @pre input digits vectors must be non-empty
@@ -45,13 +45,13 @@ struct DigitsDivisionResult
  * @pre `divisor > 0`
  */
 /// @{
-std::vector<digit_type>
-divide_in_place(const std::vector<digit_type> &divisor,
-                std::vector<digit_type>       &dividend);
+SmallVector<digit_type>
+divide_in_place(const SmallVector<digit_type> &divisor,
+                SmallVector<digit_type>       &dividend);
 
-std::vector<digit_type>
+SmallVector<digit_type>
 divide_in_place(std::uintmax_t           divisor,
-                std::vector<digit_type> &dividend);
+                SmallVector<digit_type> &dividend);
 
 /**
  * @defgroup DigitsDivisionFloatingPointOverloads Digits Division Floating Point Overloads
@@ -62,9 +62,9 @@ divide_in_place(std::uintmax_t           divisor,
  * @pre `std::isfinite(divisor) && (divisor >= 1.0)`
  */
 /// @ingroup DigitsDivisionFloatingPointOverloads
-std::vector<digit_type>
+SmallVector<digit_type>
 divide_in_place(long double              divisor,
-                std::vector<digit_type> &dividend);
+                SmallVector<digit_type> &dividend);
 /// @}
 
 /**
@@ -81,19 +81,49 @@ divide_in_place(long double              divisor,
  */
 /// @{
 DigitsDivisionResult
-divide(const std::vector<digit_type> &dividend,
-       const std::vector<digit_type> &divisor);
+divide(const SmallVector<digit_type> &dividend,
+       const SmallVector<digit_type> &divisor);
 
 DigitsDivisionResult
-divide(const std::vector<digit_type> &dividend,
+divide(const SmallVector<digit_type> &dividend,
        std::uintmax_t                 divisor);
 
 /// @ingroup DigitsDivisionFloatingPointOverloads
 DigitsDivisionResult
-divide(const std::vector<digit_type> &dividend,
+divide(const SmallVector<digit_type> &dividend,
        long double                    divisor);
 /// @}
 
+/**
+ * @defgroup DigitsRemainderOperations Digits Remainder Operations
+ * @ingroup DigitsDivisionOperations
+ *
+ * @brief Execute `dividend % divisor`.
+ *
+ * @details These operations produce the remainder without building the
+ *     quotient.
+ *
+ * @param[in] dividend the value from which @p divisor is divided
+ * @param[in] divisor  the value by which @p dividend is divided
+ * @return the remainder
+ *
+ * @pre `divisor > 0`
+ */
+/// @{
+SmallVector<digit_type>
+remainder(const SmallVector<digit_type> &dividend,
+          const SmallVector<digit_type> &divisor);
+
+SmallVector<digit_type>
+remainder(const SmallVector<digit_type> &dividend,
+          std::uintmax_t                 divisor);
+
+/// @ingroup DigitsDivisionFloatingPointOverloads
+SmallVector<digit_type>
+remainder(const SmallVector<digit_type> &dividend,
+          long double                    divisor);
+/// @}
+
 /**
  * @defgroup DigitsDivisionAlgorithms Digits Division Algorithms
  *
@@ -108,11 +138,11 @@ divide(const std::vector<digit_type> &dividend,
  */
 /// @{
 DigitsDivisionResult
-long_divide(const std::vector<digit_type> &dividend,
-            const std::vector<digit_type> &divisor);
+long_divide(const SmallVector<digit_type> &dividend,
+            const SmallVector<digit_type> &divisor);
 
 DigitsDivisionResult
-long_divide(const std::vector<digit_type> &dividend,
+long_divide(const SmallVector<digit_type> &dividend,
             std::uintmax_t                 divisor);
 
 /**
@@ -124,8 +154,24 @@ long_divide(const std::vector<digit_type> &dividend,
  *     Stadtwald, D66123 Saarbrücken, Germany, October 1998.
  */
 DigitsDivisionResult
-divide_and_conquer_divide(const std::vector<digit_type> &dividend,
-                          const std::vector<digit_type> &divisor);
+divide_and_conquer_divide(const SmallVector<digit_type> &dividend,
+                          const SmallVector<digit_type> &divisor);
+
+/**
+ * Divides by a fixed-point reciprocal of @p divisor, approximating
+ * `floor(DIGIT_BASE^(2n) / divisor)` from below where `n` is the magnitude of
+ * @p divisor.  The reciprocal is found by Newton iteration, roughly doubling
+ * its precision at each step from the reciprocal of the high half of
+ * @p divisor.  @p dividend is then consumed `n` digits at a time, with each
+ * piece of the quotient estimated by a single multiplication by the
+ * reciprocal and corrected by a few subtractions of @p divisor.
+ *
+ * Divisors that are too small to benefit are delegated to
+ * divide_and_conquer_divide().
+ */
+DigitsDivisionResult
+newton_divide(const SmallVector<digit_type> &dividend,
+              const SmallVector<digit_type> &divisor);
 
 /**
  * @pre `high digit(divisor) >= DIGIT_BASE/2`
@@ -133,8 +179,8 @@ divide_and_conquer_divide(const std::vector<digit_type> &dividend,
  *     `DIGIT_BASE^n/2 <= divisor < DIGIT_BASE^n`
  */
 DigitsDivisionResult
-divide_normalized_2n_1n_split(const std::vector<digit_type> &dividend,
-                              const std::vector<digit_type> &divisor);
+divide_normalized_2n_1n_split(const SmallVector<digit_type> &dividend,
+                              const SmallVector<digit_type> &divisor);
 
 /**
  * @pre `high digit(divisor) >= DIGIT_BASE/2`
@@ -142,9 +188,42 @@ divide_normalized_2n_1n_split(const std::vector<digit_type> &dividend,
  *     `DIGIT_BASE^(2n)/2 <= divisor < DIGIT_BASE^(2n)`
  */
 DigitsDivisionResult
-divide_normalized_3n_2n_split(const std::vector<digit_type> &dividend,
-                              const std::vector<digit_type> &divisor);
+divide_normalized_3n_2n_split(const SmallVector<digit_type> &dividend,
+                              const SmallVector<digit_type> &divisor);
+
+/// @}
+
+/**
+ * @defgroup DigitsRemainderAlgorithms Digits Remainder Algorithms
+ *
+ * These algorithms implement the `remainder` routines.  Each produces the
+ * remainder of its counterpart in DigitsDivisionAlgorithms without storing
+ * the quotient, except for the pieces of it that are needed to compute the
+ * remainder.
+ *
+ * @param[in] dividend the value from which @p divisor is divided
+ * @param[in] divisor  the value by which @p dividend is divided
+ * @return the remainder
+ *
+ * @pre `divisor > 0`
+ * @pre `dividend > divisor`
+ */
+/// @{
+SmallVector<digit_type>
+long_divide_remainder(const SmallVector<digit_type> &dividend,
+                      const SmallVector<digit_type> &divisor);
+
+SmallVector<digit_type>
+long_divide_remainder(const SmallVector<digit_type> &dividend,
+                      std::uintmax_t                 divisor);
+
+SmallVector<digit_type>
+divide_and_conquer_divide_remainder(const SmallVector<digit_type> &dividend,
+                                    const SmallVector<digit_type> &divisor);
 
+SmallVector<digit_type>
+newton_divide_remainder(const SmallVector<digit_type> &dividend,
+                        const SmallVector<digit_type> &divisor);
 /// @}
 
 } // namespace detail
@@ -0,0 +1,321 @@
+#include "tasty_int/detail/digits_montgomery.hpp"
+
+#include <cassert>
+
+#include <algorithm>
+#include <array>
+#include <span>
+
+#include "tasty_int/detail/digit_from_nonnegative_value.hpp"
+#include "tasty_int/detail/digits_view.hpp"
+#include "tasty_int/detail/trailing_zero.hpp"
+#include "tasty_int/detail/digits_comparison.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+namespace {
+
+/**
+ * The number of exponent bits consumed per multiplication by pow_mod().
+ */
+constexpr unsigned int POW_MOD_WINDOW_BITS = 4;
+
+static_assert((DIGIT_TYPE_BITS % POW_MOD_WINDOW_BITS) == 0);
+
+/**
+ * @return `-(odd_digit^-1) mod DIGIT_BASE`
+ *
+ * @details An odd value is its own inverse modulo 8, and each Newton step
+ *     `x' = x*(2 - d*x)` doubles the number of correct low bits.
+ */
+digit_type
+negated_inverse_of_odd_digit(digit_type odd_digit)
+{
+    assert((odd_digit & 1) == 1);
+
+    digit_accumulator_type inverse = odd_digit;
+    for (unsigned int correct_bits = 3; correct_bits < DIGIT_TYPE_BITS;
+         correct_bits *= 2)
+        inverse *= digit_accumulator_type(2) - (odd_digit * inverse);
+
+    return digit_from_nonnegative_value(digit_accumulator_type(0) - inverse);
+}
+
+/**
+ * @brief Subtracts @p modulus from @p digits in place, discarding the final
+ *     borrow.
+ */
+void
+subtract_modulus(DigitsView             modulus,
+                 std::span<digit_type>  digits)
+{
+    digit_accumulator_type borrow = 0;
+
+    for (std::size_t i = 0; i < modulus.size(); ++i) {
+        digit_accumulator_type difference = digits[i];
+        difference -= modulus[i];
+        difference -= borrow;
+
+        digits[i] = digit_from_nonnegative_value(difference);
+        borrow    = (difference >> DIGIT_TYPE_BITS) != 0;
+    }
+}
+
+/**
+ * @return `digits >= modulus`, where both are of magnitude `modulus.size()`
+ */
+bool
+is_at_least_modulus(DigitsView modulus,
+                    DigitsView digits)
+{
+    return !std::lexicographical_compare(digits.rbegin(),  digits.rend(),
+                                         modulus.rbegin(), modulus.rend());
+}
+
+/**
+ * @brief Computes `lhs*rhs*DIGIT_BASE^-n mod modulus` into the low `n` digits
+ *     of @p product by the CIOS method.
+ *
+ * @details Each digit of @p rhs adds one row of the product into the scratch
+ *     digits, then adds the multiple of @p modulus that zeros their least
+ *     significant digit and shifts them down by one digit.  The scratch value
+ *     remains below `2*modulus` throughout, so one final subtraction reduces
+ *     it.
+ *
+ * @param[in]  lhs             `n` digits, `< modulus`
+ * @param[in]  rhs             `n` digits, `< modulus`
+ * @param[in]  modulus         `n` digits, odd
+ * @param[in]  modulus_inverse `-(modulus^-1) mod DIGIT_BASE`
+ * @param[out] product         `n + 2` digits, aliasing neither operand
+ */
+void
+montgomery_multiply(DigitsView             lhs,
+                    DigitsView             rhs,
+                    DigitsView             modulus,
+                    digit_type             modulus_inverse,
+                    std::span<digit_type>  product)
+{
+    auto n = modulus.size();
+
+    assert(lhs.size()     == n);
+    assert(rhs.size()     == n);
+    assert(product.size() == (n + 2));
+
+    std::fill(product.begin(), product.end(), 0);
+
+    for (digit_accumulator_type rhs_digit : rhs) {
+        digit_accumulator_type accumulator;
+        digit_accumulator_type carry = 0;
+
+        for (std::size_t i = 0; i < n; ++i) {
+            accumulator  = lhs[i] * rhs_digit;
+            accumulator += product[i];
+            accumulator += carry;
+
+            product[i] = digit_from_nonnegative_value(accumulator);
+            carry      = accumulator >> DIGIT_TYPE_BITS;
+        }
+        accumulator    = product[n] + carry;
+        product[n]     = digit_from_nonnegative_value(accumulator);
+        product[n + 1] = digit_from_nonnegative_value(
+            accumulator >> DIGIT_TYPE_BITS
+        );
+
+        digit_accumulator_type quotient_digit = digit_from_nonnegative_value(
+            product[0] * digit_accumulator_type(modulus_inverse)
+        );
+
+        accumulator  = modulus[0] * quotient_digit;
+        accumulator += product[0];
+        carry        = accumulator >> DIGIT_TYPE_BITS;
+
+        for (std::size_t i = 1; i < n; ++i) {
+            accumulator  = modulus[i] * quotient_digit;
+            accumulator += product[i];
+            accumulator += carry;
+
+            product[i - 1] = digit_from_nonnegative_value(accumulator);
+            carry          = accumulator >> DIGIT_TYPE_BITS;
+        }
+        accumulator    = product[n] + carry;
+        product[n - 1] = digit_from_nonnegative_value(accumulator);
+        product[n]     = digit_from_nonnegative_value(
+            product[n + 1] + (accumulator >> DIGIT_TYPE_BITS)
+        );
+    }
+
+    auto low_product = product.first(n);
+    if ((product[n] != 0) || is_at_least_modulus(modulus, low_product))
+        subtract_modulus(modulus, low_product);
+}
+
+/**
+ * @return @p digits padded with leading zeros to @p size digits
+ */
+SmallVector<digit_type>
+widen(const SmallVector<digit_type>      &digits,
+      SmallVector<digit_type>::size_type  size)
+{
+    auto wide_digits = digits;
+    wide_digits.resize(size);
+
+    return wide_digits;
+}
+
+/**
+ * @return the low @p size digits of @p digits without leading zeros
+ */
+SmallVector<digit_type>
+narrow(const SmallVector<digit_type>      &digits,
+       SmallVector<digit_type>::size_type  size)
+{
+    SmallVector<digit_type> narrow_digits(digits.begin(),
+                                          digits.begin() + size);
+    trim_trailing_zeros(narrow_digits);
+
+    return narrow_digits;
+}
+
+DigitsView
+low_digits(const SmallVector<digit_type>      &digits,
+           SmallVector<digit_type>::size_type  size)
+{
+    return DigitsView(digits.data(), size);
+}
+
+SmallVector<digit_type>
+montgomery_multiply(const SmallVector<digit_type> &lhs,
+                    const SmallVector<digit_type> &rhs,
+                    const SmallVector<digit_type> &modulus,
+                    digit_type                     modulus_inverse)
+{
+    auto n = modulus.size();
+
+    SmallVector<digit_type> product(n + 2);
+    montgomery_multiply(widen(lhs, n), widen(rhs, n), modulus, modulus_inverse,
+                        product);
+
+    return narrow(product, n);
+}
+
+SmallVector<digit_type>
+digit_base_power(SmallVector<digit_type>::size_type exponent)
+{
+    SmallVector<digit_type> power(exponent + 1, 0);
+    power.back() = 1;
+
+    return power;
+}
+
+} // namespace
+
+
+DigitsMontgomeryContext::DigitsMontgomeryContext(
+    const SmallVector<digit_type> &digits
+)
+    : divisor(digits)
+    , modulus_inverse(negated_inverse_of_odd_digit(digits.front()))
+    , r_squared(divisor.reduce(digit_base_power(digits.size() * 2)))
+{}
+
+SmallVector<digit_type>
+DigitsMontgomeryContext::to_montgomery(
+    const SmallVector<digit_type> &digits
+) const
+{
+    const auto &modulus = value();
+
+    if (digits < modulus)
+        return montgomery_multiply(digits, r_squared, modulus,
+                                   modulus_inverse);
+
+    return montgomery_multiply(divisor.reduce(digits), r_squared, modulus,
+                               modulus_inverse);
+}
+
+SmallVector<digit_type>
+DigitsMontgomeryContext::from_montgomery(
+    const SmallVector<digit_type> &digits
+) const
+{
+    assert(digits < value());
+
+    return montgomery_multiply(digits, { 1 }, value(), modulus_inverse);
+}
+
+SmallVector<digit_type>
+DigitsMontgomeryContext::multiply(const SmallVector<digit_type> &lhs,
+                                  const SmallVector<digit_type> &rhs) const
+{
+    assert(lhs < value());
+    assert(rhs < value());
+
+    return montgomery_multiply(lhs, rhs, value(), modulus_inverse);
+}
+
+SmallVector<digit_type>
+DigitsMontgomeryContext::square(const SmallVector<digit_type> &digits) const
+{
+    assert(digits < value());
+
+    return montgomery_multiply(digits, digits, value(), modulus_inverse);
+}
+
+SmallVector<digit_type>
+DigitsMontgomeryContext::pow_mod(const SmallVector<digit_type> &base,
+                                 const SmallVector<digit_type> &exponent) const
+{
+    constexpr digit_type WINDOW_MASK = (digit_type(1) << POW_MOD_WINDOW_BITS)
+                                     - 1;
+
+    const auto &modulus = value();
+    auto n              = modulus.size();
+    auto modulus_view   = low_digits(modulus, n);
+
+    // every buffer holds n + 2 digits so that products may be swapped in
+    SmallVector<digit_type> scratch(n + 2);
+
+    std::array<SmallVector<digit_type>, WINDOW_MASK + 1> window_powers;
+    window_powers[0] = widen(to_montgomery({ 1 }), n + 2);
+    window_powers[1] = widen(to_montgomery(base),  n + 2);
+    for (std::size_t i = 2; i < window_powers.size(); ++i) {
+        montgomery_multiply(low_digits(window_powers[i - 1], n),
+                            low_digits(window_powers[1],     n),
+                            modulus_view, modulus_inverse, scratch);
+        window_powers[i] = scratch;
+    }
+
+    auto accumulator = window_powers[0];
+    auto multiply_accumulator = [&](const SmallVector<digit_type> &factor) {
+        montgomery_multiply(low_digits(accumulator, n), low_digits(factor, n),
+                            modulus_view, modulus_inverse, scratch);
+        swap(accumulator, scratch);
+    };
+
+    bool have_window = false;
+    for (auto digit_cursor = exponent.rbegin();
+         digit_cursor != exponent.rend(); ++digit_cursor) {
+        for (unsigned int shift = DIGIT_TYPE_BITS; shift > 0; ) {
+            shift -= POW_MOD_WINDOW_BITS;
+
+            auto window = (*digit_cursor >> shift) & WINDOW_MASK;
+
+            if (have_window) {
+                for (unsigned int i = 0; i < POW_MOD_WINDOW_BITS; ++i)
+                    multiply_accumulator(accumulator);
+
+                if (window != 0)
+                    multiply_accumulator(window_powers[window]);
+            } else if (window != 0) {
+                accumulator = window_powers[window];
+                have_window = true;
+            }
+        }
+    }
+
+    return from_montgomery(narrow(accumulator, n));
+}
+
+} // namespace detail
+} // namespace tasty_int
@@ -2,16 +2,22 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 
 #include <algorithm>
+#include <array>
 #include <utility>
+#include <vector>
 
 #include "tasty_int/detail/digit_from_nonnegative_value.hpp"
+#include "tasty_int/detail/invariant_digit_divisor.hpp"
+#include "tasty_int/detail/tuning_thresholds.hpp"
 #include "tasty_int/detail/is_zero.hpp"
 #include "tasty_int/detail/trailing_zero.hpp"
 #include "tasty_int/detail/order_by_size.hpp"
 #include "tasty_int/detail/split_digits.hpp"
 #include "tasty_int/detail/integral_digits_view.hpp"
+#include "tasty_int/detail/number_theoretic_transform.hpp"
 #include "tasty_int/detail/digits_bitwise.hpp"
 #include "tasty_int/detail/digits_addition.hpp"
 #include "tasty_int/detail/digits_subtraction.hpp"
@@ -22,24 +28,25 @@ namespace tasty_int {
 namespace detail {
 namespace {
 
-std::vector<digit_type>
+SmallVector<digit_type>
 allocate_result(std::size_t lhs_size,
                 std::size_t rhs_size)
 {
-    std::vector<digit_type> result(lhs_size + rhs_size);
+    SmallVector<digit_type> result(lhs_size + rhs_size);
 
     return result;
 }
 
 void
-long_multiply_digit(const std::vector<digit_type>    &lhs,
-                    digit_type                        rhs_digit,
-                    std::vector<digit_type>::iterator result_cursor)
+long_multiply_digit(SmallVector<digit_type>::const_iterator lhs_begin,
+                    SmallVector<digit_type>::const_iterator lhs_end,
+                    digit_type                              rhs_digit,
+                    SmallVector<digit_type>::iterator       result_cursor)
 {
     digit_accumulator_type carry = 0;
 
-    for (auto lhs_digit : lhs) {
-        digit_accumulator_type accumulator = lhs_digit;
+    for (; lhs_begin != lhs_end; ++lhs_begin) {
+        digit_accumulator_type accumulator = *lhs_begin;
         accumulator *= rhs_digit;
         accumulator += carry;
         accumulator += *result_cursor;
@@ -51,8 +58,17 @@ long_multiply_digit(const std::vector<digit_type>    &lhs,
     *result_cursor = digit_from_nonnegative_value(carry);
 }
 
-std::vector<digit_type>
-long_multiply_digit(const std::vector<digit_type> &lhs,
+void
+long_multiply_digit(DigitsView                        lhs,
+                    digit_type                        rhs_digit,
+                    SmallVector<digit_type>::iterator result_cursor)
+{
+    long_multiply_digit(lhs.data(), lhs.data() + lhs.size(), rhs_digit,
+                        result_cursor);
+}
+
+SmallVector<digit_type>
+long_multiply_digit(const SmallVector<digit_type> &lhs,
                     digit_type                    rhs_digit)
 {
     auto result = allocate_result(lhs.size(), 1);
@@ -65,9 +81,9 @@ long_multiply_digit(const std::vector<digit_type> &lhs,
 }
 
 void
-long_multiply_digits(const std::vector<digit_type> &lhs,
-                     const std::vector<digit_type> &rhs,
-                     std::vector<digit_type>       &result)
+long_multiply_digits(DigitsView               lhs,
+                     DigitsView               rhs,
+                     SmallVector<digit_type> &result)
 {
     auto result_cursor = result.begin();
 
@@ -76,9 +92,9 @@ long_multiply_digits(const std::vector<digit_type> &lhs,
 }
 
 void
-long_multiply_digits(const std::vector<digit_type> &lhs,
+long_multiply_digits(const SmallVector<digit_type> &lhs,
                      IntegralDigitsView             rhs_view,
-                     std::vector<digit_type>       &result)
+                     SmallVector<digit_type>       &result)
 {
     auto result_cursor = result.begin();
 
@@ -88,78 +104,690 @@ long_multiply_digits(const std::vector<digit_type> &lhs,
         long_multiply_digit(lhs, rhs_view.high_digit(), ++result_cursor);
 }
 
-std::vector<digit_type>
-karatsuba_multiply_trivial(const std::vector<digit_type> &smaller,
-                           const std::vector<digit_type> &larger)
+using codegen::LONG_MULTIPLY_THRESHOLD_MAGNITUDE;
+using codegen::LONG_SQUARE_THRESHOLD_MAGNITUDE;
+using codegen::KARATSUBA_MULTIPLY_THRESHOLD_MAGNITUDE;
+using codegen::KARATSUBA_SQUARE_THRESHOLD_MAGNITUDE;
+using codegen::TOOM_3_MULTIPLY_THRESHOLD_MAGNITUDE;
+using codegen::TOOM_3_SQUARE_THRESHOLD_MAGNITUDE;
+
+void
+add_range_in_place(SmallVector<digit_type>::const_iterator addend_cursor,
+                   SmallVector<digit_type>::const_iterator addend_end,
+                   SmallVector<digit_type>::iterator       augend_cursor,
+                   SmallVector<digit_type>::const_iterator augend_end)
+{
+    digit_accumulator_type carry = 0;
+
+    for (; addend_cursor != addend_end; ++addend_cursor)
+        carry = add_at(carry + *addend_cursor, augend_cursor++);
+
+    [[maybe_unused]] auto overflow =
+        propagate_carry(carry, augend_cursor, augend_end);
+    assert(overflow == 0);
+}
+
+void
+subtract_range_in_place(
+    SmallVector<digit_type>::const_iterator subtrahend_cursor,
+    SmallVector<digit_type>::const_iterator subtrahend_end,
+    SmallVector<digit_type>::iterator       minuend_cursor,
+    SmallVector<digit_type>::const_iterator minuend_end
+)
+{
+    digit_accumulator_type borrow = 0;
+
+    for (; subtrahend_cursor != subtrahend_end; ++subtrahend_cursor) {
+        digit_accumulator_type subtrahend = *subtrahend_cursor;
+        subtrahend += borrow;
+
+        digit_accumulator_type minuend = *minuend_cursor;
+
+        borrow = (minuend < subtrahend);
+        *minuend_cursor++ = digit_from_nonnegative_value(minuend - subtrahend);
+    }
+
+    for (; (borrow != 0) && (minuend_cursor != minuend_end); ++minuend_cursor) {
+        borrow = (*minuend_cursor == 0);
+        *minuend_cursor = digit_from_nonnegative_value(
+            digit_accumulator_type(*minuend_cursor) - 1
+        );
+    }
+
+    assert(borrow == 0);
+}
+
+SmallVector<digit_type>::iterator
+sum_halves_into(SmallVector<digit_type>::const_iterator low_begin,
+                SmallVector<digit_type>::size_type      low_size,
+                SmallVector<digit_type>::size_type      high_size,
+                SmallVector<digit_type>::iterator       sum_cursor)
+{
+    assert(low_size <= high_size);
+
+    auto high_begin = low_begin + low_size;
+    auto sum_begin  = sum_cursor;
+
+    sum_cursor  = std::copy(high_begin, high_begin + high_size, sum_cursor);
+    *sum_cursor = 0;
+    ++sum_cursor;
+
+    add_range_in_place(low_begin, high_begin, sum_begin, sum_cursor);
+
+    return sum_cursor;
+}
+
+SmallVector<digit_type>::size_type
+size_without_trailing_zeros(SmallVector<digit_type>::const_iterator begin,
+                            SmallVector<digit_type>::size_type      size)
+{
+    while ((size > 0) && (begin[size - 1] == 0))
+        --size;
+
+    return size;
+}
+
+void
+long_multiply_range(SmallVector<digit_type>::const_iterator smaller_begin,
+                    SmallVector<digit_type>::size_type      smaller_size,
+                    SmallVector<digit_type>::const_iterator larger_begin,
+                    SmallVector<digit_type>::size_type      larger_size,
+                    SmallVector<digit_type>::iterator       result_cursor)
+{
+    std::fill_n(result_cursor, smaller_size + larger_size, 0);
+
+    auto larger_end = larger_begin + larger_size;
+
+    for (auto smaller_end = smaller_begin + smaller_size;
+         smaller_begin != smaller_end; ++smaller_begin)
+        long_multiply_digit(larger_begin,
+                            larger_end,
+                            *smaller_begin,
+                            result_cursor++);
+}
+
+void
+long_square_cross_products(
+    SmallVector<digit_type>::const_iterator digits_begin,
+    SmallVector<digit_type>::const_iterator digits_end,
+    SmallVector<digit_type>::iterator       result_cursor
+)
+{
+    // accumulate digits[i] * digits[j] for every i < j at result[i + j]
+    ++result_cursor;
+
+    while (digits_begin != digits_end) {
+        auto digit = *digits_begin++;
+
+        long_multiply_digit(digits_begin, digits_end, digit, result_cursor);
+
+        result_cursor += 2;
+    }
+}
+
+void
+double_in_place(SmallVector<digit_type>::iterator       result_cursor,
+                SmallVector<digit_type>::const_iterator result_end)
+{
+    digit_type carry = 0;
+
+    for (; result_cursor != result_end; ++result_cursor) {
+        auto next_carry = *result_cursor >> (DIGIT_TYPE_BITS - 1);
+
+        *result_cursor = digit_from_nonnegative_value(
+            (digit_accumulator_type(*result_cursor) << 1) | carry
+        );
+        carry = next_carry;
+    }
+
+    assert(carry == 0);
+}
+
+void
+long_square_add_diagonal(SmallVector<digit_type>::const_iterator digits_begin,
+                         SmallVector<digit_type>::const_iterator digits_end,
+                         SmallVector<digit_type>::iterator       result_cursor)
+{
+    digit_accumulator_type carry = 0;
+
+    for (; digits_begin != digits_end; ++digits_begin) {
+        digit_accumulator_type digit       = *digits_begin;
+        digit_accumulator_type accumulator = digit * digit;
+        accumulator += carry;
+        accumulator += *result_cursor;
+
+        *result_cursor++ = digit_from_nonnegative_value(accumulator);
+
+        accumulator >>= DIGIT_TYPE_BITS;
+        accumulator  += *result_cursor;
+
+        *result_cursor++ = digit_from_nonnegative_value(accumulator);
+        carry = accumulator >> DIGIT_TYPE_BITS;
+    }
+
+    assert(carry == 0);
+}
+
+void
+long_square_range(SmallVector<digit_type>::const_iterator digits_begin,
+                  SmallVector<digit_type>::size_type      digits_size,
+                  SmallVector<digit_type>::iterator       result_cursor)
+{
+    auto digits_end = digits_begin + digits_size;
+    auto result_end = result_cursor + (digits_size * 2);
+
+    std::fill(result_cursor, result_end, 0);
+
+    long_square_cross_products(digits_begin, digits_end, result_cursor);
+
+    double_in_place(result_cursor, result_end);
+
+    long_square_add_diagonal(digits_begin, digits_end, result_cursor);
+}
+
+/**
+ * Subtracts the low and high products, which occupy the result, from the sum
+ * product and adds the difference into the middle of the result.
+ */
+void
+karatsuba_merge_range(SmallVector<digit_type>::size_type      split_size,
+                      SmallVector<digit_type>::iterator       sum_product_begin,
+                      SmallVector<digit_type>::size_type      sum_product_size,
+                      SmallVector<digit_type>::iterator       result_begin,
+                      SmallVector<digit_type>::size_type      result_size)
+{
+    auto result_middle    = result_begin + (split_size * 2);
+    auto result_end       = result_begin + result_size;
+    auto sum_product_end  = sum_product_begin + sum_product_size;
+
+    subtract_range_in_place(result_begin, result_middle,
+                            sum_product_begin, sum_product_end);
+    subtract_range_in_place(result_middle, result_end,
+                            sum_product_begin, sum_product_end);
+
+    sum_product_size = size_without_trailing_zeros(sum_product_begin,
+                                                   sum_product_size);
+    assert(sum_product_size <= (result_size - split_size));
+
+    add_range_in_place(sum_product_begin,
+                       sum_product_begin + sum_product_size,
+                       result_begin + split_size,
+                       result_end);
+}
+
+bool
+is_long_multiply_range_case(SmallVector<digit_type>::size_type smaller_size,
+                            SmallVector<digit_type>::size_type larger_size)
+{
+    // splitting fewer than 4 smaller digits does not shrink the operands of
+    // the sum product
+    return (larger_size <= LONG_MULTIPLY_THRESHOLD_MAGNITUDE)
+        || (smaller_size < 4);
+}
+
+/**
+ * The number of scratch digits needed by karatsuba_multiply_range().
+ *
+ * @note Assumes that the scratch needed by the sum product, whose operands
+ *     are at least as large as those of the low and high products, dominates.
+ */
+SmallVector<digit_type>::size_type
+karatsuba_multiply_scratch_size(SmallVector<digit_type>::size_type smaller_size,
+                                SmallVector<digit_type>::size_type larger_size)
+{
+    if (is_long_multiply_range_case(smaller_size, larger_size))
+        return 0;
+
+    const auto split_size = smaller_size / 2;
+
+    auto smaller_sum_size = smaller_size - split_size + 1;
+    auto larger_sum_size  = larger_size  - split_size + 1;
+    auto sums_size        = smaller_sum_size + larger_sum_size;
+
+    return (sums_size * 2)
+         + karatsuba_multiply_scratch_size(smaller_sum_size, larger_sum_size);
+}
+
+/**
+ * Writes the `smaller_size + larger_size` digits of the product into
+ * @p result_begin.  Sums and the sum product are written into the scratch
+ * range, and recursive calls reuse the scratch that follows them.
+ */
+void
+karatsuba_multiply_range(SmallVector<digit_type>::const_iterator smaller_begin,
+                         SmallVector<digit_type>::size_type      smaller_size,
+                         SmallVector<digit_type>::const_iterator larger_begin,
+                         SmallVector<digit_type>::size_type      larger_size,
+                         SmallVector<digit_type>::iterator       result_begin,
+                         SmallVector<digit_type>::iterator       scratch_begin,
+                         SmallVector<digit_type>::const_iterator scratch_end)
+{
+    assert(smaller_size <= larger_size);
+
+    if (is_long_multiply_range_case(smaller_size, larger_size)) {
+        long_multiply_range(smaller_begin, smaller_size,
+                            larger_begin,  larger_size,
+                            result_begin);
+        return;
+    }
+
+    const auto split_size = smaller_size / 2;
+
+    auto smaller_high_size = smaller_size - split_size;
+    auto larger_high_size  = larger_size  - split_size;
+
+    karatsuba_multiply_range(smaller_begin, split_size,
+                             larger_begin,  split_size,
+                             result_begin,
+                             scratch_begin, scratch_end);
+
+    karatsuba_multiply_range(smaller_begin + split_size, smaller_high_size,
+                             larger_begin  + split_size, larger_high_size,
+                             result_begin  + (split_size * 2),
+                             scratch_begin, scratch_end);
+
+    auto smaller_sum_begin = scratch_begin;
+    auto larger_sum_begin  = sum_halves_into(smaller_begin,
+                                             split_size,
+                                             smaller_high_size,
+                                             smaller_sum_begin);
+    auto sum_product_begin = sum_halves_into(larger_begin,
+                                             split_size,
+                                             larger_high_size,
+                                             larger_sum_begin);
+
+    auto smaller_sum_size = smaller_high_size + 1;
+    auto larger_sum_size  = larger_high_size  + 1;
+    auto sum_product_size = smaller_sum_size + larger_sum_size;
+    auto sum_product_end  = sum_product_begin + sum_product_size;
+    assert(sum_product_end <= scratch_end);
+
+    karatsuba_multiply_range(smaller_sum_begin, smaller_sum_size,
+                             larger_sum_begin,  larger_sum_size,
+                             sum_product_begin,
+                             sum_product_end, scratch_end);
+
+    karatsuba_merge_range(split_size,
+                          sum_product_begin, sum_product_size,
+                          result_begin,      smaller_size + larger_size);
+}
+
+/**
+ * The number of scratch digits needed by karatsuba_square_range().
+ */
+SmallVector<digit_type>::size_type
+karatsuba_square_scratch_size(SmallVector<digit_type>::size_type digits_size)
+{
+    if (digits_size <= LONG_SQUARE_THRESHOLD_MAGNITUDE)
+        return 0;
+
+    auto sum_size = digits_size - (digits_size / 2) + 1;
+
+    return (sum_size * 3) + karatsuba_square_scratch_size(sum_size);
+}
+
+/**
+ * Writes the `digits_size * 2` digits of the square into @p result_begin,
+ * using the scratch range as karatsuba_multiply_range() does.
+ */
+void
+karatsuba_square_range(SmallVector<digit_type>::const_iterator digits_begin,
+                       SmallVector<digit_type>::size_type      digits_size,
+                       SmallVector<digit_type>::iterator       result_begin,
+                       SmallVector<digit_type>::iterator       scratch_begin,
+                       SmallVector<digit_type>::const_iterator scratch_end)
+{
+    if (digits_size <= LONG_SQUARE_THRESHOLD_MAGNITUDE) {
+        long_square_range(digits_begin, digits_size, result_begin);
+        return;
+    }
+
+    const auto split_size = digits_size / 2;
+
+    auto high_size = digits_size - split_size;
+
+    karatsuba_square_range(digits_begin, split_size,
+                           result_begin,
+                           scratch_begin, scratch_end);
+
+    karatsuba_square_range(digits_begin + split_size, high_size,
+                           result_begin + (split_size * 2),
+                           scratch_begin, scratch_end);
+
+    auto sum_begin         = scratch_begin;
+    auto sum_product_begin = sum_halves_into(digits_begin,
+                                             split_size,
+                                             high_size,
+                                             sum_begin);
+
+    auto sum_size         = high_size + 1;
+    auto sum_product_size = sum_size * 2;
+    auto sum_product_end  = sum_product_begin + sum_product_size;
+    assert(sum_product_end <= scratch_end);
+
+    karatsuba_square_range(sum_begin, sum_size,
+                           sum_product_begin,
+                           sum_product_end, scratch_end);
+
+    karatsuba_merge_range(split_size,
+                          sum_product_begin, sum_product_size,
+                          result_begin,      digits_size * 2);
+}
+
+struct ToomCookTerm
+{
+    Sign                    sign;
+    SmallVector<digit_type> digits;
+}; // struct ToomCookTerm
+
+ToomCookTerm
+make_toom_cook_term(SmallVector<digit_type> &&digits)
+{
+    Sign sign = is_zero(digits) ? Sign::ZERO : Sign::POSITIVE;
+
+    return { .sign = sign, .digits = std::move(digits) };
+}
+
+void
+add_term_in_place(Sign                           addend_sign,
+                  const SmallVector<digit_type> &addend_digits,
+                  ToomCookTerm                  &augend)
+{
+    if (is_zero(addend_digits))
+        return;
+
+    if (augend.sign == Sign::ZERO) {
+        augend.sign   = addend_sign;
+        augend.digits = addend_digits;
+    } else if (augend.sign == addend_sign) {
+        augend.digits += addend_digits;
+    } else {
+        augend.sign *= subtract_in_place(addend_digits, augend.digits);
+    }
+}
+
+void
+add_term_in_place(const ToomCookTerm &addend,
+                  ToomCookTerm       &augend)
+{
+    add_term_in_place(addend.sign, addend.digits, augend);
+}
+
+void
+subtract_term_in_place(const ToomCookTerm &subtrahend,
+                       ToomCookTerm       &minuend)
 {
-    if (smaller.front() > 1)
-        return long_multiply_digit(larger, smaller.front());
+    add_term_in_place(-subtrahend.sign, subtrahend.digits, minuend);
+}
 
-    return (smaller.front() == 0) ? smaller : larger;
+ToomCookTerm
+multiply_terms(const ToomCookTerm &lhs,
+               const ToomCookTerm &rhs)
+{
+    return { .sign = lhs.sign * rhs.sign, .digits = lhs.digits * rhs.digits };
 }
 
-struct KaratsubaPartiion
+void
+double_term_in_place(ToomCookTerm &term)
 {
-    std::vector<digit_type>::size_type split_size;
-    std::vector<digit_type>            low_product;
-    std::vector<digit_type>            high_product;
-    std::vector<digit_type>            sum_product;
-}; // struct KaratsubaPartiion
+    term.digits = term.digits << DigitsShiftOffset{ .digits = 0, .bits = 1 };
+}
+
+void
+halve_exact_term_in_place(ToomCookTerm &term)
+{
+    term.digits >>= DigitsShiftOffset{ .digits = 0, .bits = 1 };
+}
+
+void
+divide_exact_term_in_place(digit_type    divisor,
+                           ToomCookTerm &term)
+{
+    auto &digits = term.digits;
+
+    InvariantDigitDivisor invariant_divisor(divisor);
+
+    digit_type remainder = 0;
+    for (auto cursor = digits.rbegin(); cursor != digits.rend(); ++cursor) {
+        auto digit_result = invariant_divisor.divide(remainder, *cursor);
+
+        *cursor   = digit_result.quotient;
+        remainder = digit_result.remainder;
+    }
+
+    assert(remainder == 0);
 
-KaratsubaPartiion
-karatsuba_partition(const std::vector<digit_type>      &smaller,
-                    const std::vector<digit_type>      &larger,
-                    std::vector<digit_type>::size_type  split_size)
+    trim_trailing_zeros(digits);
+}
+
+/**
+ * The values of a 3-piece polynomial `p(x) = piece[2]*x^2 + piece[1]*x +
+ * piece[0]` at the Toom-3 evaluation points.
+ */
+struct ToomThreeEvaluation
+{
+    ToomCookTerm at_zero;
+    ToomCookTerm at_one;
+    ToomCookTerm at_negative_one;
+    ToomCookTerm at_negative_two;
+    ToomCookTerm at_infinity;
+}; // struct ToomThreeEvaluation
+
+ToomThreeEvaluation
+toom_3_evaluate(DigitsView                          digits,
+                SmallVector<digit_type>::size_type  split_size)
 {
+    auto [low, middle, high] = split_digits<3>(digits, split_size);
 
-    auto [smaller_low, smaller_high] = split_digits<2>(smaller, split_size);
-    auto [larger_low,  larger_high]  = split_digits<2>(larger,  split_size);
+    ToomThreeEvaluation result;
 
-    struct KaratsubaPartiion result;
+    auto low_plus_high = low + high;
 
-    result.split_size   = split_size;
-    result.low_product  = smaller_low  * larger_low;
-    result.high_product = smaller_high * larger_high;
-    result.sum_product  = (smaller_low + smaller_high)
-                        * (larger_low  + larger_high);
+    result.at_one = make_toom_cook_term(low_plus_high + middle);
+
+    result.at_negative_one = make_toom_cook_term(std::move(low_plus_high));
+    add_term_in_place(Sign::NEGATIVE, middle, result.at_negative_one);
+
+    result.at_negative_two = result.at_negative_one;
+    add_term_in_place(Sign::POSITIVE, high, result.at_negative_two);
+    double_term_in_place(result.at_negative_two);
+    add_term_in_place(Sign::NEGATIVE, low, result.at_negative_two);
+
+    result.at_zero     = make_toom_cook_term(std::move(low));
+    result.at_infinity = make_toom_cook_term(std::move(high));
 
     return result;
 }
 
-std::vector<digit_type>
-karatsuba_merge(KaratsubaPartiion                  &partition,
-                std::vector<digit_type>::size_type  max_result_size)
+/**
+ * The coefficients of the product polynomial, `r(x) = p(x) * q(x)`, ordered
+ * from least to most significant.
+ */
+typedef std::array<ToomCookTerm, 5> ToomThreeCoefficients;
+
+ToomThreeCoefficients
+toom_3_interpolate(const ToomThreeEvaluation &lhs,
+                   const ToomThreeEvaluation &rhs)
 {
-    auto split_size    = partition.split_size;
-    auto &low_product  = partition.low_product;
-    auto &high_product = partition.high_product;
-    auto &result       = partition.sum_product;
+    auto r0    = multiply_terms(lhs.at_zero,         rhs.at_zero);
+    auto r1    = multiply_terms(lhs.at_one,          rhs.at_one);
+    auto rm1   = multiply_terms(lhs.at_negative_one, rhs.at_negative_one);
+    auto r3    = multiply_terms(lhs.at_negative_two, rhs.at_negative_two);
+    auto rinf  = multiply_terms(lhs.at_infinity,     rhs.at_infinity);
+
+    // r3 = (r(-2) - r(1)) / 3
+    subtract_term_in_place(r1, r3);
+    divide_exact_term_in_place(3, r3);
+
+    // r1 = (r(1) - r(-1)) / 2
+    subtract_term_in_place(rm1, r1);
+    halve_exact_term_in_place(r1);
+
+    // r2 = r(-1) - r(0)
+    auto &r2 = rm1;
+    subtract_term_in_place(r0, r2);
+
+    // r3 = (r2 - r3) / 2 + 2*r(infinity)
+    auto next_r3 = r2;
+    subtract_term_in_place(r3, next_r3);
+    halve_exact_term_in_place(next_r3);
+    add_term_in_place(rinf, next_r3);
+    add_term_in_place(rinf, next_r3);
+    r3 = std::move(next_r3);
+
+    // r2 = r2 + r1 - r(infinity)
+    add_term_in_place(r1, r2);
+    subtract_term_in_place(rinf, r2);
+
+    // r1 = r1 - r3
+    subtract_term_in_place(r3, r1);
+
+    return {
+        std::move(r0), std::move(r1), std::move(r2), std::move(r3),
+        std::move(rinf)
+    };
+}
 
-    result.reserve(max_result_size);
+void
+add_at_offset(const SmallVector<digit_type>      &addend,
+              SmallVector<digit_type>::size_type  offset,
+              SmallVector<digit_type>            &result)
+{
+    add_range_in_place(addend.begin(), addend.end(),
+                       result.begin() + offset, result.end());
+}
 
-    [[maybe_unused]] auto sign1 = subtract_in_place(high_product, result);
-    assert(sign1 >= Sign::ZERO);
+SmallVector<digit_type>
+toom_3_merge(const ToomThreeCoefficients        &coefficients,
+             SmallVector<digit_type>::size_type  split_size,
+             SmallVector<digit_type>::size_type  smaller_size,
+             SmallVector<digit_type>::size_type  larger_size)
+{
+    auto result = allocate_result(smaller_size, larger_size);
 
-    [[maybe_unused]] auto sign2 = subtract_in_place(low_product, result);
-    assert(sign2 >= Sign::ZERO);
+    SmallVector<digit_type>::size_type offset = 0;
+    for (const auto &coefficient : coefficients) {
+        assert(coefficient.sign >= Sign::ZERO);
 
-    result <<= split_size;
+        add_at_offset(coefficient.digits, offset, result);
 
-    result += low_product;
+        offset += split_size;
+    }
 
-    high_product <<= (split_size * 2);
+    trim_trailing_zeros(result);
 
-    result += high_product;
+    return result;
+}
 
-    assert((max_result_size - result.size()) <= 1);
+constexpr unsigned int WORD_BITS = 32;
 
-    return std::move(result);
+static_assert(((DIGIT_TYPE_BITS % WORD_BITS) == 0) ||
+              ((WORD_BITS % DIGIT_TYPE_BITS) == 0));
+
+std::vector<std::uint32_t>::size_type
+words_size_from_digits_size(SmallVector<digit_type>::size_type digits_size)
+{
+    if constexpr (DIGIT_TYPE_BITS >= WORD_BITS) {
+        constexpr auto WORDS_PER_DIGIT = DIGIT_TYPE_BITS / WORD_BITS;
+
+        return digits_size * WORDS_PER_DIGIT;
+    } else {
+        constexpr auto DIGITS_PER_WORD = WORD_BITS / DIGIT_TYPE_BITS;
+
+        return (digits_size + DIGITS_PER_WORD - 1) / DIGITS_PER_WORD;
+    }
+}
+
+std::vector<std::uint32_t>
+words_from_digits(DigitsView digits)
+{
+    std::vector<std::uint32_t> words;
+    words.reserve(words_size_from_digits_size(digits.size()));
+
+    if constexpr (DIGIT_TYPE_BITS >= WORD_BITS) {
+        for (digit_accumulator_type digit : digits)
+            for (unsigned int shift = 0; shift < DIGIT_TYPE_BITS;
+                 shift += WORD_BITS)
+                words.emplace_back(static_cast<std::uint32_t>(digit >> shift));
+    } else {
+        unsigned int shift = 0;
+        for (std::uint32_t digit : digits) {
+            if (shift == 0)
+                words.emplace_back(0);
+
+            words.back() |= (digit << shift);
+            shift         = (shift + DIGIT_TYPE_BITS) % WORD_BITS;
+        }
+    }
+
+    while ((words.size() > 1) && (words.back() == 0))
+        words.pop_back();
+
+    return words;
+}
+
+SmallVector<digit_type>
+digits_from_words(const std::vector<std::uint32_t> &words)
+{
+    SmallVector<digit_type> digits;
+
+    if constexpr (DIGIT_TYPE_BITS >= WORD_BITS) {
+        constexpr auto WORDS_PER_DIGIT = DIGIT_TYPE_BITS / WORD_BITS;
+
+        digits.reserve((words.size() + WORDS_PER_DIGIT - 1) / WORDS_PER_DIGIT);
+
+        unsigned int shift = 0;
+        for (digit_accumulator_type word : words) {
+            if (shift == 0)
+                digits.emplace_back(0);
+
+            digits.back() |= digit_from_nonnegative_value(word << shift);
+            shift          = (shift + WORD_BITS) % DIGIT_TYPE_BITS;
+        }
+    } else {
+        constexpr auto DIGITS_PER_WORD = WORD_BITS / DIGIT_TYPE_BITS;
+
+        digits.reserve(words.size() * DIGITS_PER_WORD);
+
+        for (std::uint32_t word : words)
+            for (unsigned int shift = 0; shift < WORD_BITS;
+                 shift += DIGIT_TYPE_BITS)
+                digits.emplace_back(digit_from_nonnegative_value(word >> shift));
+    }
+
+    trim_trailing_zeros(digits);
+
+    return digits;
+}
+
+bool
+is_same_view(DigitsView lhs,
+             DigitsView rhs)
+{
+    return (lhs.data() == rhs.data())
+        && (lhs.size() == rhs.size());
+}
+
+SmallVector<digit_type>
+multiply_by_number_theoretic_transform(DigitsView smaller,
+                                       DigitsView larger)
+{
+    auto smaller_words = words_from_digits(smaller);
+
+    // the transform of a squared operand may be computed once
+    auto product_words = is_same_view(smaller, larger)
+        ? number_theoretic_transform_multiply_words(smaller_words,
+                                                    smaller_words)
+        : number_theoretic_transform_multiply_words(smaller_words,
+                                                    words_from_digits(larger));
+
+    return digits_from_words(product_words);
 }
 
 template<typename RhsType>
-std::vector<digit_type> &
+SmallVector<digit_type> &
 times_equals(const RhsType           &multiplier,
-             std::vector<digit_type> &multiplicand)
+             SmallVector<digit_type> &multiplicand)
 {
     multiplicand = multiplicand * multiplier;
 
@@ -169,30 +797,30 @@ times_equals(const RhsType           &multiplier,
 } // namespace
 
 
-std::vector<digit_type> &
-operator*=(std::vector<digit_type>       &lhs,
-           const std::vector<digit_type> &rhs)
+SmallVector<digit_type> &
+operator*=(SmallVector<digit_type>       &lhs,
+           const SmallVector<digit_type> &rhs)
 {
     return times_equals(rhs, lhs);
 }
 
-std::vector<digit_type> &
-operator*=(std::vector<digit_type> &lhs,
+SmallVector<digit_type> &
+operator*=(SmallVector<digit_type> &lhs,
            std::uintmax_t           rhs)
 {
     return times_equals(rhs, lhs);
 }
 
-std::vector<digit_type> &
-operator*=(std::vector<digit_type> &lhs,
+SmallVector<digit_type> &
+operator*=(SmallVector<digit_type> &lhs,
            long double              rhs)
 {
     return times_equals(rhs, lhs);
 }
 
-std::vector<digit_type>
-operator*(const std::vector<digit_type> &lhs,
-          const std::vector<digit_type> &rhs)
+SmallVector<digit_type>
+operator*(const SmallVector<digit_type> &lhs,
+          const SmallVector<digit_type> &rhs)
 {
     assert(!lhs.empty());
     assert(!have_trailing_zero(lhs));
@@ -200,11 +828,11 @@ operator*(const std::vector<digit_type> &lhs,
     assert(!rhs.empty());
     assert(!have_trailing_zero(rhs));
 
-    return karatsuba_multiply(rhs, lhs);
+    return multiply_digits(lhs, rhs);
 }
 
-std::vector<digit_type>
-operator*(const std::vector<digit_type> &lhs,
+SmallVector<digit_type>
+operator*(const SmallVector<digit_type> &lhs,
           std::uintmax_t                 rhs)
 {
     assert(!lhs.empty());
@@ -224,15 +852,15 @@ operator*(const std::vector<digit_type> &lhs,
     return result;
 }
 
-std::vector<digit_type>
+SmallVector<digit_type>
 operator*(std::uintmax_t                 lhs,
-          const std::vector<digit_type> &rhs)
+          const SmallVector<digit_type> &rhs)
 {
     return rhs * lhs;
 }
 
-std::vector<digit_type>
-operator*(const std::vector<digit_type> &lhs,
+SmallVector<digit_type>
+operator*(const SmallVector<digit_type> &lhs,
           long double                    rhs)
 {
     assert(std::isfinite(rhs));
@@ -241,22 +869,29 @@ operator*(const std::vector<digit_type> &lhs,
     return lhs * conversions::digits_from_floating_point(rhs);
 }
 
-std::vector<digit_type>
+SmallVector<digit_type>
 operator*(long double                    lhs,
-          const std::vector<digit_type> &rhs)
+          const SmallVector<digit_type> &rhs)
 {
     return rhs * lhs;
 }
 
-std::vector<digit_type>
-long_multiply(const std::vector<digit_type> &lhs,
-              const std::vector<digit_type> &rhs)
+SmallVector<digit_type>
+multiply_digits(DigitsView lhs,
+                DigitsView rhs)
 {
-    if (is_zero(lhs))
-        return lhs;
+    if (is_same_view(lhs, rhs) || std::ranges::equal(lhs, rhs))
+        return number_theoretic_transform_square(lhs);
 
-    if (is_zero(rhs))
-        return rhs;
+    return unbalanced_multiply(rhs, lhs);
+}
+
+SmallVector<digit_type>
+long_multiply(DigitsView lhs,
+              DigitsView rhs)
+{
+    if (is_zero(lhs) || is_zero(rhs))
+        return { 0 };
 
     auto result = allocate_result(lhs.size(), rhs.size());
 
@@ -267,29 +902,174 @@ long_multiply(const std::vector<digit_type> &lhs,
     return result;
 }
 
-std::vector<digit_type>
-karatsuba_multiply(const std::vector<digit_type> &lhs,
-                   const std::vector<digit_type> &rhs)
+SmallVector<digit_type>
+karatsuba_multiply(DigitsView lhs,
+                   DigitsView rhs)
 {
-    /// @todo TODO: tune
-    constexpr std::vector<digit_type>::size_type 
-        LONG_MULTIPLY_THRESHOLD_MAGNTIUDE = 100;
+    auto [smaller, larger] = order_by_size(lhs, rhs);
+
+    if ((larger.size() <= LONG_MULTIPLY_THRESHOLD_MAGNITUDE) ||
+        is_zero(smaller))
+        return long_multiply(smaller, larger);
+
+    auto result = allocate_result(smaller.size(), larger.size());
+
+    SmallVector<digit_type> scratch(
+        karatsuba_multiply_scratch_size(smaller.size(), larger.size())
+    );
+
+    karatsuba_multiply_range(smaller.data(), smaller.size(),
+                             larger.data(),  larger.size(),
+                             result.begin(),
+                             scratch.begin(), scratch.end());
+
+    trim_trailing_zero(result);
+
+    return result;
+}
+
+SmallVector<digit_type>
+toom_3_multiply(DigitsView lhs,
+                DigitsView rhs)
+{
+    auto [smaller, larger] = order_by_size(lhs, rhs);
+
+    if (larger.size() <= KARATSUBA_MULTIPLY_THRESHOLD_MAGNITUDE)
+        return karatsuba_multiply(smaller, larger);
+
+    const auto split_size = (larger.size() + 2) / 3;
+
+    if (smaller.size() <= (split_size * 2))
+        return karatsuba_multiply(smaller, larger);
 
-    const auto &[smaller, larger] = order_by_size(lhs, rhs);
+    auto smaller_evaluation = toom_3_evaluate(smaller, split_size);
+    auto larger_evaluation  = toom_3_evaluate(larger,  split_size);
 
-    if (larger.size() <= LONG_MULTIPLY_THRESHOLD_MAGNTIUDE)
+    auto coefficients = toom_3_interpolate(smaller_evaluation,
+                                           larger_evaluation);
+
+    return toom_3_merge(coefficients,
+                        split_size,
+                        smaller.size(),
+                        larger.size());
+}
+
+SmallVector<digit_type>
+number_theoretic_transform_multiply(DigitsView lhs,
+                                    DigitsView rhs)
+{
+    auto [smaller, larger] = order_by_size(lhs, rhs);
+
+    auto convolution_size = words_size_from_digits_size(smaller.size())
+                          + words_size_from_digits_size(larger.size());
+
+    if ((smaller.size() <= TOOM_3_MULTIPLY_THRESHOLD_MAGNITUDE) ||
+        (convolution_size > NUMBER_THEORETIC_TRANSFORM_MAX_SIZE))
+        return toom_3_multiply(smaller, larger);
+
+    return multiply_by_number_theoretic_transform(smaller, larger);
+}
+
+SmallVector<digit_type>
+unbalanced_multiply(DigitsView lhs,
+                    DigitsView rhs)
+{
+    auto [smaller, larger] = order_by_size(lhs, rhs);
+
+    // Toom-3 declines operands that are this unbalanced
+    if ((larger.size() * 2) < (smaller.size() * 3))
+        return number_theoretic_transform_multiply(smaller, larger);
+
+    if (smaller.size() <= LONG_MULTIPLY_THRESHOLD_MAGNITUDE)
         return long_multiply(smaller, larger);
 
-    if (smaller.size() == 1)
-        return karatsuba_multiply_trivial(smaller, larger);
+    auto result = allocate_result(smaller.size(), larger.size());
+
+    SmallVector<digit_type> chunk;
+    chunk.reserve(smaller.size());
+
+    for (SmallVector<digit_type>::size_type offset = 0; offset < larger.size();
+         offset += smaller.size()) {
+        auto chunk_size  = std::min(smaller.size(), larger.size() - offset);
+        auto chunk_begin = larger.begin() + offset;
+
+        chunk.assign(chunk_begin, chunk_begin + chunk_size);
+        trim_trailing_zeros(chunk);
+
+        if (!is_zero(chunk))
+            add_at_offset(multiply_digits(chunk, smaller), offset, result);
+    }
+
+    trim_trailing_zero(result);
+
+    return result;
+}
+
+SmallVector<digit_type>
+long_square(DigitsView digits)
+{
+    if (is_zero(digits))
+        return { 0 };
 
-    const auto split_size = smaller.size() / 2;
+    auto result = allocate_result(digits.size(), digits.size());
+
+    long_square_range(digits.data(), digits.size(), result.begin());
+
+    trim_trailing_zero(result);
+
+    return result;
+}
+
+SmallVector<digit_type>
+karatsuba_square(DigitsView digits)
+{
+    if ((digits.size() <= LONG_SQUARE_THRESHOLD_MAGNITUDE) || is_zero(digits))
+        return long_square(digits);
 
-    auto &&partition = karatsuba_partition(smaller, larger, split_size);
+    auto result = allocate_result(digits.size(), digits.size());
+
+    SmallVector<digit_type> scratch(
+        karatsuba_square_scratch_size(digits.size())
+    );
+
+    karatsuba_square_range(digits.data(), digits.size(),
+                           result.begin(),
+                           scratch.begin(), scratch.end());
+
+    trim_trailing_zero(result);
+
+    return result;
+}
+
+SmallVector<digit_type>
+toom_3_square(DigitsView digits)
+{
+    if (digits.size() <= KARATSUBA_SQUARE_THRESHOLD_MAGNITUDE)
+        return karatsuba_square(digits);
+
+    const auto split_size = (digits.size() + 2) / 3;
+
+    auto evaluation = toom_3_evaluate(digits, split_size);
+
+    // interpolating an evaluation against itself squares each point value
+    auto coefficients = toom_3_interpolate(evaluation, evaluation);
+
+    return toom_3_merge(coefficients,
+                        split_size,
+                        digits.size(),
+                        digits.size());
+}
+
+SmallVector<digit_type>
+number_theoretic_transform_square(DigitsView digits)
+{
+    auto convolution_size = words_size_from_digits_size(digits.size()) * 2;
 
-    auto max_result_size = smaller.size() + larger.size();
+    if ((digits.size() <= TOOM_3_SQUARE_THRESHOLD_MAGNITUDE) ||
+        (convolution_size > NUMBER_THEORETIC_TRANSFORM_MAX_SIZE))
+        return toom_3_square(digits);
 
-    return karatsuba_merge(partition, max_result_size);
+    return multiply_by_number_theoretic_transform(digits, digits);
 }
 
 } // namespace detail
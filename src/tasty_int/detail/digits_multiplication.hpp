@@ -1,9 +1,9 @@
 #ifndef TASTY_INT_TASTY_INT_DETAIL_DIGITS_MULTIPLICATION_HPP
 #define TASTY_INT_TASTY_INT_DETAIL_DIGITS_MULTIPLICATION_HPP
 
-#include <vector>
-
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/digits_view.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 
 
 namespace tasty_int {
@@ -12,19 +12,19 @@ namespace detail {
 /**
  * @defgroup DigitsMultiplicationOperators Digits Multiplication Operators
  *
- * These operations operate on little-endian `std::vector`s of `digit_type`.
+ * These operations operate on little-endian `SmallVector`s of `digit_type`.
  *
  * @pre input digits vectors must be non-empty
  * @pre input digits may have no leading zeros
  * @pre every element of input digits vectors must be `<= DIGIT_TYPE_MAX`
  */
 /// @{
-std::vector<digit_type> &
-operator*=(std::vector<digit_type>       &lhs,
-           const std::vector<digit_type> &rhs);
+SmallVector<digit_type> &
+operator*=(SmallVector<digit_type>       &lhs,
+           const SmallVector<digit_type> &rhs);
 
-std::vector<digit_type> &
-operator*=(std::vector<digit_type> &lhs,
+SmallVector<digit_type> &
+operator*=(SmallVector<digit_type> &lhs,
            std::uintmax_t           rhs);
 
 /**
@@ -36,33 +36,51 @@ operator*=(std::vector<digit_type> &lhs,
  * @pre floating point operand is finite and nonnegative
  */
 /// @ingroup DigitsMultiplicationFloatingPointOverloads
-std::vector<digit_type> &
-operator*=(std::vector<digit_type> &lhs,
+SmallVector<digit_type> &
+operator*=(SmallVector<digit_type> &lhs,
            long double              rhs);
 
-std::vector<digit_type>
-operator*(const std::vector<digit_type> &lhs,
-          const std::vector<digit_type> &rhs);
+SmallVector<digit_type>
+operator*(const SmallVector<digit_type> &lhs,
+          const SmallVector<digit_type> &rhs);
 
-std::vector<digit_type>
-operator*(const std::vector<digit_type> &lhs,
+SmallVector<digit_type>
+operator*(const SmallVector<digit_type> &lhs,
           std::uintmax_t                 rhs);
 
-std::vector<digit_type>
+SmallVector<digit_type>
 operator*(std::uintmax_t                 lhs,
-          const std::vector<digit_type> &rhs);
+          const SmallVector<digit_type> &rhs);
 
 /// @ingroup DigitsMultiplicationFloatingPointOverloads
-std::vector<digit_type>
-operator*(const std::vector<digit_type> &lhs,
+SmallVector<digit_type>
+operator*(const SmallVector<digit_type> &lhs,
           long double                    rhs);
 
 /// @ingroup DigitsMultiplicationFloatingPointOverloads
-std::vector<digit_type>
+SmallVector<digit_type>
 operator*(long double                    lhs,
-          const std::vector<digit_type> &rhs);
+          const SmallVector<digit_type> &rhs);
 /// @}
 
+/**
+ * @brief Multiplies two read-only digit sequences.
+ *
+ * Unlike `operator*`, the operands need not be owned by a `SmallVector`, so
+ * that digits borrowed from other storage may be multiplied without first
+ * being copied.
+ *
+ * @param[in] lhs the left-hand multiplicand
+ * @param[in] rhs the right-hand multiplicand
+ * @return the product
+ *
+ * @pre input digits must be non-empty
+ * @pre input digits may have no leading zeros
+ */
+SmallVector<digit_type>
+multiply_digits(DigitsView lhs,
+                DigitsView rhs);
+
 
 /**
  * @defgroup DigitsMultiplicationAlgorithms Digits Multiplication Algorithms
@@ -74,13 +92,97 @@ operator*(long double                    lhs,
  * @pre every element of input digits vectors must be `<= DIGIT_TYPE_MAX`
  */
 /// @{
-std::vector<digit_type>
-long_multiply(const std::vector<digit_type> &lhs,
-              const std::vector<digit_type> &rhs);
+SmallVector<digit_type>
+long_multiply(DigitsView lhs,
+              DigitsView rhs);
+
+SmallVector<digit_type>
+karatsuba_multiply(DigitsView lhs,
+                   DigitsView rhs);
+
+/**
+ * Implements Toom-Cook 3-way multiplication, evaluating at the points
+ * `{ 0, 1, -1, -2, infinity }` and interpolating according to the sequence
+ * outlined in section 4 of Bodrato and Zanoni's publication:
+ *
+ *     Marco Bodrato and Alberto Zanoni. Integer and Polynomial
+ *     Multiplication: Towards Optimal Toom-Cook Matrices. Proceedings of the
+ *     2007 International Symposium on Symbolic and Algebraic Computation
+ *     (ISSAC '07), pages 17-24, 2007.
+ *
+ * Operands that are too small or too unbalanced to be split into three
+ * pieces are delegated to karatsuba_multiply().
+ */
+SmallVector<digit_type>
+toom_3_multiply(DigitsView lhs,
+                DigitsView rhs);
+
+/**
+ * Multiplies operands by convolving their 32-bit words modulo three
+ * word-sized primes with number-theoretic transforms and reconstructing the
+ * exact product with the Chinese Remainder Theorem.
+ *
+ * Operands that are below the transform threshold, or whose product exceeds
+ * the maximum transform size, are delegated to toom_3_multiply().
+ */
+SmallVector<digit_type>
+number_theoretic_transform_multiply(DigitsView lhs,
+                                    DigitsView rhs);
+
+/**
+ * Multiplies operands of very different sizes by cutting the larger operand
+ * into chunks the size of the smaller operand, multiplying each chunk by the
+ * smaller operand with `operator*`, and accumulating the products at their
+ * chunk offsets.
+ *
+ * Operands that are balanced enough are delegated to
+ * number_theoretic_transform_multiply(), and operands whose smaller member is
+ * small enough are delegated to long_multiply().
+ */
+SmallVector<digit_type>
+unbalanced_multiply(DigitsView lhs,
+                    DigitsView rhs);
+
+/**
+ * Squares @p digits, computing each cross product `digits[i] * digits[j]`
+ * (`i != j`) once, doubling their sum, and then adding the squares of the
+ * individual digits.
+ */
+SmallVector<digit_type>
+long_square(DigitsView digits);
 
-std::vector<digit_type>
-karatsuba_multiply(const std::vector<digit_type> &lhs,
-                   const std::vector<digit_type> &rhs);
+/**
+ * Squares @p digits by splitting it into `high*B + low` and computing
+ *
+ *     (high*B + low)^2 = high^2*B^2
+ *                      + ((low + high)^2 - low^2 - high^2)*B
+ *                      + low^2
+ *
+ * so that every recursive step is itself a squaring.
+ *
+ * Operands that are too small to be split are delegated to long_square().
+ */
+SmallVector<digit_type>
+karatsuba_square(DigitsView digits);
+
+/**
+ * Squares @p digits with Toom-Cook 3-way multiplication, evaluating the split
+ * operand only once and squaring its value at each evaluation point.
+ *
+ * Operands that are too small to be split are delegated to karatsuba_square().
+ */
+SmallVector<digit_type>
+toom_3_square(DigitsView digits);
+
+/**
+ * Squares @p digits with number-theoretic transforms, transforming the
+ * operand only once per prime.
+ *
+ * Operands that are below the transform threshold, or whose square exceeds
+ * the maximum transform size, are delegated to toom_3_square().
+ */
+SmallVector<digit_type>
+number_theoretic_transform_square(DigitsView digits);
 
 /// @}
 
@@ -21,15 +21,15 @@ namespace detail {
 namespace {
 
 void
-make_zero(std::vector<digit_type> &digits)
+make_zero(SmallVector<digit_type> &digits)
 {
     digits.front() = 0;
     digits.resize(1);
 }
 
 void
-pad_minuend(std::vector<digit_type>::size_type  subtrahend_size,
-            std::vector<digit_type>            &minuend)
+pad_minuend(SmallVector<digit_type>::size_type  subtrahend_size,
+            SmallVector<digit_type>            &minuend)
 {
     if (minuend.size() < subtrahend_size)
         minuend.resize(subtrahend_size);
@@ -44,15 +44,15 @@ make_digit_complement(ArithmeticType value)
 }
 
 void
-make_digit_compliment(std::vector<digit_type> &digits)
+make_digit_compliment(SmallVector<digit_type> &digits)
 {
     for (digit_type &digit : digits)
         digit = make_digit_complement(digit);
 }
 
 digit_accumulator_type
-fixed_add(const std::vector<digit_type> &addend,
-          std::vector<digit_type>       &augend)
+fixed_add(const SmallVector<digit_type> &addend,
+          SmallVector<digit_type>       &augend)
 {
     auto [carry, augend_cursor] = add_into(addend, augend);
 
@@ -60,8 +60,8 @@ fixed_add(const std::vector<digit_type> &addend,
 }
 
 digit_accumulator_type
-add_with_end_around_carry(const std::vector<digit_type> &addend,
-                          std::vector<digit_type>       &augend)
+add_with_end_around_carry(const SmallVector<digit_type> &addend,
+                          SmallVector<digit_type>       &augend)
 {
     auto carry = fixed_add(addend, augend);
 
@@ -73,8 +73,8 @@ add_with_end_around_carry(const std::vector<digit_type> &addend,
 digit_accumulator_type
 propagate_complement_carry(
     digit_accumulator_type                  carry,
-    std::vector<digit_type>::iterator       augend_cursor,
-    std::vector<digit_type>::const_iterator augend_end
+    SmallVector<digit_type>::iterator       augend_cursor,
+    SmallVector<digit_type>::const_iterator augend_end
 )
 {
     while (++augend_cursor != augend_end)
@@ -86,7 +86,7 @@ propagate_complement_carry(
 digit_accumulator_type
 fixed_add_complement(digit_accumulator_type   addend_low,
                      digit_accumulator_type   addend_high,
-                     std::vector<digit_type> &augend)
+                     SmallVector<digit_type> &augend)
 {
     auto cursor = augend.begin();
 
@@ -105,7 +105,7 @@ fixed_add_complement(digit_accumulator_type   addend_low,
 digit_accumulator_type
 add_complement_with_end_around_carry(digit_accumulator_type   addend_low,
                                      digit_accumulator_type   addend_high,
-                                     std::vector<digit_type> &augend)
+                                     SmallVector<digit_type> &augend)
 {
     auto carry = fixed_add_complement(addend_low,
                                       addend_high,
@@ -118,7 +118,7 @@ add_complement_with_end_around_carry(digit_accumulator_type   addend_low,
 
 digit_accumulator_type
 fixed_add_complement(long double              addend,
-                     std::vector<digit_type> &augend)
+                     SmallVector<digit_type> &augend)
 {
     FloatingPointDigitsIterator addend_cursor(addend);
     digit_accumulator_type carry = 0;
@@ -147,7 +147,7 @@ truncation_correction(long double addend,
 
 digit_accumulator_type
 add_complement_with_end_around_carry(long double              addend,
-                                     std::vector<digit_type> &augend)
+                                     SmallVector<digit_type> &augend)
 {
     long double ceil_addend = std::ceil(addend);
     auto carry = fixed_add_complement(ceil_addend, augend);
@@ -160,23 +160,23 @@ add_complement_with_end_around_carry(long double              addend,
     return carry;
 }
 
-std::vector<digit_type>
-make_padded_digits(std::vector<digit_type>::size_type operand_size,
-                   std::vector<digit_type>::size_type other_operand_size)
+SmallVector<digit_type>
+make_padded_digits(SmallVector<digit_type>::size_type operand_size,
+                   SmallVector<digit_type>::size_type other_operand_size)
 {
-    std::vector<digit_type>::size_type padded_digits_size =
+    SmallVector<digit_type>::size_type padded_digits_size =
         std::max(operand_size, other_operand_size);
 
-    std::vector<digit_type> padded_digits(padded_digits_size);
+    SmallVector<digit_type> padded_digits(padded_digits_size);
 
     return padded_digits;
 }
 
-std::vector<digit_type>
-make_padded_minuend(const std::vector<digit_type>      &minuend,
-                    std::vector<digit_type>::size_type  subtrahend_size)
+SmallVector<digit_type>
+make_padded_minuend(const SmallVector<digit_type>      &minuend,
+                    SmallVector<digit_type>::size_type  subtrahend_size)
 {
-    std::vector<digit_type> padded_minuend =
+    SmallVector<digit_type> padded_minuend =
         make_padded_digits(minuend.size(), subtrahend_size);
 
     std::copy(minuend.begin(), minuend.end(), padded_minuend.begin());
@@ -184,15 +184,15 @@ make_padded_minuend(const std::vector<digit_type>      &minuend,
     return padded_minuend;
 }
 
-std::vector<digit_type>
+SmallVector<digit_type>
 make_padded_minuend(std::uintmax_t                     minuend,
-                    std::vector<digit_type>::size_type subtrahend_size)
+                    SmallVector<digit_type>::size_type subtrahend_size)
 {
     IntegralDigitsView minuend_view(minuend);
 
     auto minuend_size = minuend_view.digits_size();
 
-    std::vector<digit_type> padded_minuend =
+    SmallVector<digit_type> padded_minuend =
         make_padded_digits(minuend_size, subtrahend_size);
 
     padded_minuend[0] = minuend_view.low_digit();
@@ -202,13 +202,13 @@ make_padded_minuend(std::uintmax_t                     minuend,
     return padded_minuend;
 }
 
-std::vector<digit_type>
+SmallVector<digit_type>
 make_padded_subtrahend(long double                    minuend,
-                       const std::vector<digit_type> &subtrahend)
+                       const SmallVector<digit_type> &subtrahend)
 {
     auto minuend_size = size_digits_from_nonnegative_floating_point(minuend);
 
-    std::vector<digit_type> padded_subtrahend =
+    SmallVector<digit_type> padded_subtrahend =
         make_padded_digits(minuend_size, subtrahend.size());
 
     std::copy(subtrahend.begin(), subtrahend.end(), padded_subtrahend.begin());
@@ -219,7 +219,7 @@ make_padded_subtrahend(long double                    minuend,
 Sign
 complete_subtract(digit_accumulator_type   carry,
                   Sign                     carried_sign,
-                  std::vector<digit_type> &minuend)
+                  SmallVector<digit_type> &minuend)
 {
     Sign tentative_sign = carried_sign;
 
@@ -234,8 +234,8 @@ complete_subtract(digit_accumulator_type   carry,
 }
 
 Sign
-minuend_compliment_subtract_in_place(const std::vector<digit_type> &subtrahend,
-                                     std::vector<digit_type>       &minuend)
+minuend_compliment_subtract_in_place(const SmallVector<digit_type> &subtrahend,
+                                     SmallVector<digit_type>       &minuend)
 {
     make_digit_compliment(minuend);
 
@@ -245,8 +245,8 @@ minuend_compliment_subtract_in_place(const std::vector<digit_type> &subtrahend,
 }
 
 Sign
-subtract_distinct_in_place(const std::vector<digit_type> &subtrahend,
-                           std::vector<digit_type>       &minuend)
+subtract_distinct_in_place(const SmallVector<digit_type> &subtrahend,
+                           SmallVector<digit_type>       &minuend)
 {
     pad_minuend(subtrahend.size(), minuend);
 
@@ -254,9 +254,9 @@ subtract_distinct_in_place(const std::vector<digit_type> &subtrahend,
 }
 
 template<typename MinuendType>
-std::pair<Sign, std::vector<digit_type>>
+std::pair<Sign, SmallVector<digit_type>>
 minuend_compliment_subtract(const MinuendType             &minuend,
-                            const std::vector<digit_type> &subtrahend)
+                            const SmallVector<digit_type> &subtrahend)
 {
     auto result_digits = make_padded_minuend(minuend, subtrahend.size());
 
@@ -270,8 +270,8 @@ minuend_compliment_subtract(const MinuendType             &minuend,
 
 
 Sign
-subtract_in_place(const std::vector<digit_type> &subtrahend,
-                  std::vector<digit_type>       &minuend)
+subtract_in_place(const SmallVector<digit_type> &subtrahend,
+                  SmallVector<digit_type>       &minuend)
 {
     assert(!subtrahend.empty());
     assert(!minuend.empty());
@@ -288,7 +288,7 @@ subtract_in_place(const std::vector<digit_type> &subtrahend,
 
 Sign
 subtract_in_place(std::uintmax_t           subtrahend,
-                  std::vector<digit_type> &minuend)
+                  SmallVector<digit_type> &minuend)
 {
     assert(!minuend.empty());
 
@@ -307,7 +307,7 @@ subtract_in_place(std::uintmax_t           subtrahend,
 
 Sign
 subtract_in_place(long double              subtrahend,
-                  std::vector<digit_type> &minuend)
+                  SmallVector<digit_type> &minuend)
 {
     assert(std::isfinite(subtrahend));
     assert(subtrahend >= 0.0L);
@@ -321,9 +321,9 @@ subtract_in_place(long double              subtrahend,
     return complete_subtract(carry, Sign::POSITIVE, minuend);
 }
 
-std::pair<Sign, std::vector<digit_type>>
-subtract(const std::vector<digit_type> &minuend,
-         const std::vector<digit_type> &subtrahend)
+std::pair<Sign, SmallVector<digit_type>>
+subtract(const SmallVector<digit_type> &minuend,
+         const SmallVector<digit_type> &subtrahend)
 {
     assert(!minuend.empty());
     assert(!subtrahend.empty());
@@ -331,18 +331,18 @@ subtract(const std::vector<digit_type> &minuend,
     return minuend_compliment_subtract(minuend, subtrahend);
 }
 
-std::pair<Sign, std::vector<digit_type>>
+std::pair<Sign, SmallVector<digit_type>>
 subtract(std::uintmax_t                 minuend,
-         const std::vector<digit_type> &subtrahend)
+         const SmallVector<digit_type> &subtrahend)
 {
     assert(!subtrahend.empty());
 
     return minuend_compliment_subtract(minuend, subtrahend);
 }
 
-std::pair<Sign, std::vector<digit_type>>
+std::pair<Sign, SmallVector<digit_type>>
 subtract(long double                    minuend,
-         const std::vector<digit_type> &subtrahend)
+         const SmallVector<digit_type> &subtrahend)
 {
     assert(std::isfinite(minuend));
     assert(minuend >= 0.0L);
@@ -4,9 +4,9 @@
 #include <cstdint>
 
 #include <utility>
-#include <vector>
 
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 #include "tasty_int/detail/sign.hpp"
 
 
@@ -16,7 +16,7 @@ namespace detail {
 /**
  * @defgroup DigitsSubtractionOperations Digits Subtraction Operations
  *
- * These operations operate on little-endian `std::vector`s of `digit_type`.
+ * These operations operate on little-endian `SmallVector`s of `digit_type`.
  * They produce the signed result of `minuend - subtrahend`.
  *
  * @pre all inputs must be nonnegative
@@ -37,12 +37,12 @@ namespace detail {
  */
 /// @{
 Sign
-subtract_in_place(const std::vector<digit_type> &subtrahend,
-                  std::vector<digit_type>       &minuend);
+subtract_in_place(const SmallVector<digit_type> &subtrahend,
+                  SmallVector<digit_type>       &minuend);
 
 Sign
 subtract_in_place(std::uintmax_t           subtrahend,
-                  std::vector<digit_type> &minuend);
+                  SmallVector<digit_type> &minuend);
 /**
  * @defgroup DigitsSubtractionFloatingPointOverloads Digits Subtraction Floating Point Overloads
  *
@@ -56,7 +56,7 @@ subtract_in_place(std::uintmax_t           subtrahend,
 /// @ingroup DigitsSubtractionFloatingPointOverloads
 Sign
 subtract_in_place(long double              subtrahend,
-                  std::vector<digit_type> &minuend);
+                  SmallVector<digit_type> &minuend);
 /// @}
 
 /**
@@ -70,18 +70,18 @@ subtract_in_place(long double              subtrahend,
  * @return `{ .first = <sign of result>, .second = <result digits> }`
  */
 /// @{
-std::pair<Sign, std::vector<digit_type>>
-subtract(const std::vector<digit_type> &minuend,
-         const std::vector<digit_type> &subtrahend);
+std::pair<Sign, SmallVector<digit_type>>
+subtract(const SmallVector<digit_type> &minuend,
+         const SmallVector<digit_type> &subtrahend);
 
-std::pair<Sign, std::vector<digit_type>>
+std::pair<Sign, SmallVector<digit_type>>
 subtract(std::uintmax_t                 minuend,
-         const std::vector<digit_type> &subtrahend);
+         const SmallVector<digit_type> &subtrahend);
 
 /// @ingroup DigitsSubtractionFloatingPointOverloads
-std::pair<Sign, std::vector<digit_type>>
+std::pair<Sign, SmallVector<digit_type>>
 subtract(long double                    minuend,
-         const std::vector<digit_type> &subtrahend);
+         const SmallVector<digit_type> &subtrahend);
 /// @}
 
 } // namespace detail
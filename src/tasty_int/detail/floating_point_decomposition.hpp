@@ -0,0 +1,152 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_FLOATING_POINT_DECOMPOSITION_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_FLOATING_POINT_DECOMPOSITION_HPP
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <bit>
+#include <limits>
+
+#include "tasty_int/detail/digit_from_nonnegative_value.hpp"
+#include "tasty_int/detail/digit_type.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+
+/**
+ * This struct holds the integral part of a nonnegative floating point value
+ * exactly as `mantissa * 2^exponent`.
+ */
+struct FloatingPointDecomposition
+{
+    /**
+     * The significant bits of the integral part.
+     */
+    digit_accumulator_type mantissa;
+
+    /**
+     * The binary exponent applied to mantissa.
+     */
+    std::size_t            exponent;
+}; // struct FloatingPointDecomposition
+
+/**
+ * @brief Splits the integral part of @p value into its mantissa bits and
+ *     binary exponent with std::frexp().
+ *
+ * @details The decomposition is exact for every finite value and takes
+ *     constant time, regardless of the magnitude of @p value.
+ *
+ * @param[in] value a nonnegative floating point value
+ * @return the decomposition of `std::trunc(value)`
+ *
+ * @pre `std::isfinite(value) && (value >= 0.0)`
+ */
+inline FloatingPointDecomposition
+decompose_nonnegative_floating_point(long double value)
+{
+    constexpr int MANTISSA_BITS = std::numeric_limits<long double>::digits;
+    static_assert(
+        MANTISSA_BITS <= std::numeric_limits<digit_accumulator_type>::digits
+    );
+
+    assert(std::isfinite(value));
+    assert(value >= 0.0L);
+
+    if (value < 1.0L)
+        return { .mantissa = 0, .exponent = 0 };
+
+    int  exponent;
+    auto scaled_fraction = std::ldexp(std::frexp(value, &exponent),
+                                      MANTISSA_BITS);
+
+    digit_accumulator_type mantissa;
+    if constexpr (MANTISSA_BITS <= std::numeric_limits<std::uint64_t>::digits)
+        mantissa = static_cast<std::uint64_t>(scaled_fraction);
+    else
+        mantissa = static_cast<digit_accumulator_type>(scaled_fraction);
+
+    // drop the fractional bits of values with fewer integral bits than
+    // MANTISSA_BITS
+    if (exponent < MANTISSA_BITS)
+        return {
+            .mantissa = mantissa >> (MANTISSA_BITS - exponent),
+            .exponent = 0
+        };
+
+    return {
+        .mantissa = mantissa,
+        .exponent = static_cast<std::size_t>(exponent - MANTISSA_BITS)
+    };
+}
+
+/**
+ * @brief Counts the number of digits spanned by @p decomposition.
+ *
+ * @param[in] decomposition a decomposed floating point value
+ * @return the number of digits required to represent @p decomposition, with
+ *     zero occupying a single digit
+ */
+inline std::size_t
+count_digits_from_decomposition(
+    const FloatingPointDecomposition &decomposition
+)
+{
+    constexpr unsigned int ACCUMULATOR_BITS =
+        std::numeric_limits<digit_accumulator_type>::digits;
+
+    if (decomposition.mantissa == 0)
+        return 1;
+
+    auto high_bits = static_cast<std::uint64_t>(
+        decomposition.mantissa >> (ACCUMULATOR_BITS / 2)
+    );
+    auto low_bits  = static_cast<std::uint64_t>(decomposition.mantissa);
+    std::size_t mantissa_bits =
+        (high_bits != 0) ? ((ACCUMULATOR_BITS / 2) + std::bit_width(high_bits))
+                         : std::bit_width(low_bits);
+
+    auto count_bits = mantissa_bits + decomposition.exponent;
+
+    return (count_bits + DIGIT_TYPE_BITS - 1) / DIGIT_TYPE_BITS;
+}
+
+/**
+ * @brief Retrieves a digit of @p decomposition.
+ *
+ * @param[in] decomposition a decomposed floating point value
+ * @param[in] digit_index   the little-endian index of the digit
+ * @return the digit at @p digit_index, or zero if @p decomposition does not
+ *     span @p digit_index
+ */
+inline digit_type
+digit_from_decomposition(const FloatingPointDecomposition &decomposition,
+                         std::size_t                       digit_index)
+{
+    constexpr std::size_t ACCUMULATOR_BITS =
+        std::numeric_limits<digit_accumulator_type>::digits;
+
+    std::size_t digit_offset = digit_index * DIGIT_TYPE_BITS;
+
+    if (digit_offset >= decomposition.exponent) {
+        auto shift = digit_offset - decomposition.exponent;
+
+        return (shift < ACCUMULATOR_BITS)
+             ? digit_from_nonnegative_value(decomposition.mantissa >> shift)
+             : 0;
+    }
+
+    auto shift = decomposition.exponent - digit_offset;
+
+    return (shift < DIGIT_TYPE_BITS)
+         ? digit_from_nonnegative_value(decomposition.mantissa << shift)
+         : 0;
+}
+
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_FLOATING_POINT_DECOMPOSITION_HPP
@@ -2,12 +2,12 @@
 #define TASTY_INT_TASTY_INT_DETAIL_FLOATING_POINT_DIGITS_ITERATOR_HPP
 
 #include <cassert>
-#include <cmath>
 #include <cstddef>
 
 #include <iterator>
+#include <limits>
 
-#include "tasty_int/detail/digit_from_nonnegative_value.hpp"
+#include "tasty_int/detail/floating_point_decomposition.hpp"
 
 
 namespace tasty_int {
@@ -16,6 +16,9 @@ namespace detail {
 /**
  * This class provides InputIterator access to the digits of a
  * nonnegative floating point value in little-endian order.
+ *
+ * The value is decomposed into its mantissa bits and binary exponent once on
+ * construction, such that each digit is produced by a single shift.
  */
 class FloatingPointDigitsIterator
 {
@@ -34,13 +37,13 @@ public:
      *
      * @param[in] value the floating point value
      *
-     * @pre @p value is nonnegative
+     * @pre @p value is finite and nonnegative
      */
     FloatingPointDigitsIterator(long double value)
-        : rem_value(value)
-    {
-        assert(value >= 0.0L);
-    }
+        : decomposition(decompose_nonnegative_floating_point(value))
+        , count_digits(count_digits_from_decomposition(decomposition))
+        , digit_index(0)
+    {}
 
     /**
      * @brief Dereference operator.
@@ -50,7 +53,7 @@ public:
     digit_type
     operator*() const
     {
-        return digit_from_nonnegative_value(rem_value);
+        return digit_from_decomposition(decomposition, digit_index);
     }
 
     /**
@@ -63,9 +66,7 @@ public:
     FloatingPointDigitsIterator &
     operator++()
     {
-        constexpr long double LONG_DOUBLE_DIGIT_BASE = DIGIT_BASE;
-
-        rem_value /= LONG_DOUBLE_DIGIT_BASE;
+        ++digit_index;
 
         return *this;
     }
@@ -80,7 +81,7 @@ public:
     FloatingPointDigitsIterator
     operator++(int)
     {
-        FloatingPointDigitsIterator prev(rem_value);
+        FloatingPointDigitsIterator prev = *this;
 
         ++*this;
 
@@ -88,54 +89,67 @@ public:
     }
 
     /**
-     * @brief Access the remaining floating point value.
+     * @brief Determines whether any nonzero digits remain.
      *
-     * @details FloatingPointDigitsIterator traverses its digits by repeatedly
-     *     dividing the input value by DIGIT_BASE and returning the remainder.
-     *     This accessor exposes the remaining value.
-     *
-     * @return the remaining value.
+     * @return true if the digits at and above the current digit are not all
+     *     zero
      */
-    long double
-    remaining_value() const
+    bool
+    has_remaining_digits() const
     {
-        return rem_value;
+        return (digit_index < count_digits)
+            && (decomposition.mantissa != 0);
     }
 
-private:
-    long double rem_value;
-}; // class FloatingPointDigitsIterator
+    /**
+     * @brief Equality operator.
+     *
+     * @param[in] lhs the left-hand side of the operator
+     * @param[in] rhs the right-hand side of the operator
+     * @return true if @p lhs and @p rhs will generate the same sequence of
+     *     digits
+     */
+    friend bool
+    operator==(const FloatingPointDigitsIterator &lhs,
+               const FloatingPointDigitsIterator &rhs)
+    {
+        auto lhs_remaining = lhs.get_remaining_decomposition();
+        auto rhs_remaining = rhs.get_remaining_decomposition();
 
+        return (lhs_remaining.mantissa == rhs_remaining.mantissa)
+            && (lhs_remaining.exponent == rhs_remaining.exponent);
+    }
 
-/**
- * @brief Equality operator.
- *
- * @param[in] lhs the left-hand side of the operator
- * @param[in] rhs the right-hand side of the operator
- * @return true if @p lhs and @p rhs will generate the same sequence of digits
- */
-inline bool
-operator==(FloatingPointDigitsIterator lhs,
-           FloatingPointDigitsIterator rhs)
-{
-    return std::floor(lhs.remaining_value())
-        == std::floor(rhs.remaining_value());
-}
+private:
+    /**
+     * Decomposes the remaining digits such that the mantissa has no trailing
+     * zero bits, which uniquely identifies the remaining sequence.
+     */
+    FloatingPointDecomposition
+    get_remaining_decomposition() const
+    {
+        if (!has_remaining_digits())
+            return { .mantissa = 0, .exponent = 0 };
+
+        auto remaining    = decomposition;
+        auto digit_offset = digit_index * DIGIT_TYPE_BITS;
+        if (remaining.exponent >= digit_offset) {
+            remaining.exponent -= digit_offset;
+        } else {
+            remaining.mantissa >>= (digit_offset - remaining.exponent);
+            remaining.exponent   = 0;
+        }
+
+        for (; (remaining.mantissa & 1) == 0; remaining.mantissa >>= 1)
+            ++remaining.exponent;
+
+        return remaining;
+    }
 
-/**
- * @brief Inequality operator.
- *
- * @param[in] lhs the left-hand side of the operator
- * @param[in] rhs the right-hand side of the operator
- * @return true if @p lhs and @p rhs will *not* generate the same sequence of
- *     digits
- */
-inline bool
-operator!=(FloatingPointDigitsIterator lhs,
-           FloatingPointDigitsIterator rhs)
-{
-    return !(lhs == rhs);
-}
+    FloatingPointDecomposition decomposition;
+    std::size_t                count_digits;
+    std::size_t                digit_index;
+}; // class FloatingPointDigitsIterator
 
 } // namespace detail
 } // namespace tasty_int
@@ -18,14 +18,14 @@ namespace {
 struct DigitsLess
 {
     bool
-    operator()(const std::vector<digit_type> &lhs,
-               const std::vector<digit_type> &rhs)
+    operator()(const SmallVector<digit_type> &lhs,
+               const SmallVector<digit_type> &rhs)
     {
         return lhs < rhs;
     }
 
     bool
-    operator()(const std::vector<digit_type> &lhs,
+    operator()(const SmallVector<digit_type> &lhs,
                std::intmax_t                  rhs)
     {
         return lhs < static_cast<std::uintmax_t>(rhs);
@@ -33,13 +33,13 @@ struct DigitsLess
 
     bool
     operator()(std::intmax_t                  lhs,
-               const std::vector<digit_type> &rhs)
+               const SmallVector<digit_type> &rhs)
     {
         return static_cast<std::uintmax_t>(lhs) < rhs;
     }
 
     bool
-    operator()(const std::vector<digit_type> &lhs,
+    operator()(const SmallVector<digit_type> &lhs,
                long double                    rhs)
     {
         return lhs < rhs;
@@ -47,7 +47,7 @@ struct DigitsLess
 
     bool
     operator()(long double                    lhs,
-               const std::vector<digit_type> &rhs)
+               const SmallVector<digit_type> &rhs)
     {
         return lhs < rhs;
     }
@@ -56,14 +56,14 @@ struct DigitsLess
 struct DigitsGreater
 {
     bool
-    operator()(const std::vector<digit_type> &lhs,
-               const std::vector<digit_type> &rhs)
+    operator()(const SmallVector<digit_type> &lhs,
+               const SmallVector<digit_type> &rhs)
     {
         return lhs > rhs;
     }
 
     bool
-    operator()(const std::vector<digit_type> &lhs,
+    operator()(const SmallVector<digit_type> &lhs,
                std::intmax_t                  rhs)
     {
         return lhs > static_cast<std::uintmax_t>(rhs);
@@ -71,13 +71,13 @@ struct DigitsGreater
 
     bool
     operator()(std::intmax_t                  lhs,
-               const std::vector<digit_type> &rhs)
+               const SmallVector<digit_type> &rhs)
     {
         return static_cast<std::uintmax_t>(lhs) > rhs;
     }
 
     bool
-    operator()(const std::vector<digit_type> &lhs,
+    operator()(const SmallVector<digit_type> &lhs,
                long double                    rhs)
     {
         return lhs > rhs;
@@ -85,7 +85,7 @@ struct DigitsGreater
 
     bool
     operator()(long double                    lhs,
-               const std::vector<digit_type> &rhs)
+               const SmallVector<digit_type> &rhs)
     {
         return lhs > rhs;
     }
@@ -94,14 +94,14 @@ struct DigitsGreater
 struct DigitsLessEqual
 {
     bool
-    operator()(const std::vector<digit_type> &lhs,
-               const std::vector<digit_type> &rhs)
+    operator()(const SmallVector<digit_type> &lhs,
+               const SmallVector<digit_type> &rhs)
     {
         return lhs <= rhs;
     }
 
     bool
-    operator()(const std::vector<digit_type> &lhs,
+    operator()(const SmallVector<digit_type> &lhs,
                std::intmax_t                  rhs)
     {
         return lhs <= static_cast<std::uintmax_t>(rhs);
@@ -109,13 +109,13 @@ struct DigitsLessEqual
 
     bool
     operator()(std::intmax_t                  lhs,
-               const std::vector<digit_type> &rhs)
+               const SmallVector<digit_type> &rhs)
     {
         return static_cast<std::uintmax_t>(lhs) <= rhs;
     }
 
     bool
-    operator()(const std::vector<digit_type> &lhs,
+    operator()(const SmallVector<digit_type> &lhs,
                long double                    rhs)
     {
         return lhs <= rhs;
@@ -123,7 +123,7 @@ struct DigitsLessEqual
 
     bool
     operator()(long double                    lhs,
-               const std::vector<digit_type> &rhs)
+               const SmallVector<digit_type> &rhs)
     {
         return lhs <= rhs;
     }
@@ -132,14 +132,14 @@ struct DigitsLessEqual
 struct DigitsGreaterEqual
 {
     bool
-    operator()(const std::vector<digit_type> &lhs,
-               const std::vector<digit_type> &rhs)
+    operator()(const SmallVector<digit_type> &lhs,
+               const SmallVector<digit_type> &rhs)
     {
         return lhs >= rhs;
     }
 
     bool
-    operator()(const std::vector<digit_type> &lhs,
+    operator()(const SmallVector<digit_type> &lhs,
                std::intmax_t                  rhs)
     {
         return lhs >= static_cast<std::uintmax_t>(rhs);
@@ -147,13 +147,13 @@ struct DigitsGreaterEqual
 
     bool
     operator()(std::intmax_t                  lhs,
-               const std::vector<digit_type> &rhs)
+               const SmallVector<digit_type> &rhs)
     {
         return static_cast<std::uintmax_t>(lhs) >= rhs;
     }
 
     bool
-    operator()(const std::vector<digit_type> &lhs,
+    operator()(const SmallVector<digit_type> &lhs,
                long double                    rhs)
     {
         return lhs >= rhs;
@@ -161,7 +161,7 @@ struct DigitsGreaterEqual
 
     bool
     operator()(long double                    lhs,
-               const std::vector<digit_type> &rhs)
+               const SmallVector<digit_type> &rhs)
     {
         return lhs >= rhs;
     }
@@ -255,6 +255,20 @@ greater_than_or_equal_to(const Integer &lhs,
 } // namespace
 
 
+std::strong_ordering
+compare(IntegerView lhs,
+        IntegerView rhs)
+{
+    if (lhs.sign != rhs.sign)
+        return lhs.sign <=> rhs.sign;
+
+    auto magnitude_ordering = compare_digits(lhs.digits, rhs.digits);
+
+    return (lhs.sign == Sign::NEGATIVE)
+         ? (0 <=> magnitude_ordering)
+         : magnitude_ordering;
+}
+
 bool
 operator==(const Integer &lhs,
            const Integer &rhs)
@@ -56,8 +56,8 @@ remainder(const Integer     &dividend,
     auto &&divisor_value = value_from_integer_operand(divisor);
 
     Integer result;
-    result.digits = tasty_int::detail::divide(dividend.digits,
-                                              divisor_value).remainder;
+    result.digits = tasty_int::detail::remainder(dividend.digits,
+                                                 divisor_value);
     result.sign   = sign_from_digits(result.digits, dividend.sign);
 
     return result;
@@ -404,5 +404,50 @@ div(long double    dividend,
     };
 }
 
+
+
+IntegerDivisor::IntegerDivisor(const Integer &integer)
+    : sign(integer.sign)
+    , digits_divisor(integer.digits)
+{
+    assert(sign != Sign::ZERO);
+}
+
+Integer
+IntegerDivisor::value() const
+{
+    return { .sign = sign, .digits = digits_divisor.value() };
+}
+
+Integer
+IntegerDivisor::divide(const Integer &dividend) const
+{
+    Integer result;
+    result.digits = digits_divisor.divide(dividend.digits).quotient;
+    result.sign   = sign_from_digits(result.digits, dividend.sign * sign);
+
+    return result;
+}
+
+Integer
+IntegerDivisor::reduce(const Integer &dividend) const
+{
+    Integer result;
+    result.digits = digits_divisor.reduce(dividend.digits);
+    result.sign   = sign_from_digits(result.digits, dividend.sign);
+
+    return result;
+}
+
+IntegerDivisionResult<Integer>
+IntegerDivisor::div(const Integer &dividend) const
+{
+    return integer_division_result_from_digits_division_result(
+        digits_divisor.divide(dividend.digits),
+        dividend.sign * sign,
+        dividend.sign
+    );
+}
+
 } // namespace detail
 } // namespace tasty_int
@@ -0,0 +1,386 @@
+#include "tasty_int/detail/integer_file.hpp"
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+
+#include <array>
+#include <bit>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+
+namespace tasty_int {
+namespace detail {
+namespace {
+
+constexpr std::size_t VERSION_OFFSET     = 8;
+constexpr std::size_t SIGN_OFFSET        = 12;
+constexpr std::size_t LIMB_WIDTH_OFFSET  = 13;
+constexpr std::size_t LIMB_COUNT_OFFSET  = 16;
+constexpr std::size_t LIMB_WIDTH         = sizeof(digit_type);
+
+typedef std::array<unsigned char, INTEGER_FILE_HEADER_SIZE> IntegerFileHeader;
+
+template<typename UnsignedType>
+void
+store_little_endian(UnsignedType   value,
+                    unsigned char *bytes)
+{
+    for (std::size_t index = 0; index < sizeof(UnsignedType); ++index)
+        bytes[index] = static_cast<unsigned char>(value >> (index * 8));
+}
+
+template<typename UnsignedType>
+UnsignedType
+load_little_endian(const unsigned char *bytes)
+{
+    UnsignedType value = 0;
+    for (std::size_t index = 0; index < sizeof(UnsignedType); ++index)
+        value |= static_cast<UnsignedType>(bytes[index]) << (index * 8);
+
+    return value;
+}
+
+IntegerFileHeader
+make_header(const Integer &integer)
+{
+    IntegerFileHeader header = {};
+
+    std::memcpy(header.data(), INTEGER_FILE_MAGIC, sizeof(INTEGER_FILE_MAGIC));
+    store_little_endian(INTEGER_FILE_VERSION, &header[VERSION_OFFSET]);
+    header[SIGN_OFFSET] =
+        static_cast<unsigned char>(static_cast<signed char>(integer.sign));
+    header[LIMB_WIDTH_OFFSET] = static_cast<unsigned char>(LIMB_WIDTH);
+    store_little_endian(static_cast<std::uint64_t>(integer.digits.size()),
+                        &header[LIMB_COUNT_OFFSET]);
+
+    return header;
+}
+
+void
+write_limbs(const SmallVector<digit_type> &digits,
+            std::ofstream                 &file)
+{
+    if constexpr (std::endian::native == std::endian::little) {
+        file.write(reinterpret_cast<const char *>(digits.data()),
+                   static_cast<std::streamsize>(digits.size() * LIMB_WIDTH));
+    } else {
+        unsigned char limb[LIMB_WIDTH];
+        for (digit_type digit : digits) {
+            store_little_endian(digit, limb);
+            file.write(reinterpret_cast<const char *>(limb), LIMB_WIDTH);
+        }
+    }
+}
+
+[[noreturn]] void
+throw_invalid_file(const std::filesystem::path &path,
+                   const std::string           &explanation)
+{
+    throw std::invalid_argument(
+        "tasty_int::detail::MappedIntegerFile - invalid integer file (" +
+        path.string() + "): " + explanation
+    );
+}
+
+[[noreturn]] void
+throw_system_error(std::error_code              error,
+                   const std::filesystem::path &path,
+                   const char                  *operation)
+{
+    throw std::system_error(
+        error,
+        "tasty_int::detail::MappedIntegerFile - failed to " +
+        std::string(operation) + " (" + path.string() + ")"
+    );
+}
+
+/**
+ * A read-only mapping of an entire file.
+ */
+struct FileMapping
+{
+    void        *contents; ///< the first byte of the file
+    std::size_t  size;     ///< the size of the file in bytes
+}; // struct FileMapping
+
+#ifdef _WIN32
+std::error_code
+last_error()
+{
+    return std::error_code(static_cast<int>(::GetLastError()),
+                           std::system_category());
+}
+
+[[noreturn]] void
+close_and_throw_system_error(HANDLE                       handle,
+                             const std::filesystem::path &path,
+                             const char                  *operation)
+{
+    auto error = last_error();
+    ::CloseHandle(handle);
+    throw_system_error(error, path, operation);
+}
+
+/**
+ * The file and mapping handles are closed once the view is mapped, which
+ * keeps the mapping alive on its own.
+ */
+FileMapping
+map_file(const std::filesystem::path &path)
+{
+    HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                                nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw_system_error(last_error(), path, "open");
+
+    LARGE_INTEGER file_size;
+    if (!::GetFileSizeEx(file, &file_size))
+        close_and_throw_system_error(file, path, "stat");
+
+    auto size = static_cast<std::size_t>(file_size.QuadPart);
+    if (size < INTEGER_FILE_HEADER_SIZE) {
+        ::CloseHandle(file);
+        throw_invalid_file(path, "File is smaller than the header.");
+    }
+
+    HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0,
+                                          nullptr);
+    if (mapping == nullptr)
+        close_and_throw_system_error(file, path, "map");
+
+    ::CloseHandle(file);
+
+    void *contents = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (contents == nullptr)
+        close_and_throw_system_error(mapping, path, "map");
+
+    ::CloseHandle(mapping);
+
+    return { contents, size };
+}
+
+void
+unmap_file(const FileMapping &mapping) noexcept
+{
+    ::UnmapViewOfFile(mapping.contents);
+}
+#else
+std::error_code
+last_error()
+{
+    return std::error_code(errno, std::generic_category());
+}
+
+[[noreturn]] void
+close_and_throw_system_error(int                          descriptor,
+                             const std::filesystem::path &path,
+                             const char                  *operation)
+{
+    auto error = last_error();
+    ::close(descriptor);
+    throw_system_error(error, path, operation);
+}
+
+FileMapping
+map_file(const std::filesystem::path &path)
+{
+    int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0)
+        throw_system_error(last_error(), path, "open");
+
+    struct stat status;
+    if (::fstat(descriptor, &status) != 0)
+        close_and_throw_system_error(descriptor, path, "stat");
+
+    auto size = static_cast<std::size_t>(status.st_size);
+    if (size < INTEGER_FILE_HEADER_SIZE) {
+        ::close(descriptor);
+        throw_invalid_file(path, "File is smaller than the header.");
+    }
+
+    void *contents = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor,
+                            0);
+    if (contents == MAP_FAILED)
+        close_and_throw_system_error(descriptor, path, "map");
+
+    ::close(descriptor);
+
+    return { contents, size };
+}
+
+void
+unmap_file(const FileMapping &mapping) noexcept
+{
+    ::munmap(mapping.contents, mapping.size);
+}
+#endif // ifdef _WIN32
+
+Sign
+sign_from_header(const unsigned char         *header,
+                 const std::filesystem::path &path)
+{
+    auto sign_value = static_cast<signed char>(header[SIGN_OFFSET]);
+
+    if ((sign_value < -1) || (sign_value > 1))
+        throw_invalid_file(path, "Sign must be -1, 0, or +1.");
+
+    return static_cast<Sign>(sign_value);
+}
+
+IntegerView
+view_integer_file(const unsigned char         *contents,
+                  std::size_t                  size,
+                  const std::filesystem::path &path)
+{
+    assert(size >= INTEGER_FILE_HEADER_SIZE);
+
+    if (std::memcmp(contents, INTEGER_FILE_MAGIC,
+                    sizeof(INTEGER_FILE_MAGIC)) != 0)
+        throw_invalid_file(path, "File does not begin with the magic bytes.");
+
+    auto version = load_little_endian<std::uint32_t>(&contents[VERSION_OFFSET]);
+    if (version != INTEGER_FILE_VERSION)
+        throw_invalid_file(path, "Unsupported format version " +
+                                 std::to_string(version) + ".");
+
+    if (contents[LIMB_WIDTH_OFFSET] != LIMB_WIDTH)
+        throw_invalid_file(path, "Limb width must be " +
+                                 std::to_string(LIMB_WIDTH) + " bytes.");
+
+    Sign sign = sign_from_header(contents, path);
+
+    auto count_limbs =
+        load_little_endian<std::uint64_t>(&contents[LIMB_COUNT_OFFSET]);
+    auto limbs_size = size - INTEGER_FILE_HEADER_SIZE;
+    if ((count_limbs == 0) || (count_limbs > (limbs_size / LIMB_WIDTH)) ||
+        (limbs_size != (count_limbs * LIMB_WIDTH)))
+        throw_invalid_file(path, "Limb count does not match the file size.");
+
+    // mappings are page-aligned, so the limbs are aligned for digit_type
+    const unsigned char *limbs = contents + INTEGER_FILE_HEADER_SIZE;
+    DigitsView digits(reinterpret_cast<const digit_type *>(limbs),
+                      static_cast<std::size_t>(count_limbs));
+
+    if ((digits.size() > 1) && (digits.back() == 0))
+        throw_invalid_file(path, "Most significant limb is zero.");
+
+    bool digits_are_zero = (digits.size() == 1) && (digits.front() == 0);
+    if (digits_are_zero != (sign == Sign::ZERO))
+        throw_invalid_file(path, "Sign does not agree with the limbs.");
+
+    return IntegerView(sign, digits);
+}
+
+} // namespace
+
+
+void
+write_integer_file(const Integer               &integer,
+                   const std::filesystem::path &path)
+{
+    assert(!integer.digits.empty());
+
+    std::ofstream file;
+    file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    file.open(path, std::ios_base::binary | std::ios_base::trunc);
+
+    auto header = make_header(integer);
+    file.write(reinterpret_cast<const char *>(header.data()), header.size());
+
+    write_limbs(integer.digits, file);
+
+    file.close();
+}
+
+MappedIntegerFile::MappedIntegerFile(const std::filesystem::path &path)
+    : mapping(nullptr)
+    , mapping_size(0)
+    , integer(Sign::ZERO, DigitsView())
+{
+    if constexpr (std::endian::native != std::endian::little)
+        throw std::runtime_error(
+            "tasty_int::detail::MappedIntegerFile - unsupported host: Integer"
+            " files may only be mapped on little-endian hosts."
+        );
+
+    auto file_mapping = map_file(path);
+
+    mapping      = file_mapping.contents;
+    mapping_size = file_mapping.size;
+
+    try {
+        integer = view_integer_file(static_cast<const unsigned char *>(mapping),
+                                    mapping_size, path);
+    } catch (...) {
+        unmap();
+        throw;
+    }
+}
+
+MappedIntegerFile::MappedIntegerFile(MappedIntegerFile &&other) noexcept
+    : mapping(std::exchange(other.mapping, nullptr))
+    , mapping_size(std::exchange(other.mapping_size, 0))
+    , integer(std::exchange(other.integer, IntegerView(Sign::ZERO,
+                                                       DigitsView())))
+{}
+
+MappedIntegerFile &
+MappedIntegerFile::operator=(MappedIntegerFile &&other) noexcept
+{
+    if (this != &other) {
+        unmap();
+
+        mapping      = std::exchange(other.mapping, nullptr);
+        mapping_size = std::exchange(other.mapping_size, 0);
+        integer      = std::exchange(other.integer,
+                                     IntegerView(Sign::ZERO, DigitsView()));
+    }
+
+    return *this;
+}
+
+MappedIntegerFile::~MappedIntegerFile()
+{
+    unmap();
+}
+
+IntegerView
+MappedIntegerFile::view() const
+{
+    assert(mapping != nullptr);
+
+    return integer;
+}
+
+void
+MappedIntegerFile::unmap() noexcept
+{
+    if (mapping != nullptr) {
+        unmap_file({ mapping, mapping_size });
+        mapping = nullptr;
+    }
+}
+
+} // namespace detail
+} // namespace tasty_int
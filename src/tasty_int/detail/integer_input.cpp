@@ -1,10 +1,16 @@
 #include "tasty_int/detail/integer_input.hpp"
 
+#include <algorithm>
 #include <istream>
+#include <limits>
+#include <locale>
 #include <stdexcept>
+#include <streambuf>
 #include <string>
+#include <string_view>
 
-#include "tasty_int/detail/conversions/integer_from_string.hpp"
+#include "tasty_int/detail/conversions/digits_from_string.hpp"
+#include "tasty_int/detail/sign_from_digits.hpp"
 
 
 namespace tasty_int {
@@ -26,6 +32,387 @@ base_from_ios_format(std::ios_base::fmtflags format)
     return base;
 }
 
+/**
+ * This class exposes the get area of an arbitrary std::streambuf so that its
+ * buffered characters may be scanned in bulk, as the standard library does
+ * when extracting a std::string.
+ */
+class GetArea : public std::streambuf
+{
+public:
+    static const char *
+    begin(std::streambuf &buffer)
+    {
+        return (buffer.*&GetArea::gptr)();
+    }
+
+    static const char *
+    end(std::streambuf &buffer)
+    {
+        return (buffer.*&GetArea::egptr)();
+    }
+
+    static void
+    consume(std::streambuf &buffer,
+            int             count)
+    {
+        (buffer.*&GetArea::gbump)(count);
+    }
+}; // class GetArea
+
+/**
+ * This class parses a tasty_int::detail::Integer from a whitespace-delimited
+ * word of a std::istream, consuming characters directly from its
+ * std::streambuf.
+ *
+ * The sign and base prefix are recognized incrementally as each character is
+ * extracted, following the rules of
+ * tasty_int::detail::conversions::integer_from_string().  The tokens that
+ * follow are parsed in place if they lie within a single get area; otherwise,
+ * they are gathered in a buffer that is reused by the calling thread.
+ */
+class IntegerExtractor
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] input the input stream, whose leading whitespace has been
+     *     skipped
+     *
+     * @pre `input.rdbuf() != nullptr`
+     */
+    IntegerExtractor(std::istream &input);
+
+    /**
+     * @brief Extracts the next word of @p input, parsing it as an Integer.
+     *
+     * @details As for the extraction of a std::string, extraction stops at
+     *     whitespace, at end-of-file, or after `input.width()` characters if
+     *     positive.  The entire word is consumed even if it is malformed.
+     *
+     * @param[out] integer the parsed value, unmodified on failure
+     * @return the stream state to be set on @p input
+     */
+    std::ios_base::iostate
+    extract_integer(Integer &integer);
+
+private:
+    enum class State
+    {
+        SIGN,   ///< awaiting an optional sign
+        PREFIX, ///< awaiting a base prefix or the first token
+        ZERO,   ///< a leading '0' may begin a base prefix
+        TOKENS  ///< awaiting tokens
+    }; // enum class State
+
+    bool
+    extract_prefix();
+
+    bool
+    accept_prefix(char token);
+
+    bool
+    accept_leading_token(char token);
+
+    bool
+    accept_zero_prefix(char token);
+
+    std::string_view
+    extract_tokens();
+
+    std::string_view
+    consume_chunk();
+
+    bool
+    have_reached_end(std::streambuf::int_type next);
+
+    bool
+    token_base_supports_sign_prefix() const;
+
+    static bool
+    is_sign_token(char token);
+
+    static char
+    to_lowercase(char ascii_token);
+
+    std::streambuf             &source;
+    const std::ctype<char>     &ctype;
+    std::streamsize             remaining_length;
+    std::ios_base::iostate      extraction_state;
+    State                       state;
+    Sign                        tentative_sign;
+    unsigned int                token_base;
+    bool                        have_leading_zero;
+    bool                        have_extracted;
+}; // class IntegerExtractor
+
+
+IntegerExtractor::IntegerExtractor(std::istream &input)
+    : source(*input.rdbuf())
+    , ctype(std::use_facet<std::ctype<char>>(input.getloc()))
+    , remaining_length((input.width() > 0) ? input.width()
+                                           : std::numeric_limits<
+                                                 std::streamsize
+                                             >::max())
+    , extraction_state(std::ios_base::goodbit)
+    , state(State::SIGN)
+    , tentative_sign(Sign::POSITIVE)
+    , token_base(base_from_ios_format(input.flags()))
+    , have_leading_zero(false)
+    , have_extracted(false)
+{}
+
+std::ios_base::iostate
+IntegerExtractor::extract_integer(Integer &integer)
+{
+    std::string_view tokens;
+
+    if (extract_prefix())
+        tokens = extract_tokens();
+
+    if (!have_extracted)
+        return extraction_state | std::ios_base::failbit;
+
+    // a lone "0" is decimal
+    if (token_base == 0)
+        token_base = 10;
+
+    if (tokens.empty()) {
+        if (!have_leading_zero)
+            return extraction_state | std::ios_base::failbit;
+
+        tokens = "0";
+    }
+
+    try {
+        integer.digits = conversions::digits_from_string(tokens, token_base);
+    } catch (std::invalid_argument &) {
+        return extraction_state | std::ios_base::failbit;
+    }
+
+    integer.sign = sign_from_digits(integer.digits, tentative_sign);
+
+    return extraction_state;
+}
+
+/**
+ * Extracts the sign and base prefix a character at a time.
+ *
+ * @return true if the word continues with tokens
+ */
+bool
+IntegerExtractor::extract_prefix()
+{
+    for (auto next = source.sgetc(); !have_reached_end(next);
+         next = source.sgetc()) {
+        if (!accept_prefix(std::streambuf::traits_type::to_char_type(next)))
+            return true;
+
+        source.sbumpc();
+        --remaining_length;
+        have_extracted = true;
+    }
+
+    return false;
+}
+
+/**
+ * @return true if @p token belongs to the sign or base prefix, false if it is
+ *     the first of the tokens
+ */
+bool
+IntegerExtractor::accept_prefix(char token)
+{
+    switch (state) {
+    case State::SIGN:
+        state = State::PREFIX;
+        if (token_base_supports_sign_prefix() && is_sign_token(token)) {
+            tentative_sign = (token == '-') ? Sign::NEGATIVE : Sign::POSITIVE;
+            return true;
+        }
+        [[fallthrough]];
+
+    case State::PREFIX:
+        return accept_leading_token(token);
+
+    case State::ZERO:
+        return accept_zero_prefix(token);
+
+    case State::TOKENS:
+    default:
+        return false;
+    }
+}
+
+/**
+ * A leading '0' may begin a base prefix a la
+ * tasty_int::detail::conversions::base_prefix_length_from_string().  If it
+ * does not, it is a leading zero, which does not affect the result.
+ */
+bool
+IntegerExtractor::accept_leading_token(char token)
+{
+    if (token == '0') {
+        have_leading_zero = true;
+        state             = State::ZERO;
+        return true;
+    }
+
+    if (token_base == 0)
+        token_base = 10;
+
+    state = State::TOKENS;
+    return false;
+}
+
+bool
+IntegerExtractor::accept_zero_prefix(char token)
+{
+    state = State::TOKENS;
+
+    char lowercase_token = to_lowercase(token);
+
+    if ((lowercase_token == 'x') &&
+        ((token_base == 0) || (token_base == 16))) {
+        have_leading_zero = false;
+        token_base        = 16;
+        return true;
+    }
+
+    if ((lowercase_token == 'b') && (token_base == 0)) {
+        have_leading_zero = false;
+        token_base        = 2;
+        return true;
+    }
+
+    // the leading '0' was an octal prefix
+    if (token_base == 0)
+        token_base = 8;
+
+    return false;
+}
+
+/**
+ * If the tokens end within the first chunk consumed, they are returned in
+ * place; otherwise, they are accumulated in a buffer retained by the calling
+ * thread.  A chunk may end before the get area does, e.g. when it is capped
+ * in length, so the tokens are buffered before any further chunk is consumed.
+ */
+std::string_view
+IntegerExtractor::extract_tokens()
+{
+    thread_local std::string token_buffer;
+
+    std::string_view tokens;
+    bool             have_buffered = false;
+
+    auto buffer_tokens = [&]() {
+        if (!have_buffered && !tokens.empty()) {
+            token_buffer.assign(tokens);
+            have_buffered = true;
+        }
+    };
+
+    while (true) {
+        // the get area may be overwritten once it is exhausted
+        if (GetArea::begin(source) == GetArea::end(source))
+            buffer_tokens();
+
+        if (have_reached_end(source.sgetc()))
+            break;
+
+        buffer_tokens();
+
+        std::string_view chunk = consume_chunk();
+
+        if (have_buffered)
+            token_buffer.append(chunk);
+        else
+            tokens = chunk;
+    }
+
+    return have_buffered ? std::string_view(token_buffer) : tokens;
+}
+
+/**
+ * Consumes the run of non-whitespace characters at the front of the get area,
+ * up to the `INT_MAX` characters that may be consumed at once.  Streambufs
+ * without a get area are consumed a character at a time.
+ *
+ * @pre the next character of the source belongs to the word
+ */
+std::string_view
+IntegerExtractor::consume_chunk()
+{
+    thread_local char unbuffered_token;
+
+    have_extracted = true;
+
+    const char *begin = GetArea::begin(source);
+    auto count_available = std::min<std::streamsize>({
+        GetArea::end(source) - begin,
+        remaining_length,
+        std::numeric_limits<int>::max()
+    });
+
+    if (count_available == 0) {
+        unbuffered_token = std::streambuf::traits_type::to_char_type(
+            source.sbumpc()
+        );
+        --remaining_length;
+        return std::string_view(&unbuffered_token, 1);
+    }
+
+    const char *end_of_word = ctype.scan_is(std::ctype_base::space, begin,
+                                            begin + count_available);
+    auto count_tokens = end_of_word - begin;
+
+    GetArea::consume(source, static_cast<int>(count_tokens));
+    remaining_length -= count_tokens;
+
+    return std::string_view(begin, count_tokens);
+}
+
+/**
+ * @return true if @p next is end-of-file or whitespace or the extraction
+ *     width has been reached, recording end-of-file in the extraction state
+ */
+bool
+IntegerExtractor::have_reached_end(std::streambuf::int_type next)
+{
+    using traits_type = std::streambuf::traits_type;
+
+    if (traits_type::eq_int_type(next, traits_type::eof())) {
+        extraction_state |= std::ios_base::eofbit;
+        return true;
+    }
+
+    return (remaining_length == 0)
+        || ctype.is(std::ctype_base::space, traits_type::to_char_type(next));
+}
+
+bool
+IntegerExtractor::token_base_supports_sign_prefix() const
+{
+    // base 63 and 64 reserve '+' => all other bases support an explicit sign
+    return token_base <= 62;
+}
+
+bool
+IntegerExtractor::is_sign_token(char token)
+{
+    return (token == '-') || (token == '+');
+}
+
+char
+IntegerExtractor::to_lowercase(char ascii_token)
+{
+    constexpr char LOWERCASE_BIT = 0b00100000;
+
+    return ascii_token | LOWERCASE_BIT;
+}
+
 } // namespace
 
 
@@ -33,14 +420,13 @@ std::istream &
 operator>>(std::istream &input,
            Integer      &integer)
 {
-    if (std::string tokens; input >> tokens) {
-        auto base = base_from_ios_format(input.flags());
+    if (std::istream::sentry sentry(input); sentry) {
+        IntegerExtractor integer_extractor(input);
 
-        try {
-            integer = conversions::integer_from_string(tokens, base);
-        } catch (std::invalid_argument &) {
-            input.clear(input.rdstate() | std::ios_base::failbit);
-        }
+        auto extraction_state = integer_extractor.extract_integer(integer);
+
+        input.width(0);
+        input.setstate(extraction_state);
     }
 
     return input;
@@ -0,0 +1,108 @@
+#include "tasty_int/detail/integer_montgomery.hpp"
+
+#include <cassert>
+
+#include <utility>
+
+#include "tasty_int/detail/sign_from_digits.hpp"
+#include "tasty_int/detail/digits_subtraction.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+namespace {
+
+Integer
+residue_from_digits(SmallVector<digit_type> &&digits)
+{
+    auto sign = sign_from_digits(digits, Sign::POSITIVE);
+
+    return { .sign = sign, .digits = std::move(digits) };
+}
+
+} // namespace
+
+
+IntegerMontgomeryContext::IntegerMontgomeryContext(const Integer &integer)
+    : digits_context(integer.digits)
+{
+    assert(integer.sign == Sign::POSITIVE);
+    assert((integer.digits.front() & 1) == 1);
+}
+
+Integer
+IntegerMontgomeryContext::value() const
+{
+    return { .sign = Sign::POSITIVE, .digits = digits_context.value() };
+}
+
+Integer
+IntegerMontgomeryContext::to_montgomery(const Integer &integer) const
+{
+    auto residue = residue_from_digits(
+        digits_context.to_montgomery(integer.digits)
+    );
+
+    return (integer.sign == Sign::NEGATIVE) ? negate(residue) : residue;
+}
+
+Integer
+IntegerMontgomeryContext::from_montgomery(const Integer &integer) const
+{
+    assert(integer.sign >= Sign::ZERO);
+
+    return residue_from_digits(
+        digits_context.from_montgomery(integer.digits)
+    );
+}
+
+Integer
+IntegerMontgomeryContext::multiply(const Integer &lhs,
+                                   const Integer &rhs) const
+{
+    assert(lhs.sign >= Sign::ZERO);
+    assert(rhs.sign >= Sign::ZERO);
+
+    return residue_from_digits(
+        digits_context.multiply(lhs.digits, rhs.digits)
+    );
+}
+
+Integer
+IntegerMontgomeryContext::square(const Integer &integer) const
+{
+    assert(integer.sign >= Sign::ZERO);
+
+    return residue_from_digits(digits_context.square(integer.digits));
+}
+
+Integer
+IntegerMontgomeryContext::pow_mod(const Integer &base,
+                                  const Integer &exponent) const
+{
+    assert(exponent.sign >= Sign::ZERO);
+
+    auto residue = residue_from_digits(
+        digits_context.pow_mod(base.digits, exponent.digits)
+    );
+
+    // (-base)^exponent == -(base^exponent) for odd exponents
+    bool negate_residue = (base.sign == Sign::NEGATIVE)
+                       && ((exponent.digits.front() & 1) == 1);
+
+    return negate_residue ? negate(residue) : residue;
+}
+
+Integer
+IntegerMontgomeryContext::negate(const Integer &residue) const
+{
+    if (residue.sign == Sign::ZERO)
+        return residue;
+
+    return residue_from_digits(
+        subtract(digits_context.value(), residue.digits).second
+    );
+}
+
+} // namespace detail
+} // namespace tasty_int
@@ -152,5 +152,16 @@ operator*(long double    lhs,
     return rhs * lhs;
 }
 
+Integer
+multiply_integers(IntegerView lhs,
+                  IntegerView rhs)
+{
+    Integer result;
+    result.sign   = lhs.sign * rhs.sign;
+    result.digits = multiply_digits(lhs.digits, rhs.digits);
+
+    return result;
+}
+
 } // namespace detail
 } // namespace tasty_int
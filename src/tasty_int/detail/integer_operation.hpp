@@ -37,7 +37,7 @@ concept ArithmeticValue = std::is_unsigned_v<T>
  */
 template<typename T>
 concept Value = ArithmeticValue<T>
-             || std::is_same_v<T, std::vector<digit_type>>;
+             || std::is_same_v<T, SmallVector<digit_type>>;
 
 /**
  * This concept constrains to all types that are operable with
@@ -123,7 +123,7 @@ sign_from_integer_operand(SignedArithmeticValueType operand)
  * @return the nonnegative value of @p operand.
  */
 /// @{
-inline const std::vector<digit_type> &
+inline const SmallVector<digit_type> &
 value_from_integer_operand(const Integer &operand)
 {
     return operand.digits;
@@ -4,12 +4,16 @@
 #include <string_view>
 
 #include "tasty_int/detail/conversions/base_prefix_format_from_ios_format.hpp"
-#include "tasty_int/detail/conversions/string_from_integer.hpp"
+#include "tasty_int/detail/conversions/chars_from_integer.hpp"
 
 
 namespace tasty_int {
 namespace detail {
 
+/**
+ * The digits are written to @p output a bounded segment at a time as they are
+ * produced rather than materialized in full beforehand.
+ */
 std::ostream &
 operator<<(std::ostream  &output,
            const Integer &integer)
@@ -17,17 +21,22 @@ operator<<(std::ostream  &output,
     auto format =
         conversions::base_prefix_format_from_ios_format(output.flags());
 
-    auto stringified = conversions::string_from_integer(integer, format.base);
-    std::string_view digits = stringified;
-
-    if (integer.sign >= Sign::ZERO) {
+    if (integer.sign >= Sign::ZERO)
         output << format.nonnegative_sign;
-    } else {
+    else
         output << '-';
-        digits.remove_prefix(1);
-    }
 
-    return output << format.prefix << digits;
+    output << format.prefix;
+
+    conversions::stream_chars_from_digits(
+        integer.digits, format.base,
+        [&](std::string_view digits) {
+            output.write(digits.data(),
+                         static_cast<std::streamsize>(digits.size()));
+        }
+    );
+
+    return output;
 }
 
 } // namespace detail
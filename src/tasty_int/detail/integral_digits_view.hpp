@@ -55,7 +55,11 @@ public:
     digit_type
     high_digit() const
     {
-        return digit_from_nonnegative_value(integral_value >> DIGIT_TYPE_BITS);
+        // widened so that the shift is well-defined if a single digit spans
+        // the integral value
+        return digit_from_nonnegative_value(
+            digit_accumulator_type(integral_value) >> DIGIT_TYPE_BITS
+        );
     }
 
     /**
@@ -0,0 +1,209 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_INVARIANT_DIGIT_DIVISOR_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_INVARIANT_DIGIT_DIVISOR_HPP
+
+#include <cassert>
+
+#include <bit>
+#include <limits>
+
+#include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/digit_from_nonnegative_value.hpp"
+
+
+namespace tasty_int {
+namespace detail {
+
+/**
+ * The result of dividing by an InvariantDigitDivisor.
+ */
+struct DigitDivisionResult
+{
+    digit_type quotient;  ///< the division quotient
+    digit_type remainder; ///< the division remainder
+}; // struct DigitDivisionResult
+
+/**
+ * This class divides two-digit values by a single-digit divisor fixed on
+ * construction, replacing the hardware division with a multiplication by a
+ * precomputed reciprocal.
+ *
+ * The divisor is normalized, shifted left until its most significant bit is
+ * set, and its reciprocal `floor((DIGIT_BASE^2 - 1) / normalized_divisor) -
+ * DIGIT_BASE` is computed once.  Each division then costs one
+ * digit_accumulator_type multiplication, a few additions, and at most two
+ * corrections (from "Improved division by invariant integers" by Niels
+ * Möller and Torbjörn Granlund).
+ */
+class InvariantDigitDivisor
+{
+public:
+    /**
+     * @brief Prepares @p divisor for division.
+     *
+     * @param[in] divisor a single digit
+     *
+     * @pre `(divisor > 0) && (divisor <= DIGIT_TYPE_MAX)`
+     */
+    explicit
+    InvariantDigitDivisor(digit_type divisor)
+        : normal_shift(count_normal_shift(divisor))
+        , normalized_divisor(digit_from_nonnegative_value(
+              digit_accumulator_type(divisor) << normal_shift
+          ))
+        , reciprocal(compute_reciprocal(normalized_divisor))
+    {}
+
+    /**
+     * @brief Restores a divisor prepared earlier, skipping the division that
+     *     computes its reciprocal.
+     *
+     * @param[in] divisor               a single digit
+     * @param[in] normalized_reciprocal the normalized_reciprocal() of
+     *     `InvariantDigitDivisor(divisor)`
+     *
+     * @pre `(divisor > 0) && (divisor <= DIGIT_TYPE_MAX)`
+     */
+    InvariantDigitDivisor(digit_type divisor,
+                          digit_type normalized_reciprocal)
+        : normal_shift(count_normal_shift(divisor))
+        , normalized_divisor(digit_from_nonnegative_value(
+              digit_accumulator_type(divisor) << normal_shift
+          ))
+        , reciprocal(normalized_reciprocal)
+    {
+        assert(reciprocal == compute_reciprocal(normalized_divisor));
+    }
+
+    /**
+     * @return the original divisor
+     */
+    digit_type
+    value() const
+    {
+        return normalized_divisor >> normal_shift;
+    }
+
+    /**
+     * @return the precomputed reciprocal, from which the divisor may be
+     *     restored
+     */
+    digit_type
+    normalized_reciprocal() const
+    {
+        return reciprocal;
+    }
+
+    /**
+     * @brief Execute `(high*DIGIT_BASE + low) / divisor`.
+     *
+     * @param[in] high the most significant digit of the dividend
+     * @param[in] low  the least significant digit of the dividend
+     * @return the quotient and remainder
+     *
+     * @pre `high < divisor` so that the quotient fits in a single digit
+     */
+    DigitDivisionResult
+    divide(digit_type high,
+           digit_type low) const
+    {
+        assert(high < value());
+
+        digit_accumulator_type dividend = high;
+        dividend <<= DIGIT_TYPE_BITS;
+        dividend  |= low;
+        dividend <<= normal_shift;
+
+        auto [quotient, normalized_remainder] = divide_normalized(
+            digit_from_nonnegative_value(dividend >> DIGIT_TYPE_BITS),
+            digit_from_nonnegative_value(dividend)
+        );
+
+        return {
+            .quotient  = quotient,
+            .remainder = normalized_remainder >> normal_shift
+        };
+    }
+
+    /**
+     * @brief Execute `digit / divisor`.
+     */
+    DigitDivisionResult
+    divide(digit_type digit) const
+    {
+        return divide(0, digit);
+    }
+
+private:
+    static unsigned int
+    count_normal_shift(digit_type divisor)
+    {
+        assert(divisor > 0);
+        assert(divisor <= DIGIT_TYPE_MAX);
+
+        constexpr unsigned int UNUSED_BITS =
+            std::numeric_limits<digit_type>::digits - DIGIT_TYPE_BITS;
+
+        return static_cast<unsigned int>(std::countl_zero(divisor))
+             - UNUSED_BITS;
+    }
+
+    static digit_type
+    compute_reciprocal(digit_type normalized_divisor)
+    {
+        constexpr digit_accumulator_type DIGIT_BASE_SQUARED_LESS_ONE =
+            (digit_accumulator_type(DIGIT_TYPE_MAX) << DIGIT_TYPE_BITS)
+          | DIGIT_TYPE_MAX;
+
+        return digit_from_nonnegative_value(
+            DIGIT_BASE_SQUARED_LESS_ONE / normalized_divisor
+        );
+    }
+
+    /**
+     * Divides `high*DIGIT_BASE + low` by the normalized divisor, where `high`
+     * is less than the normalized divisor.
+     */
+    DigitDivisionResult
+    divide_normalized(digit_type high,
+                      digit_type low) const
+    {
+        digit_accumulator_type estimate = reciprocal;
+        estimate *= high;
+        estimate += (digit_accumulator_type(high) << DIGIT_TYPE_BITS) | low;
+
+        auto quotient          = digit_from_nonnegative_value(
+            (estimate >> DIGIT_TYPE_BITS) + 1
+        );
+        auto quotient_fraction = digit_from_nonnegative_value(estimate);
+
+        auto remainder = digit_from_nonnegative_value(
+            digit_accumulator_type(low)
+            - (digit_accumulator_type(quotient) * normalized_divisor)
+        );
+
+        if (remainder > quotient_fraction) {
+            quotient  = digit_from_nonnegative_value(
+                digit_accumulator_type(quotient) - 1
+            );
+            remainder = digit_from_nonnegative_value(
+                digit_accumulator_type(remainder) + normalized_divisor
+            );
+        }
+
+        if (remainder >= normalized_divisor) {
+            ++quotient;
+            remainder -= normalized_divisor;
+        }
+
+        return { .quotient = quotient, .remainder = remainder };
+    }
+
+    unsigned int normal_shift;
+    digit_type   normalized_divisor;
+    digit_type   reciprocal;
+}; // class InvariantDigitDivisor
+
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_INVARIANT_DIGIT_DIVISOR_HPP
@@ -1,9 +1,9 @@
 #ifndef TASTY_INT_TASTY_INT_DETAIL_IS_ZERO_HPP
 #define TASTY_INT_TASTY_INT_DETAIL_IS_ZERO_HPP
 
-#include <vector>
-
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
+#include "tasty_int/detail/digits_view.hpp"
 
 
 namespace tasty_int {
@@ -16,7 +16,14 @@ namespace detail {
  * @return true if @p digits is zero
  */
 inline bool
-is_zero(const std::vector<digit_type> &digits)
+is_zero(const SmallVector<digit_type> &digits)
+{
+    return (digits.size()  == 1)
+        && (digits.front() == 0);
+}
+
+inline bool
+is_zero(DigitsView digits)
 {
     return (digits.size()  == 1)
         && (digits.front() == 0);
@@ -0,0 +1,360 @@
+#include "tasty_int/detail/number_theoretic_transform.hpp"
+
+#include <cassert>
+
+#include <utility>
+
+
+namespace tasty_int {
+namespace detail {
+namespace {
+
+std::uint32_t
+power_modulo(std::uint64_t base,
+             std::uint64_t exponent,
+             std::uint32_t modulus)
+{
+    std::uint64_t result = 1;
+
+    base %= modulus;
+    while (exponent > 0) {
+        if ((exponent & 1) != 0)
+            result = (result * base) % modulus;
+
+        base       = (base * base) % modulus;
+        exponent >>= 1;
+    }
+
+    return static_cast<std::uint32_t>(result);
+}
+
+/**
+ * This class implements Montgomery multiplication modulo a prime less than
+ * 2^31 with a Montgomery radix of 2^32.  Products of values in Montgomery form
+ * are reduced without hardware division.
+ */
+class MontgomeryModulus
+{
+public:
+    explicit MontgomeryModulus(std::uint32_t prime_modulus)
+        : modulus(prime_modulus)
+        , negative_inverse(make_negative_inverse(prime_modulus))
+        , radix_squared(make_radix_squared(prime_modulus))
+    {
+        assert((prime_modulus & 1) != 0);
+        assert(prime_modulus < (std::uint32_t(1) << 31));
+    }
+
+    std::uint32_t
+    reduce(std::uint64_t value) const
+    {
+        auto quotient = static_cast<std::uint32_t>(value) * negative_inverse;
+        auto result   = static_cast<std::uint32_t>(
+            (value + (std::uint64_t(quotient) * modulus)) >> 32
+        );
+
+        return (result >= modulus) ? (result - modulus) : result;
+    }
+
+    std::uint32_t
+    to_montgomery(std::uint32_t value) const
+    {
+        return multiply(value % modulus, radix_squared);
+    }
+
+    std::uint32_t
+    multiply(std::uint32_t lhs,
+             std::uint32_t rhs) const
+    {
+        return reduce(std::uint64_t(lhs) * rhs);
+    }
+
+    std::uint32_t
+    add(std::uint32_t lhs,
+        std::uint32_t rhs) const
+    {
+        auto sum = lhs + rhs;
+
+        return (sum >= modulus) ? (sum - modulus) : sum;
+    }
+
+    std::uint32_t
+    subtract(std::uint32_t minuend,
+             std::uint32_t subtrahend) const
+    {
+        return (minuend >= subtrahend)
+             ? (minuend - subtrahend)
+             : (minuend + modulus - subtrahend);
+    }
+
+private:
+    static std::uint32_t
+    make_negative_inverse(std::uint32_t prime_modulus)
+    {
+        // Newton's iteration doubles the number of correct low bits of the
+        // inverse, starting from 3 correct bits (modulus^2 == 1 mod 8).
+        std::uint32_t inverse = prime_modulus;
+        for (int iteration = 0; iteration < 4; ++iteration)
+            inverse *= 2 - (prime_modulus * inverse);
+
+        return 0 - inverse;
+    }
+
+    static std::uint32_t
+    make_radix_squared(std::uint32_t prime_modulus)
+    {
+        std::uint64_t radix = (std::uint64_t(1) << 32) % prime_modulus;
+
+        return static_cast<std::uint32_t>((radix * radix) % prime_modulus);
+    }
+
+    std::uint32_t modulus;
+    std::uint32_t negative_inverse;
+    std::uint32_t radix_squared;
+}; // class MontgomeryModulus
+
+void
+bit_reverse_permute(std::vector<std::uint32_t> &values)
+{
+    auto size = values.size();
+
+    std::size_t reversed = 0;
+    for (std::size_t index = 1; index < size; ++index) {
+        auto bit = size >> 1;
+        for (; (reversed & bit) != 0; bit >>= 1)
+            reversed ^= bit;
+        reversed ^= bit;
+
+        if (index < reversed)
+            std::swap(values[index], values[reversed]);
+    }
+}
+
+void
+transform_in_place(const MontgomeryModulus    &modulus,
+                   std::uint32_t               root,
+                   std::vector<std::uint32_t> &values)
+{
+    auto size = values.size();
+
+    bit_reverse_permute(values);
+
+    std::vector<std::uint32_t> root_powers;
+    root_powers.reserve(size / 2);
+
+    for (std::size_t half_span = 1; half_span < size; half_span <<= 1) {
+        // span_root = root^(size / (2*half_span))
+        auto span_root = root;
+        for (auto stride = size / 2; stride > half_span; stride >>= 1)
+            span_root = modulus.multiply(span_root, span_root);
+
+        root_powers.assign(1, modulus.to_montgomery(1));
+        while (root_powers.size() < half_span)
+            root_powers.emplace_back(
+                modulus.multiply(root_powers.back(), span_root)
+            );
+
+        for (std::size_t offset = 0; offset < size; offset += 2 * half_span) {
+            auto low  = values.begin() + offset;
+            auto high = low + half_span;
+
+            for (auto root_power : root_powers) {
+                auto even = *low;
+                auto odd  = modulus.multiply(*high, root_power);
+
+                *low++  = modulus.add(even, odd);
+                *high++ = modulus.subtract(even, odd);
+            }
+        }
+    }
+}
+
+std::vector<std::uint32_t>
+make_montgomery_values(const MontgomeryModulus          &modulus,
+                       const std::vector<std::uint32_t> &values,
+                       std::size_t                       transform_size)
+{
+    std::vector<std::uint32_t> result;
+    result.reserve(transform_size);
+
+    for (auto value : values)
+        result.emplace_back(modulus.to_montgomery(value));
+
+    result.resize(transform_size);
+
+    return result;
+}
+
+std::size_t
+transform_size_from_convolution_size(std::size_t convolution_size)
+{
+    std::size_t transform_size = 1;
+    while (transform_size < convolution_size)
+        transform_size <<= 1;
+
+    return transform_size;
+}
+
+/**
+ * This class reconstructs convolution coefficients from their residues modulo
+ * NUMBER_THEORETIC_TRANSFORM_PRIMES and accumulates them into a little-endian
+ * sequence of 32-bit words.
+ */
+class CoefficientAccumulator
+{
+public:
+    CoefficientAccumulator()
+        : carry{}
+        , inverse_1_modulo_2(power_modulo(MODULUS_1, MODULUS_2 - 2, MODULUS_2))
+        , inverse_1_modulo_3(power_modulo(MODULUS_1, MODULUS_3 - 2, MODULUS_3))
+        , inverse_2_modulo_3(power_modulo(MODULUS_2, MODULUS_3 - 2, MODULUS_3))
+    {}
+
+    void
+    accumulate(std::uint64_t residue_1,
+               std::uint64_t residue_2,
+               std::uint64_t residue_3)
+    {
+        // coefficient = residue_1 + MODULUS_1*(term_2 + MODULUS_2*term_3)
+        auto term_2 = ((residue_2 + MODULUS_2 - residue_1) * inverse_1_modulo_2)
+                    % MODULUS_2;
+        auto term_3 = ((residue_3 + MODULUS_3 - residue_1) * inverse_1_modulo_3)
+                    % MODULUS_3;
+        term_3      = ((term_3 + MODULUS_3 - term_2) * inverse_2_modulo_3)
+                    % MODULUS_3;
+
+        auto upper = term_2 + (MODULUS_2 * term_3);
+        auto low   = ((upper & WORD_MASK) * MODULUS_1) + residue_1;
+        auto high  = (upper >> WORD_BITS) * MODULUS_1;
+
+        carry[0] += low & WORD_MASK;
+        carry[1] += (low >> WORD_BITS) + (high & WORD_MASK);
+        carry[2] += high >> WORD_BITS;
+    }
+
+    std::uint32_t
+    pop_word()
+    {
+        auto word = static_cast<std::uint32_t>(carry[0] & WORD_MASK);
+
+        carry[0] = carry[1] + (carry[0] >> WORD_BITS);
+        carry[1] = carry[2];
+        carry[2] = 0;
+
+        return word;
+    }
+
+private:
+    static constexpr unsigned int  WORD_BITS = 32;
+    static constexpr std::uint64_t WORD_MASK = (std::uint64_t(1) << WORD_BITS)
+                                             - 1;
+    static constexpr std::uint64_t MODULUS_1 =
+        NUMBER_THEORETIC_TRANSFORM_PRIMES[0].modulus;
+    static constexpr std::uint64_t MODULUS_2 =
+        NUMBER_THEORETIC_TRANSFORM_PRIMES[1].modulus;
+    static constexpr std::uint64_t MODULUS_3 =
+        NUMBER_THEORETIC_TRANSFORM_PRIMES[2].modulus;
+
+    static_assert((MODULUS_1 < MODULUS_2) && (MODULUS_2 < MODULUS_3));
+
+    std::array<std::uint64_t, 3> carry;
+    std::uint64_t                inverse_1_modulo_2;
+    std::uint64_t                inverse_1_modulo_3;
+    std::uint64_t                inverse_2_modulo_3;
+}; // class CoefficientAccumulator
+
+} // namespace
+
+
+std::vector<std::uint32_t>
+convolve_residues(const NumberTheoreticTransformPrime &prime,
+                  const std::vector<std::uint32_t>    &lhs,
+                  const std::vector<std::uint32_t>    &rhs,
+                  std::size_t                          transform_size)
+{
+    assert(transform_size > 0);
+    assert((transform_size & (transform_size - 1)) == 0);
+    assert(transform_size <= (std::size_t(1) << prime.max_log2_size));
+    assert(transform_size >= lhs.size());
+    assert(transform_size >= rhs.size());
+
+    MontgomeryModulus modulus(prime.modulus);
+
+    auto order      = prime.modulus - 1;
+    auto root       = power_modulo(prime.primitive_root,
+                                   order / transform_size,
+                                   prime.modulus);
+    auto inverse    = power_modulo(root,
+                                   transform_size - 1,
+                                   prime.modulus);
+    auto size_scale = power_modulo(transform_size,
+                                   prime.modulus - 2,
+                                   prime.modulus);
+
+    auto result = make_montgomery_values(modulus, lhs, transform_size);
+    transform_in_place(modulus, modulus.to_montgomery(root), result);
+
+    if (&lhs == &rhs) {
+        for (auto &value : result)
+            value = modulus.multiply(value, value);
+    } else {
+        auto other = make_montgomery_values(modulus, rhs, transform_size);
+        transform_in_place(modulus, modulus.to_montgomery(root), other);
+
+        auto other_cursor = other.begin();
+        for (auto &value : result)
+            value = modulus.multiply(value, *other_cursor++);
+    }
+
+    transform_in_place(modulus, modulus.to_montgomery(inverse), result);
+
+    // multiplying a Montgomery-form value by a standard-form value produces a
+    // standard-form product
+    for (auto &value : result)
+        value = modulus.multiply(value, size_scale);
+
+    return result;
+}
+
+std::vector<std::uint32_t>
+number_theoretic_transform_multiply_words(
+    const std::vector<std::uint32_t> &lhs,
+    const std::vector<std::uint32_t> &rhs
+)
+{
+    assert(!lhs.empty());
+    assert(!rhs.empty());
+
+    auto convolution_size = lhs.size() + rhs.size() - 1;
+    assert(convolution_size <= NUMBER_THEORETIC_TRANSFORM_MAX_SIZE);
+
+    auto transform_size = transform_size_from_convolution_size(convolution_size);
+
+    std::array<std::vector<std::uint32_t>, 3> residues;
+    for (std::size_t index = 0; index < residues.size(); ++index)
+        residues[index] = convolve_residues(
+            NUMBER_THEORETIC_TRANSFORM_PRIMES[index],
+            lhs,
+            rhs,
+            transform_size
+        );
+
+    std::vector<std::uint32_t> result;
+    result.reserve(convolution_size + 1);
+
+    CoefficientAccumulator accumulator;
+    for (std::size_t index = 0; index < convolution_size; ++index) {
+        accumulator.accumulate(residues[0][index],
+                               residues[1][index],
+                               residues[2][index]);
+
+        result.emplace_back(accumulator.pop_word());
+    }
+
+    result.emplace_back(accumulator.pop_word());
+
+    return result;
+}
+
+} // namespace detail
+} // namespace tasty_int
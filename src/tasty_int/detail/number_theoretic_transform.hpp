@@ -0,0 +1,98 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_NUMBER_THEORETIC_TRANSFORM_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_NUMBER_THEORETIC_TRANSFORM_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <vector>
+
+
+namespace tasty_int {
+namespace detail {
+
+/**
+ * A word-sized prime modulus of the form `k*2^n + 1`.  The multiplicative
+ * group of integers modulo such a prime contains primitive roots of unity of
+ * order `2^n`, which allows for power-of-two transforms of up to `2^n` points.
+ */
+struct NumberTheoreticTransformPrime
+{
+    /// the prime modulus (require < 2^31)
+    std::uint32_t modulus;
+    /// a generator of the multiplicative group of integers modulo `modulus`
+    std::uint32_t primitive_root;
+    /// `n` s.t. `modulus == k*2^n + 1` for some odd `k`
+    unsigned int  max_log2_size;
+}; // struct NumberTheoreticTransformPrime
+
+/**
+ * The primes used to compute convolutions whose exact values are
+ * reconstructed by the Chinese Remainder Theorem.  Their product exceeds
+ * 2^90, which is large enough to represent every coefficient of a convolution
+ * of up to NUMBER_THEORETIC_TRANSFORM_MAX_SIZE 32-bit inputs.
+ */
+constexpr std::array<NumberTheoreticTransformPrime, 3>
+    NUMBER_THEORETIC_TRANSFORM_PRIMES = {{
+        { .modulus = 469762049,  .primitive_root = 3,  .max_log2_size = 26 },
+        { .modulus = 1811939329, .primitive_root = 13, .max_log2_size = 26 },
+        { .modulus = 2013265921, .primitive_root = 31, .max_log2_size = 27 }
+    }};
+
+/**
+ * The maximum number of points supported by every member of
+ * NUMBER_THEORETIC_TRANSFORM_PRIMES.
+ */
+constexpr std::size_t NUMBER_THEORETIC_TRANSFORM_MAX_SIZE =
+    std::size_t(1) << 26;
+
+/**
+ * @brief Computes the cyclic convolution of @p lhs and @p rhs modulo
+ *     `prime.modulus`.
+ *
+ * @details Both inputs are reduced modulo `prime.modulus`, zero-padded to
+ *     @p transform_size points, transformed, multiplied pointwise, and
+ *     transformed back.  The result is the linear convolution of @p lhs and
+ *     @p rhs if `transform_size >= (lhs.size() + rhs.size() - 1)`.
+ *
+ * @param[in] prime          the prime modulus
+ * @param[in] lhs            a sequence of values
+ * @param[in] rhs            a sequence of values
+ * @param[in] transform_size the number of points in the transform
+ * @return the @p transform_size residues of the cyclic convolution
+ *
+ * @pre @p transform_size is a power of two
+ * @pre `transform_size <= (1 << prime.max_log2_size)`
+ * @pre `transform_size >= std::max(lhs.size(), rhs.size())`
+ */
+std::vector<std::uint32_t>
+convolve_residues(const NumberTheoreticTransformPrime &prime,
+                  const std::vector<std::uint32_t>    &lhs,
+                  const std::vector<std::uint32_t>    &rhs,
+                  std::size_t                          transform_size);
+
+/**
+ * @brief Multiplies @p lhs by @p rhs, where both operands are little-endian
+ *     sequences of 32-bit words.
+ *
+ * @details The product is computed by convolving the operands modulo each of
+ *     NUMBER_THEORETIC_TRANSFORM_PRIMES, reconstructing each exact coefficient
+ *     with Garner's algorithm, and then propagating carries.
+ *
+ * @param[in] lhs a little-endian sequence of 32-bit words
+ * @param[in] rhs a little-endian sequence of 32-bit words
+ * @return the `lhs.size() + rhs.size()` little-endian words of the product
+ *
+ * @pre `!lhs.empty() && !rhs.empty()`
+ * @pre `(lhs.size() + rhs.size() - 1) <= NUMBER_THEORETIC_TRANSFORM_MAX_SIZE`
+ */
+std::vector<std::uint32_t>
+number_theoretic_transform_multiply_words(
+    const std::vector<std::uint32_t> &lhs,
+    const std::vector<std::uint32_t> &rhs
+);
+
+} // namespace detail
+} // namespace tasty_int
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_NUMBER_THEORETIC_TRANSFORM_HPP
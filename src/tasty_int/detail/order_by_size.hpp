@@ -2,9 +2,10 @@
 #define TASTY_INT_TASTY_INT_DETAIL_ORDER_BY_SIZE_HPP
 
 #include <algorithm>
-#include <vector>
 
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
+#include "tasty_int/detail/digits_view.hpp"
 
 
 namespace tasty_int {
@@ -17,10 +18,10 @@ namespace detail {
  * @param[in] digits2 a little-endian sequence of digits
  * @return references to arguments ordered by size
  */
-inline std::pair<const std::vector<digit_type> &,
-                 const std::vector<digit_type> &>
-order_by_size(const std::vector<digit_type> &digits1,
-              const std::vector<digit_type> &digits2)
+inline std::pair<const SmallVector<digit_type> &,
+                 const SmallVector<digit_type> &>
+order_by_size(const SmallVector<digit_type> &digits1,
+              const SmallVector<digit_type> &digits2)
 {
     return std::minmax(
         digits1, digits2,
@@ -32,6 +33,16 @@ order_by_size(const std::vector<digit_type> &digits1,
     );
 }
 
+inline std::pair<DigitsView, DigitsView>
+order_by_size(DigitsView digits1,
+              DigitsView digits2)
+{
+    if (digits2.size() < digits1.size())
+        return { digits2, digits1 };
+
+    return { digits1, digits2 };
+}
+
 } // namespace detail
 } // namespace tasty_int
 
@@ -9,7 +9,7 @@ namespace tasty_int {
 namespace detail {
 
 Sign
-sign_from_digits(const std::vector<digit_type> &digits,
+sign_from_digits(const SmallVector<digit_type> &digits,
                  Sign                           nonzero_sign)
 {
     assert((nonzero_sign == Sign::NEGATIVE) ||
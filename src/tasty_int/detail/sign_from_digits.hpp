@@ -1,9 +1,8 @@
 #ifndef TASTY_INT_TASTY_INT_DETAIL_SIGN_FROM_DIGITS_HPP
 #define TASTY_INT_TASTY_INT_DETAIL_SIGN_FROM_DIGITS_HPP
 
-#include <vector>
-
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 #include "tasty_int/detail/sign.hpp"
 
 
@@ -20,7 +19,7 @@ namespace detail {
  * @pre @p nonzero_sign is one of Sign::NEGATIVE, Sign::ZERO, or Sign::POSITIVE.
  */
 Sign
-sign_from_digits(const std::vector<digit_type> &digits,
+sign_from_digits(const SmallVector<digit_type> &digits,
                  Sign                           nonzero_sign);
 
 } // namespace detail
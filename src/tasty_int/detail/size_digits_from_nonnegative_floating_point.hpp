@@ -8,8 +8,8 @@ namespace tasty_int {
 namespace detail {
 
 /**
- * @brief Estimates the number of `digit_type`s required to represent @p value
- *     in base `DIGIT_BASE`.
+ * @brief Counts the number of `digit_type`s required to represent the integral
+ *     part of @p value in base `DIGIT_BASE`.
  *
  * @param[in] value a nonnegative floating point value
  * @return the number of digits required to represent @p value
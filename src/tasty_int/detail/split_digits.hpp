@@ -4,9 +4,9 @@
 #include <cassert>
 
 #include <array>
-#include <vector>
 
 #include "tasty_int/detail/trailing_zero.hpp"
+#include "tasty_int/detail/digits_view.hpp"
 
 
 namespace tasty_int {
@@ -22,18 +22,18 @@ bool is_final_split(std::size_t split_index,
 
 template<std::size_t SPLIT_INDEX, std::size_t COUNT_PIECES>
 void
-split(const std::vector<digit_type>                     &digits,
-      std::vector<digit_type>::size_type                 split_size,
-      std::array<std::vector<digit_type>, COUNT_PIECES> &result)
+split(DigitsView                                         digits,
+      SmallVector<digit_type>::size_type                 split_size,
+      std::array<SmallVector<digit_type>, COUNT_PIECES> &result)
 {
     auto split_begin = digits.begin() + (SPLIT_INDEX * split_size);
 
     if constexpr (is_final_split(SPLIT_INDEX, COUNT_PIECES)) {
-        result[SPLIT_INDEX] = std::vector<digit_type>(split_begin,
+        result[SPLIT_INDEX] = SmallVector<digit_type>(split_begin,
                                                       digits.end());
     } else {
         auto split_end = split_begin + split_size;
-        auto piece     = std::vector<digit_type>(split_begin, split_end);
+        auto piece     = SmallVector<digit_type>(split_begin, split_end);
         trim_trailing_zeros(piece);
 
         result[SPLIT_INDEX] = std::move(piece);
@@ -62,15 +62,15 @@ split(const std::vector<digit_type>                     &digits,
  * @pre `digits.size() > (split_size * (COUNT_PIECES - 1))`
  */
 template<std::size_t COUNT_PIECES>
-std::array<std::vector<digit_type>, COUNT_PIECES>
-split_digits(const std::vector<digit_type>      &digits,
-             std::vector<digit_type>::size_type  split_size)
+std::array<SmallVector<digit_type>, COUNT_PIECES>
+split_digits(DigitsView                          digits,
+             SmallVector<digit_type>::size_type  split_size)
 {
     static_assert(COUNT_PIECES > 0);
 
     assert(digits.size() > (split_size * (COUNT_PIECES - 1)));
 
-    std::array<std::vector<digit_type>, COUNT_PIECES> result;
+    std::array<SmallVector<digit_type>, COUNT_PIECES> result;
 
     split_digits_detail::split<0>(digits,
                                   split_size,
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 #include "tasty_int_test/floating_point_integral_limits.hpp"
 
 
@@ -24,11 +25,11 @@ template<typename OtherOperandType>
 struct BinaryDigitsOperationTestParam
 {
     /// The digits operand
-    std::vector<tasty_int::detail::digit_type> digits_operand;
+    tasty_int::detail::SmallVector<tasty_int::detail::digit_type> digits_operand;
     /// The other operand
-    OtherOperandType                           other_operand;
+    OtherOperandType                                              other_operand;
     /// The expected result
-    std::vector<tasty_int::detail::digit_type> expected_result;
+    tasty_int::detail::SmallVector<tasty_int::detail::digit_type> expected_result;
 }; // struct BinaryDigitsOperationTestParam
 
 
@@ -10,7 +10,7 @@
 
 #include "gtest/gtest.h"
 
-#include "tasty_int/detail/integral_digits_view.hpp"
+#include "tasty_int/detail/digit_from_nonnegative_value.hpp"
 #include "tasty_int/detail/conversions/digits_from_floating_point.hpp"
 #include "tasty_int/detail/conversions/digits_from_integral.hpp"
 #include "tasty_int/detail/conversions/integral_from_digits.hpp"
@@ -27,10 +27,12 @@ using tasty_int::detail::operator+;
 using tasty_int::detail::add_into;
 using tasty_int::detail::propagate_carry;
 using tasty_int::detail::add_at;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 using tasty_int::detail::digit_accumulator_type;
 using tasty_int::detail::DIGIT_TYPE_MAX;
-using tasty_int::detail::IntegralDigitsView;
+using tasty_int::detail::DIGIT_TYPE_BITS;
+using tasty_int::detail::digit_from_nonnegative_value;
 using tasty_int::detail::conversions::digits_from_floating_point;
 using tasty_int::detail::conversions::digits_from_integral;
 using tasty_int::detail::conversions::integral_from_digits;
@@ -82,7 +84,7 @@ template<typename ArithmeticType,
          typename DigitsAndDigitsOperation>
 std::vector<BinaryDigitsOperationTestParam<ArithmeticType>>
 make_arithmetic_integration_test_params(
-    std::vector<tasty_int::detail::digit_type>
+    tasty_int::detail::SmallVector<tasty_int::detail::digit_type>
                             (*digits_from_arithmetic)(ArithmeticType),
     DigitsAndDigitsOperation  operation
 )
@@ -115,7 +117,7 @@ make_arithmetic_integration_test_params(
 template<typename OtherOperandType>
 std::vector<BinaryDigitsOperationTestParam<OtherOperandType>>
 make_addition_integration_test_params(
-    std::vector<tasty_int::detail::digit_type>
+    tasty_int::detail::SmallVector<tasty_int::detail::digit_type>
     (*digits_from_user_type)(OtherOperandType)
 )
     requires std::is_arithmetic_v<OtherOperandType>
@@ -132,18 +134,20 @@ make_addition_integration_test_params(
 
 TEST(DigitsAndDigitsAdditionTest, DigitsPlusEqualsDigitsReturnsReferenceToLhs)
 {
-    std::vector<digit_type> lhs = { 1, 2, 3 };
-    std::vector<digit_type> rhs = { 4, 5, 6 };
+    SmallVector<digit_type> lhs = { 1, 2, 3 };
+    SmallVector<digit_type> rhs = { 4, 5, 6 };
 
     EXPECT_EQ(&lhs, &(lhs += rhs));
 }
 
 TEST(DigitsAndDigitsAdditionTest, DigitsPlusEqualsSelfDoublesValue)
 {
-    std::vector<digit_type> digits = { 1, 0, 2, DIGIT_TYPE_MAX, 1 };
-    IntegralDigitsView carry(DIGIT_TYPE_MAX * 2);
-    std::vector<digit_type> expected = {
-        2, 0, 4, carry.low_digit(), carry.high_digit() + 2
+    SmallVector<digit_type> digits = { 1, 0, 2, DIGIT_TYPE_MAX, 1 };
+    digit_accumulator_type carry = DIGIT_TYPE_MAX * 2;
+    SmallVector<digit_type> expected = {
+        2, 0, 4,
+        digit_from_nonnegative_value(carry),
+        digit_from_nonnegative_value(carry >> DIGIT_TYPE_BITS) + 2
     };
 
     digits += digits;
@@ -153,15 +157,15 @@ TEST(DigitsAndDigitsAdditionTest, DigitsPlusEqualsSelfDoublesValue)
 
 class DigitsAndDigitsAdditionTest
     : public ::testing::TestWithParam<
-                 BinaryDigitsOperationTestParam<std::vector<digit_type>>
+                 BinaryDigitsOperationTestParam<SmallVector<digit_type>>
              >
 {}; // class DigitsAndDigitsAdditionTest
 
 TEST_P(DigitsAndDigitsAdditionTest, DigitsPlusEqualsDigits)
 {
-    std::vector<digit_type>        lhs             = GetParam().digits_operand;
-    const std::vector<digit_type> &rhs             = GetParam().other_operand;
-    const std::vector<digit_type> &expected_result = GetParam().expected_result;
+    SmallVector<digit_type>        lhs             = GetParam().digits_operand;
+    const SmallVector<digit_type> &rhs             = GetParam().other_operand;
+    const SmallVector<digit_type> &expected_result = GetParam().expected_result;
 
     lhs += rhs;
 
@@ -170,9 +174,9 @@ TEST_P(DigitsAndDigitsAdditionTest, DigitsPlusEqualsDigits)
 
 TEST_P(DigitsAndDigitsAdditionTest, DigitsPlusDigits)
 {
-    const std::vector<digit_type> &lhs             = GetParam().digits_operand;
-    const std::vector<digit_type> &rhs             = GetParam().other_operand;
-    const std::vector<digit_type> &expected_result = GetParam().expected_result;
+    const SmallVector<digit_type> &lhs             = GetParam().digits_operand;
+    const SmallVector<digit_type> &rhs             = GetParam().other_operand;
+    const SmallVector<digit_type> &expected_result = GetParam().expected_result;
 
     auto result = lhs + rhs;
 
@@ -183,7 +187,7 @@ INSTANTIATE_TEST_SUITE_P(
     DigitsAndDigitsAdditionTestWithoutCarry,
     DigitsAndDigitsAdditionTest,
     ::testing::ValuesIn(
-        std::vector<BinaryDigitsOperationTestParam<std::vector<digit_type>>> {
+        std::vector<BinaryDigitsOperationTestParam<SmallVector<digit_type>>> {
             { { 0 }, { 0 }, { 0 } },
             { { 1 }, { 2 }, { 3 } },
 
@@ -203,7 +207,7 @@ INSTANTIATE_TEST_SUITE_P(
     DigitsAndDigitsAdditionTestWithCarry,
     DigitsAndDigitsAdditionTest,
     ::testing::ValuesIn(
-        std::vector<BinaryDigitsOperationTestParam<std::vector<digit_type>>> {
+        std::vector<BinaryDigitsOperationTestParam<SmallVector<digit_type>>> {
             {
                 { DIGIT_TYPE_MAX }, { 1 }, { 0, 1 }
             },
@@ -246,7 +250,7 @@ INSTANTIATE_TEST_SUITE_P(
 TEST(DigitsAndIntegralAdditionTest,
      DigitsPlusEqualsIntegralReturnsReferenceToLhs)
 {
-    std::vector<digit_type> lhs = { 1, 2, 3 };
+    SmallVector<digit_type> lhs = { 1, 2, 3 };
     std::uintmax_t          rhs = 456;
 
     EXPECT_EQ(&lhs, &(lhs += rhs));
@@ -270,6 +274,7 @@ DigitsAndIntegralAdditionTest::BASE_TEST_PARAMS = {
     { { 0 },  DIGIT_TYPE_MAX, { DIGIT_TYPE_MAX } },
     { { 1 },  DIGIT_TYPE_MAX, { 0, 1 } },
 
+#if !TASTY_INT_HAVE_INT128_ACCUMULATOR
     {
         {                                        0 },
         std::numeric_limits<std::uintmax_t>::max(),
@@ -290,13 +295,14 @@ DigitsAndIntegralAdditionTest::BASE_TEST_PARAMS = {
         std::numeric_limits<std::uintmax_t>::max(),
         { 0, 2, 4, 4, 5 }
     }
+#endif // if !TASTY_INT_HAVE_INT128_ACCUMULATOR
 };
 
 TEST_P(DigitsAndIntegralAdditionTest, DigitsPlusEqualsIntegral)
 {
-    std::vector<digit_type>        lhs             = GetParam().digits_operand;
+    SmallVector<digit_type>        lhs             = GetParam().digits_operand;
     std::uintmax_t                 rhs             = GetParam().other_operand;
-    const std::vector<digit_type> &expected_result = GetParam().expected_result;
+    const SmallVector<digit_type> &expected_result = GetParam().expected_result;
 
     lhs += rhs;
 
@@ -305,9 +311,9 @@ TEST_P(DigitsAndIntegralAdditionTest, DigitsPlusEqualsIntegral)
 
 TEST_P(DigitsAndIntegralAdditionTest, DigitsPlusIntegral)
 {
-    const std::vector<digit_type> &lhs             = GetParam().digits_operand;
+    const SmallVector<digit_type> &lhs             = GetParam().digits_operand;
     std::uintmax_t                 rhs             = GetParam().other_operand;
-    const std::vector<digit_type> &expected_result = GetParam().expected_result;
+    const SmallVector<digit_type> &expected_result = GetParam().expected_result;
 
     auto result = lhs + rhs;
 
@@ -317,8 +323,8 @@ TEST_P(DigitsAndIntegralAdditionTest, DigitsPlusIntegral)
 TEST_P(DigitsAndIntegralAdditionTest, IntegralPlusDigits)
 {
     std::uintmax_t                 lhs             = GetParam().other_operand;
-    const std::vector<digit_type> &rhs             = GetParam().digits_operand;
-    const std::vector<digit_type> &expected_result = GetParam().expected_result;
+    const SmallVector<digit_type> &rhs             = GetParam().digits_operand;
+    const SmallVector<digit_type> &expected_result = GetParam().expected_result;
 
     auto result = lhs + rhs;
 
@@ -355,9 +361,9 @@ DigitsAndFloatingPointAdditionTest::BASE_TEST_PARAMS =
 
 TEST_P(DigitsAndFloatingPointAdditionTest, DigitsPlusEqualsFloatingPoint)
 {
-    std::vector<digit_type>        lhs             = GetParam().digits_operand;
+    SmallVector<digit_type>        lhs             = GetParam().digits_operand;
     long double                    rhs             = GetParam().other_operand;
-    const std::vector<digit_type> &expected_result = GetParam().expected_result;
+    const SmallVector<digit_type> &expected_result = GetParam().expected_result;
 
     lhs += rhs;
 
@@ -366,9 +372,9 @@ TEST_P(DigitsAndFloatingPointAdditionTest, DigitsPlusEqualsFloatingPoint)
 
 TEST_P(DigitsAndFloatingPointAdditionTest, DigitsPlusFloatingPoint)
 {
-    const std::vector<digit_type> &lhs             = GetParam().digits_operand;
+    const SmallVector<digit_type> &lhs             = GetParam().digits_operand;
     long double                    rhs             = GetParam().other_operand;
-    const std::vector<digit_type> &expected_result = GetParam().expected_result;
+    const SmallVector<digit_type> &expected_result = GetParam().expected_result;
 
     auto result = lhs + rhs;
 
@@ -378,8 +384,8 @@ TEST_P(DigitsAndFloatingPointAdditionTest, DigitsPlusFloatingPoint)
 TEST_P(DigitsAndFloatingPointAdditionTest, FloatingPointPlusDigits)
 {
     long double                    lhs             = GetParam().other_operand;
-    const std::vector<digit_type> &rhs             = GetParam().digits_operand;
-    const std::vector<digit_type> &expected_result = GetParam().expected_result;
+    const SmallVector<digit_type> &rhs             = GetParam().digits_operand;
+    const SmallVector<digit_type> &expected_result = GetParam().expected_result;
 
     auto result = lhs + rhs;
 
@@ -414,6 +420,21 @@ INSTANTIATE_TEST_SUITE_P(
     )
 );
 
+INSTANTIATE_TEST_SUITE_P(
+    DigitsAndFloatingPointAdditionCarryTest,
+    DigitsAndFloatingPointAdditionTest,
+    ::testing::ValuesIn(
+        std::vector<BinaryDigitsOperationTestParam<long double>> {
+            // the carry out of the top digit leaves it zero
+            {
+                { 0, digit_type(1) << (DIGIT_TYPE_BITS - 1) },
+                std::ldexp(1.0L, (2 * DIGIT_TYPE_BITS) - 1),
+                { 0, 0, 1 }
+            }
+        }
+    )
+);
+
 INSTANTIATE_TEST_SUITE_P(
     DigitsAndFloatingPointAdditionIntegrationTest,
     DigitsAndFloatingPointAdditionTest,
@@ -427,14 +448,14 @@ class AddIntoTest : public ::testing::Test
 {
 protected:
     using ResultType = std::pair<digit_accumulator_type,
-                                 std::vector<digit_type>::iterator>;
+                                 SmallVector<digit_type>::iterator>;
 
     void
     check_result(digit_accumulator_type expected_carry,
                  ResultType             result);
 
-    std::vector<digit_type> augend;
-    std::vector<digit_type> addend;
+    SmallVector<digit_type> augend;
+    SmallVector<digit_type> addend;
 }; // class AddIntoTest
 
 void
@@ -471,15 +492,15 @@ class PropagateCarryTest : public ::testing::Test
 protected:
     void
     check_result(digit_accumulator_type         expected_carry,
-                 const std::vector<digit_type> &expected_augend,
+                 const SmallVector<digit_type> &expected_augend,
                  digit_accumulator_type         carry);
 
-    std::vector<digit_type> augend;
+    SmallVector<digit_type> augend;
 }; // class PropagateCarryTest
 
 void
 PropagateCarryTest::check_result(digit_accumulator_type         expected_carry,
-                                 const std::vector<digit_type> &expected_augend,
+                                 const SmallVector<digit_type> &expected_augend,
                                  digit_accumulator_type         carry)
 {
     EXPECT_EQ(expected_carry,  carry);
@@ -519,15 +540,15 @@ class AddAtTest : public ::testing::Test
 protected:
     void
     check_result(digit_accumulator_type         expected_carry,
-                 const std::vector<digit_type> &expected_augend,
+                 const SmallVector<digit_type> &expected_augend,
                  digit_accumulator_type         carry);
 
-    std::vector<digit_type> augend;
+    SmallVector<digit_type> augend;
 }; // class AddAtTest
 
 void
 AddAtTest::check_result(digit_accumulator_type         expected_carry,
-                        const std::vector<digit_type> &expected_augend,
+                        const SmallVector<digit_type> &expected_augend,
                         digit_accumulator_type         carry)
 {
     EXPECT_EQ(expected_carry,  carry);
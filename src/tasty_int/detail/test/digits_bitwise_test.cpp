@@ -11,6 +11,7 @@ using tasty_int::detail::DigitsShiftOffset;
 using tasty_int::detail::count_leading_zero_bits_from_digit;
 using tasty_int::detail::operator<<;
 using tasty_int::detail::operator<<=;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 using tasty_int::detail::DIGIT_TYPE_MAX;
 using tasty_int::detail::DIGIT_TYPE_BITS;
@@ -49,16 +50,16 @@ INSTANTIATE_TEST_SUITE_P(
 
 TEST(LeftShiftDigitOffsetInPlaceTest, ReturnsReferenceToDigits)
 {
-    std::vector<digit_type> digits = { 1, 2, 3 };
+    SmallVector<digit_type> digits = { 1, 2, 3 };
 
     EXPECT_EQ(&digits, &(digits <<= 11));
 }
 
 TEST(LeftShiftDigitOffsetInPlaceTest, ZeroWithZeroDigitOffset)
 {
-    std::vector<digit_type> digits          = { 0 };
-    std::vector<digit_type>::size_type ZERO = 0;
-    std::vector<digit_type> expected_result = digits;
+    SmallVector<digit_type> digits          = { 0 };
+    SmallVector<digit_type>::size_type ZERO = 0;
+    SmallVector<digit_type> expected_result = digits;
 
     digits <<= ZERO;
 
@@ -67,9 +68,9 @@ TEST(LeftShiftDigitOffsetInPlaceTest, ZeroWithZeroDigitOffset)
 
 TEST(LeftShiftDigitOffsetInPlaceTest, ZeroWithNonzeroDigitOffset)
 {
-    std::vector<digit_type> digits                  = { 0 };
-    std::vector<digit_type>::size_type digit_offset = 7;
-    std::vector<digit_type> expected_result         = digits;
+    SmallVector<digit_type> digits                  = { 0 };
+    SmallVector<digit_type>::size_type digit_offset = 7;
+    SmallVector<digit_type> expected_result         = digits;
 
     digits <<= digit_offset;
 
@@ -78,9 +79,9 @@ TEST(LeftShiftDigitOffsetInPlaceTest, ZeroWithNonzeroDigitOffset)
 
 TEST(LeftShiftDigitOffsetInPlaceTest, NonzeroWithZeroDigitOffset)
 {
-    std::vector<digit_type> digits          = { 1, 2, 3 };
-    std::vector<digit_type>::size_type ZERO = 0;
-    std::vector<digit_type> expected_result = digits;
+    SmallVector<digit_type> digits          = { 1, 2, 3 };
+    SmallVector<digit_type>::size_type ZERO = 0;
+    SmallVector<digit_type> expected_result = digits;
 
     digits <<= ZERO;
 
@@ -89,9 +90,9 @@ TEST(LeftShiftDigitOffsetInPlaceTest, NonzeroWithZeroDigitOffset)
 
 TEST(LeftShiftDigitOffsetInPlaceTest, NonzeroWithNonzeroDigitOffset)
 {
-    std::vector<digit_type> digits                  = { 1, 2, 3 };
-    std::vector<digit_type>::size_type digit_offset = 5;
-    std::vector<digit_type> expected_result = { 0, 0, 0, 0, 0, 1, 2, 3 };
+    SmallVector<digit_type> digits                  = { 1, 2, 3 };
+    SmallVector<digit_type>::size_type digit_offset = 5;
+    SmallVector<digit_type> expected_result = { 0, 0, 0, 0, 0, 1, 2, 3 };
 
     digits <<= digit_offset;
 
@@ -100,9 +101,9 @@ TEST(LeftShiftDigitOffsetInPlaceTest, NonzeroWithNonzeroDigitOffset)
 
 TEST(LeftShiftDigitsShiftOffsetInPlaceTest, Zero)
 {
-    std::vector<digit_type> digits          = { 0 };
+    SmallVector<digit_type> digits          = { 0 };
     DigitsShiftOffset offset                = { .digits = 7, .bits = 11 };
-    std::vector<digit_type> expected_result = digits;
+    SmallVector<digit_type> expected_result = digits;
 
     auto result = digits << offset;
 
@@ -111,9 +112,9 @@ TEST(LeftShiftDigitsShiftOffsetInPlaceTest, Zero)
 
 TEST(LeftShiftDigitsShiftOffsetInPlaceTest, NoOffset)
 {
-    std::vector<digit_type> digits          = { DIGIT_TYPE_MAX };
+    SmallVector<digit_type> digits          = { DIGIT_TYPE_MAX };
     DigitsShiftOffset offset                = { .digits = 0, .bits = 0 };
-    std::vector<digit_type> expected_result = digits;
+    SmallVector<digit_type> expected_result = digits;
 
     auto result = digits << offset;
 
@@ -122,9 +123,9 @@ TEST(LeftShiftDigitsShiftOffsetInPlaceTest, NoOffset)
 
 TEST(LeftShiftDigitsShiftOffsetInPlaceTest, DigitsOffset)
 {
-    std::vector<digit_type> digits = { DIGIT_TYPE_MAX, DIGIT_TYPE_MAX };
+    SmallVector<digit_type> digits = { DIGIT_TYPE_MAX, DIGIT_TYPE_MAX };
     DigitsShiftOffset offset       = { .digits = 3, .bits = 0 };
-    std::vector<digit_type> expected_result = {
+    SmallVector<digit_type> expected_result = {
         0, 0, 0, DIGIT_TYPE_MAX, DIGIT_TYPE_MAX
     };
 
@@ -135,9 +136,9 @@ TEST(LeftShiftDigitsShiftOffsetInPlaceTest, DigitsOffset)
 
 TEST(LeftShiftDigitsShiftOffsetInPlaceTest, BitsOffsetNoOverlap)
 {
-    std::vector<digit_type> digits          = { 0, 1, 2 };
+    SmallVector<digit_type> digits          = { 0, 1, 2 };
     DigitsShiftOffset offset                = { .digits = 0, .bits = 5 };
-    std::vector<digit_type> expected_result = { 0, 1 << 5, 2 << 5 };
+    SmallVector<digit_type> expected_result = { 0, 1 << 5, 2 << 5 };
 
     auto result = digits << offset;
 
@@ -146,11 +147,11 @@ TEST(LeftShiftDigitsShiftOffsetInPlaceTest, BitsOffsetNoOverlap)
 
 TEST(LeftShiftDigitsShiftOffsetInPlaceTest, BitsOffsetWithOverlap)
 {
-    std::vector<digit_type> digits = {
+    SmallVector<digit_type> digits = {
         DIGIT_TYPE_MAX / 2, DIGIT_TYPE_MAX / 4, 0b010101, 1
     };
     DigitsShiftOffset offset = { .digits  = 0, .bits = 4 };
-    std::vector<digit_type> expected_result = { 
+    SmallVector<digit_type> expected_result = { 
         DIGIT_TYPE_MAX ^ 0b1111, // 4 lsb zeros
         DIGIT_TYPE_MAX ^ 0b1000, // 1 zero at bit position 3
         0b0101010011,
@@ -164,9 +165,9 @@ TEST(LeftShiftDigitsShiftOffsetInPlaceTest, BitsOffsetWithOverlap)
 
 TEST(LeftShiftDigitsShiftOffsetInPlaceTest, DigitsAndBitsOffsetNoOverlap)
 {
-    std::vector<digit_type> digits = { 1, 2, 3, 4 };
+    SmallVector<digit_type> digits = { 1, 2, 3, 4 };
     DigitsShiftOffset offset       = { .digits  = 4, .bits = 7 };
-    std::vector<digit_type> expected_result = {
+    SmallVector<digit_type> expected_result = {
         0, 0, 0, 0, 1 << 7, 2 << 7, 3 << 7, 4 << 7
     };
 
@@ -177,7 +178,7 @@ TEST(LeftShiftDigitsShiftOffsetInPlaceTest, DigitsAndBitsOffsetNoOverlap)
 
 TEST(LeftShiftDigitsShiftOffsetInPlaceTest, DigitsAndBitsOffsetWithOverlap)
 {
-    std::vector<digit_type> digits = {
+    SmallVector<digit_type> digits = {
         DIGIT_TYPE_MAX >> 1,
         DIGIT_TYPE_MAX >> 2,
         0,
@@ -185,7 +186,7 @@ TEST(LeftShiftDigitsShiftOffsetInPlaceTest, DigitsAndBitsOffsetWithOverlap)
         DIGIT_TYPE_MAX >> 4
     };
     DigitsShiftOffset offset = { .digits = 2, .bits = 5 };
-    std::vector<digit_type> expected_result = {
+    SmallVector<digit_type> expected_result = {
         0,
         0,
         digit_from_nonnegative_value(DIGIT_TYPE_MAX << 5),
@@ -203,7 +204,7 @@ TEST(LeftShiftDigitsShiftOffsetInPlaceTest, DigitsAndBitsOffsetWithOverlap)
 
 TEST(RightShiftDigitsShiftOffsetInPlaceTest, ReturnsReferenceToDigits)
 {
-    std::vector<digit_type> digits = { 1, 2, 3 };
+    SmallVector<digit_type> digits = { 1, 2, 3 };
     DigitsShiftOffset offset       = { .digits = 1, .bits = 3 };
 
     EXPECT_EQ(&digits, &(digits >>= offset));
@@ -211,9 +212,9 @@ TEST(RightShiftDigitsShiftOffsetInPlaceTest, ReturnsReferenceToDigits)
 
 TEST(RightShiftDigitsShiftOffsetInPlaceTest, Zero)
 {
-    std::vector<digit_type> digits          = { 0 };
+    SmallVector<digit_type> digits          = { 0 };
     DigitsShiftOffset offset                = { .digits = 33, .bits = 1 };
-    std::vector<digit_type> expected_result = digits;
+    SmallVector<digit_type> expected_result = digits;
 
     digits >>= offset;
 
@@ -222,9 +223,9 @@ TEST(RightShiftDigitsShiftOffsetInPlaceTest, Zero)
 
 TEST(RightShiftDigitsShiftOffsetInPlaceTest, NoOffset)
 {
-    std::vector<digit_type> digits          = { DIGIT_TYPE_MAX };
+    SmallVector<digit_type> digits          = { DIGIT_TYPE_MAX };
     DigitsShiftOffset offset                = { .digits = 0, .bits = 0 };
-    std::vector<digit_type> expected_result = digits;
+    SmallVector<digit_type> expected_result = digits;
 
     digits >>= offset;
 
@@ -233,9 +234,9 @@ TEST(RightShiftDigitsShiftOffsetInPlaceTest, NoOffset)
 
 TEST(RightShiftDigitsShiftOffsetInPlaceTest, DigitsOffsetWithUnderflow)
 {
-    std::vector<digit_type> digits          = { 1, 2, 3, 4, 5 };
+    SmallVector<digit_type> digits          = { 1, 2, 3, 4, 5 };
     DigitsShiftOffset offset                = { .digits = 5, .bits = 0 };
-    std::vector<digit_type> expected_result = { 0 };
+    SmallVector<digit_type> expected_result = { 0 };
 
     digits >>= offset;
 
@@ -244,9 +245,9 @@ TEST(RightShiftDigitsShiftOffsetInPlaceTest, DigitsOffsetWithUnderflow)
 
 TEST(RightShiftDigitsShiftOffsetInPlaceTest, DigitsOffset)
 {
-    std::vector<digit_type> digits          = { 1, 2, 3, 4, 5 };
+    SmallVector<digit_type> digits          = { 1, 2, 3, 4, 5 };
     DigitsShiftOffset offset                = { .digits = 2, .bits = 0 };
-    std::vector<digit_type> expected_result = { 3, 4, 5 };
+    SmallVector<digit_type> expected_result = { 3, 4, 5 };
 
     digits >>= offset;
 
@@ -255,9 +256,9 @@ TEST(RightShiftDigitsShiftOffsetInPlaceTest, DigitsOffset)
 
 TEST(RightShiftDigitsShiftOffsetInPlaceTest, BitsOffsetWithUnderflow)
 {
-    std::vector<digit_type> digits = { 7 };
+    SmallVector<digit_type> digits = { 7 };
     DigitsShiftOffset offset       = { .digits = 0, .bits = DIGIT_TYPE_BITS };
-    std::vector<digit_type> expected_result = { 0 };
+    SmallVector<digit_type> expected_result = { 0 };
 
     digits >>= offset;
 
@@ -266,9 +267,9 @@ TEST(RightShiftDigitsShiftOffsetInPlaceTest, BitsOffsetWithUnderflow)
 
 TEST(RightShiftDigitsShiftOffsetInPlaceTest, BitsOffsetToZero)
 {
-    std::vector<digit_type> digits = { DIGIT_TYPE_MAX };
+    SmallVector<digit_type> digits = { DIGIT_TYPE_MAX };
     DigitsShiftOffset offset       = { .digits = 0, .bits = DIGIT_TYPE_BITS };
-    std::vector<digit_type> expected_result = { 0 };
+    SmallVector<digit_type> expected_result = { 0 };
 
     digits >>= offset;
 
@@ -277,9 +278,9 @@ TEST(RightShiftDigitsShiftOffsetInPlaceTest, BitsOffsetToZero)
 
 TEST(RightShiftDigitsShiftOffsetInPlaceTest, BitsOffsetNoOverlap)
 {
-    std::vector<digit_type> digits = { 2, 2, 2, 2, 2 };
+    SmallVector<digit_type> digits = { 2, 2, 2, 2, 2 };
     DigitsShiftOffset offset       = { .digits = 0, .bits = 1 };
-    std::vector<digit_type> expected_result = { 1, 1, 1, 1, 1 };
+    SmallVector<digit_type> expected_result = { 1, 1, 1, 1, 1 };
 
     digits >>= offset;
 
@@ -288,14 +289,14 @@ TEST(RightShiftDigitsShiftOffsetInPlaceTest, BitsOffsetNoOverlap)
 
 TEST(RightShiftDigitsShiftOffsetInPlaceTest, BitsOffsetWithOverlap)
 {
-    std::vector<digit_type> digits = { 1, DIGIT_TYPE_MAX, 2 };
+    SmallVector<digit_type> digits = { 1, DIGIT_TYPE_MAX, 2 };
     DigitsShiftOffset offset       = { .digits = 0, .bits = 5 };
-    std::vector<digit_type> expected_result = {
+    SmallVector<digit_type> expected_result = {
         digit_from_nonnegative_value(
             DIGIT_TYPE_MAX << (DIGIT_TYPE_BITS - 5)
         ),
         digit_from_nonnegative_value(
-            (DIGIT_TYPE_MAX >> 5) | (2 << (DIGIT_TYPE_BITS - 5))
+            (DIGIT_TYPE_MAX >> 5) | (digit_type(2) << (DIGIT_TYPE_BITS - 5))
         )
     };
 
@@ -306,9 +307,9 @@ TEST(RightShiftDigitsShiftOffsetInPlaceTest, BitsOffsetWithOverlap)
 
 TEST(RightShiftDigitsShiftOffsetInPlaceTest, DigitsAndBitsOffsetNoOverlap)
 {
-    std::vector<digit_type> digits          = { 1, 2, 4, 8, 16 };
+    SmallVector<digit_type> digits          = { 1, 2, 4, 8, 16 };
     DigitsShiftOffset offset                = { .digits = 2, .bits = 2 };
-    std::vector<digit_type> expected_result = { 1, 2, 4 };
+    SmallVector<digit_type> expected_result = { 1, 2, 4 };
 
     digits >>= offset;
 
@@ -317,9 +318,9 @@ TEST(RightShiftDigitsShiftOffsetInPlaceTest, DigitsAndBitsOffsetNoOverlap)
 
 TEST(RightShiftDigitsShiftOffsetInPlaceTest, DigitsAndBitsOffsetWithOverlap)
 {
-    std::vector<digit_type> digits = { 0, DIGIT_TYPE_MAX, 16, DIGIT_TYPE_MAX };
+    SmallVector<digit_type> digits = { 0, DIGIT_TYPE_MAX, 16, DIGIT_TYPE_MAX };
     DigitsShiftOffset offset       = { .digits = 2, .bits = 3 };
-    std::vector<digit_type> expected_result = {
+    SmallVector<digit_type> expected_result = {
         digit_from_nonnegative_value(
             (16 >> 3) | (DIGIT_TYPE_MAX << (DIGIT_TYPE_BITS - 3))
         ),
@@ -335,9 +336,9 @@ TEST(RightShiftDigitsShiftOffsetInPlaceTest, DigitsAndBitsOffsetWithOverlap)
 
 TEST(RightShiftDigitsShiftOffsetInPlaceTest, DigitsAndBitsOffsetToZero)
 {
-    std::vector<digit_type> digits = { 0, 1 };
+    SmallVector<digit_type> digits = { 0, 1 };
     DigitsShiftOffset offset       = { .digits = 1, .bits = 1 };
-    std::vector<digit_type> expected_result = { 0 };
+    SmallVector<digit_type> expected_result = { 0 };
 
     digits >>= offset;
 
@@ -1,5 +1,7 @@
 #include "tasty_int/detail/digits_comparison.hpp"
 
+#include <cmath>
+
 #include <array>
 #include <limits>
 
@@ -21,6 +23,7 @@ using tasty_int::detail::operator>;
 using tasty_int::detail::operator<=;
 using tasty_int::detail::operator>=;
 using tasty_int::detail::less_than;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 using tasty_int::detail::DIGIT_TYPE_MAX;
 using tasty_int::detail::DIGIT_BASE;
@@ -30,18 +33,18 @@ using comparison_test_common::InequalityTestParam;
 
 /**
  * The point of this wrapper is to expose the comparison operator overloads for
- * `std::vector<digit_type>` that are declared in the `tasty_int::detail`
+ * `SmallVector<digit_type>` that are declared in the `tasty_int::detail`
  * namespace to the test routines `expect_equal` and `expect_unequal,` which
  * are declared in the `tasty_int_test` namespace.  The `using
  * tasty_int::detail::operator` declarations in this namespace are essential.
  */
-class WrappedDigits : public std::vector<digit_type>
+class WrappedDigits : public SmallVector<digit_type>
 {
 public:
-    using std::vector<digit_type>::vector;
+    using SmallVector<digit_type>::SmallVector;
 
-    WrappedDigits(std::vector<digit_type>&& base)
-        : std::vector<digit_type>(std::move(base))
+    WrappedDigits(SmallVector<digit_type>&& base)
+        : SmallVector<digit_type>(std::move(base))
     {}
 }; // class WrappedDigits
 
@@ -145,25 +148,33 @@ TEST_P(DigitsLessThanIntegralTest, LhsLessThanRhs)
     tasty_int_test::expect_unequal(lesser, greater);
 }
 
+const std::vector<DigitsSmallerThanIntegralTestParam>
+DIGITS_LESS_THAN_INTEGRAL_TEST_PARAMS = {
+    { { 0 },              /* < */ 1  },
+    { { 1 },              /* < */ 2  },
+#if TASTY_INT_HAVE_INT128_ACCUMULATOR
+    {
+        { DIGIT_TYPE_MAX - 1 },
+        std::numeric_limits<std::uintmax_t>::max()
+    }
+#else
+    { { DIGIT_TYPE_MAX }, /* < */ DIGIT_BASE },
+    { { 0, 1 },           /* < */ DIGIT_BASE + 1  },
+    {
+        { 0, DIGIT_TYPE_MAX },
+        std::numeric_limits<std::uintmax_t>::max()
+    },
+    {
+        { DIGIT_TYPE_MAX - 1, DIGIT_TYPE_MAX },
+        std::numeric_limits<std::uintmax_t>::max()
+    }
+#endif // if TASTY_INT_HAVE_INT128_ACCUMULATOR
+};
+
 INSTANTIATE_TEST_SUITE_P(
     DigitsComparisonTest,
     DigitsLessThanIntegralTest,
-    ::testing::ValuesIn(
-        std::vector<DigitsSmallerThanIntegralTestParam> {
-            { { 0 },              /* < */ 1  },
-            { { 1 },              /* < */ 2  },
-            { { DIGIT_TYPE_MAX }, /* < */ DIGIT_BASE },
-            { { 0, 1 },           /* < */ DIGIT_BASE + 1  },
-            {
-                { 0, DIGIT_TYPE_MAX },
-                std::numeric_limits<std::uintmax_t>::max()
-            },
-            {
-                { DIGIT_TYPE_MAX - 1, DIGIT_TYPE_MAX },
-                std::numeric_limits<std::uintmax_t>::max()
-            }
-        }
-    )
+    ::testing::ValuesIn(DIGITS_LESS_THAN_INTEGRAL_TEST_PARAMS)
 );
 
 using IntegralSmallerThanDigitsTestParam =
@@ -181,25 +192,37 @@ TEST_P(IntegralLessThanDigitsTest, LhsLessThanRhs)
     tasty_int_test::expect_unequal(lesser, greater);
 }
 
+const std::vector<IntegralSmallerThanDigitsTestParam>
+INTEGRAL_LESS_THAN_DIGITS_TEST_PARAMS = {
+    { .smaller = 0,              .larger = { 1 } },
+    { .smaller = 1,              .larger = { 2 } },
+    { .smaller = DIGIT_TYPE_MAX, .larger = { 0, 1 } },
+#if TASTY_INT_HAVE_INT128_ACCUMULATOR
+    {
+        .smaller = std::numeric_limits<std::uintmax_t>::max(),
+        .larger  = { 0, 1 }
+    },
+    {
+        .smaller = std::numeric_limits<std::uintmax_t>::max() - 1,
+        .larger  = { DIGIT_TYPE_MAX }
+    }
+#else
+    { .smaller = DIGIT_BASE,     .larger = { 1, 1 } },
+    {
+        .smaller = std::numeric_limits<std::uintmax_t>::max(),
+        .larger  = { 0, 0, 1 }
+    },
+    {
+        .smaller = std::numeric_limits<std::uintmax_t>::max() - 1,
+        .larger  = { DIGIT_TYPE_MAX, DIGIT_TYPE_MAX }
+    }
+#endif // if TASTY_INT_HAVE_INT128_ACCUMULATOR
+};
+
 INSTANTIATE_TEST_SUITE_P(
     DigitsComparisonTest,
     IntegralLessThanDigitsTest,
-    ::testing::ValuesIn(
-        std::vector<IntegralSmallerThanDigitsTestParam> {
-            { .smaller = 0,              .larger = { 1 } },
-            { .smaller = 1,              .larger = { 2 } },
-            { .smaller = DIGIT_TYPE_MAX, .larger = { 0, 1 } },
-            { .smaller = DIGIT_BASE,     .larger = { 1, 1 } },
-            {
-                .smaller = std::numeric_limits<std::uintmax_t>::max(),
-                .larger  = { 0, 0, 1 }
-            },
-            {
-                .smaller = std::numeric_limits<std::uintmax_t>::max() - 1,
-                .larger  = { DIGIT_TYPE_MAX, DIGIT_TYPE_MAX }
-            }
-        }
-    )
+    ::testing::ValuesIn(INTEGRAL_LESS_THAN_DIGITS_TEST_PARAMS)
 );
 
 
@@ -289,7 +312,11 @@ INSTANTIATE_TEST_SUITE_P(
             { .smaller = 0.9L,              .larger = { 1 } },
             { .smaller = 1.9L,              .larger = { 2 } },
             { .smaller = DIGIT_TYPE_MAX,    .larger = { 0, 1 } },
-            { .smaller = DIGIT_BASE - 0.1L, .larger = { 0, 1 } },
+            {
+                .smaller = std::nextafter(static_cast<long double>(DIGIT_BASE),
+                                          0.0L),
+                .larger  = { 0, 1 }
+            },
             { .smaller = DIGIT_BASE,        .larger = { 1, 1 } },
             { .smaller = 1.1L,              .larger = { 0, 0, 1 } },
             {
@@ -308,9 +335,9 @@ INSTANTIATE_TEST_SUITE_P(
 
 struct DigitsSequenceTestParam
 {
-    std::vector<digit_type>             digits;
-    std::vector<digit_type>::size_type  begin_offset;
-    std::vector<digit_type>::size_type  end_offset;
+    SmallVector<digit_type>             digits;
+    SmallVector<digit_type>::size_type  begin_offset;
+    SmallVector<digit_type>::size_type  end_offset;
 }; // struct DigitsSequenceTestParam
 
 std::ostream &
@@ -338,7 +365,7 @@ operator<<(std::ostream                            &output,
                   << " }";
 }
 
-std::array<std::vector<digit_type>::const_iterator, 4>
+std::array<SmallVector<digit_type>::const_iterator, 4>
 unpack(const DigitsSequenceComparisonTestParam &test_param)
 {
     auto &&[ lhs, rhs ] = test_param;
@@ -356,10 +383,10 @@ class DigitsSequenceLessThanInequalityTest
 {
 protected:
     static void
-    expect_unequal(std::vector<digit_type>::const_iterator lhs_begin,
-                   std::vector<digit_type>::const_iterator lhs_end,
-                   std::vector<digit_type>::const_iterator rhs_begin,
-                   std::vector<digit_type>::const_iterator rhs_end)
+    expect_unequal(SmallVector<digit_type>::const_iterator lhs_begin,
+                   SmallVector<digit_type>::const_iterator lhs_end,
+                   SmallVector<digit_type>::const_iterator rhs_begin,
+                   SmallVector<digit_type>::const_iterator rhs_end)
     {
         EXPECT_TRUE(less_than(lhs_begin, lhs_end,
                               rhs_begin, rhs_end));
@@ -8,9 +8,11 @@
 #include "gtest/gtest.h"
 
 #include "tasty_int/detail/digits_addition.hpp"
+#include "tasty_int/detail/digits_comparison.hpp"
 #include "tasty_int/detail/digits_multiplication.hpp"
 #include "tasty_int/detail/conversions/digits_from_integral.hpp"
 #include "tasty_int/detail/conversions/digits_from_floating_point.hpp"
+#include "tasty_int/detail/test/integer_test_common.hpp"
 #include "tasty_int_test/logarithmic_range.hpp"
 
 
@@ -20,29 +22,39 @@ using tasty_int::detail::divide;
 using tasty_int::detail::divide_in_place;
 using tasty_int::detail::divide_normalized_3n_2n_split;
 using tasty_int::detail::divide_normalized_2n_1n_split;
+using tasty_int::detail::divide_and_conquer_divide;
+using tasty_int::detail::newton_divide;
+using tasty_int::detail::remainder;
+using tasty_int::detail::long_divide;
+using tasty_int::detail::long_divide_remainder;
+using tasty_int::detail::divide_and_conquer_divide_remainder;
+using tasty_int::detail::newton_divide_remainder;
 using tasty_int::detail::DigitsDivisionResult;
+using tasty_int::detail::DigitsDivisor;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 using tasty_int::detail::DIGIT_TYPE_MAX;
 using tasty_int::detail::DIGIT_TYPE_BITS;
 using tasty_int::detail::DIGIT_BASE;
 using tasty_int::detail::operator+;
 using tasty_int::detail::operator*;
+using tasty_int::detail::make_arbitrary_digits;
 using tasty_int::detail::conversions::digits_from_integral;
 using tasty_int::detail::conversions::digits_from_floating_point;
 
 
-std::vector<digit_type>
-digit_base_power(std::vector<digit_type>::size_type exponent)
+SmallVector<digit_type>
+digit_base_power(SmallVector<digit_type>::size_type exponent)
 {
-    std::vector<digit_type> power(exponent + 1);
+    SmallVector<digit_type> power(exponent + 1);
     power.back() = 1;
     return power;
 }
 
 void
 expect_equal(const DigitsDivisionResult    &expected_result,
-             const std::vector<digit_type> &quotient,
-             const std::vector<digit_type> &remainder)
+             const SmallVector<digit_type> &quotient,
+             const SmallVector<digit_type> &remainder)
 {
     EXPECT_EQ(expected_result.quotient, quotient);
 
@@ -60,11 +72,11 @@ expect_equal(const DigitsDivisionResult &expected_result,
 
 template<typename DivisorType>
 void
-test_divide_in_place(const std::vector<digit_type> &dividend,
+test_divide_in_place(const SmallVector<digit_type> &dividend,
                      const DivisorType             &divisor,
                      const DigitsDivisionResult    &expected_result)
 {
-    std::vector<digit_type> result_digits = dividend;
+    SmallVector<digit_type> result_digits = dividend;
 
     auto remainder = divide_in_place(divisor, result_digits);
 
@@ -82,19 +94,30 @@ test_divide(const DividendType         &dividend,
     expect_equal(expected_result, result);
 }
 
+template<typename DivisorType>
+void
+test_remainder(const SmallVector<digit_type>  &dividend,
+               const DivisorType              &divisor,
+               const DigitsDivisionResult     &expected_result)
+{
+    EXPECT_EQ(expected_result.remainder, remainder(dividend, divisor));
+}
+
 template<typename DividendType, typename DivisorType>
 void
 test_division(const DividendType         &dividend,
               const DivisorType          &divisor,
               const DigitsDivisionResult &expected_result)
 {
-    if constexpr (std::is_same_v<DividendType, std::vector<digit_type>>)
+    if constexpr (std::is_same_v<DividendType, SmallVector<digit_type>>) {
         test_divide_in_place(dividend, divisor, expected_result);
+        test_remainder(dividend, divisor, expected_result);
+    }
 
     test_divide(dividend, divisor, expected_result);
 }
 
-const std::vector<std::vector<digit_type>> SAMPLE_DIVIDENDS = {
+const std::vector<SmallVector<digit_type>> SAMPLE_DIVIDENDS = {
     { 1 },
     { 2 },
     { DIGIT_TYPE_MAX },
@@ -111,22 +134,22 @@ const std::vector<std::vector<digit_type>> SAMPLE_DIVIDENDS = {
     { 0, 0, 0, 1 },
     { 1, 2, 3, 4, 5, 6, 7, 8, 9, 8, 7, 6, 5, 4, 3, 2, 1 },
     { DIGIT_TYPE_MAX, DIGIT_TYPE_MAX, DIGIT_TYPE_MAX },
-    std::vector<digit_type>(100, 6),
+    SmallVector<digit_type>(100, 6),
     { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 },
     digit_base_power(99),
-    std::vector<digit_type>(7, 19),
-    std::vector<digit_type>(250, DIGIT_TYPE_MAX)
+    SmallVector<digit_type>(7, 19),
+    SmallVector<digit_type>(250, DIGIT_TYPE_MAX)
 };
 
 
 class DigitsDivisionIdentitiesTest
-    : public ::testing::TestWithParam<std::vector<digit_type>>
+    : public ::testing::TestWithParam<SmallVector<digit_type>>
 {}; // class DigitsDivisionIdentitiesTest
 
 TEST_P(DigitsDivisionIdentitiesTest, DigitsDividedByIdenticalDigitsValue)
 {
-    std::vector<digit_type> dividend = GetParam();
-    std::vector<digit_type> divisor  = dividend;
+    SmallVector<digit_type> dividend = GetParam();
+    SmallVector<digit_type> divisor  = dividend;
     DigitsDivisionResult expected_result = {
         .quotient = { 1 }, .remainder = { 0 }
     };
@@ -136,7 +159,7 @@ TEST_P(DigitsDivisionIdentitiesTest, DigitsDividedByIdenticalDigitsValue)
 
 TEST_P(DigitsDivisionIdentitiesTest, DigitsDividedBySelfInPlace)
 {
-    std::vector<digit_type> dividend = GetParam();
+    SmallVector<digit_type> dividend = GetParam();
     const auto &divisor              = dividend;
     DigitsDivisionResult expected_result = {
         .quotient = { 1 }, .remainder = { 0 }
@@ -149,8 +172,8 @@ TEST_P(DigitsDivisionIdentitiesTest, DigitsDividedBySelfInPlace)
 
 TEST_P(DigitsDivisionIdentitiesTest, DigitsSquaredDividedByOriginalDigitsValue)
 {
-    std::vector<digit_type> divisor  = GetParam();
-    std::vector<digit_type> dividend = divisor * divisor;
+    SmallVector<digit_type> divisor  = GetParam();
+    SmallVector<digit_type> dividend = divisor * divisor;
     DigitsDivisionResult expected_result = {
         .quotient = divisor, .remainder = { 0 }
     };
@@ -160,8 +183,8 @@ TEST_P(DigitsDivisionIdentitiesTest, DigitsSquaredDividedByOriginalDigitsValue)
 
 TEST_P(DigitsDivisionIdentitiesTest, DigitsDividedByGreaterDigitsValue)
 {
-    std::vector<digit_type> dividend = GetParam();
-    std::vector<digit_type> divisor  = dividend + std::uintmax_t(1);
+    SmallVector<digit_type> dividend = GetParam();
+    SmallVector<digit_type> divisor  = dividend + std::uintmax_t(1);
     DigitsDivisionResult expected_result = {
         .quotient = { 0 }, .remainder = dividend
     };
@@ -178,8 +201,8 @@ INSTANTIATE_TEST_SUITE_P(
 
 struct DigitsDivisionArbitraryValuesTestParam
 {
-    std::vector<digit_type> dividend;
-    std::vector<digit_type> divisor;
+    SmallVector<digit_type> dividend;
+    SmallVector<digit_type> divisor;
     DigitsDivisionResult    expected_result;
 }; // DigitsDivisionArbitraryValuesTestParam
 
@@ -219,7 +242,7 @@ INSTANTIATE_TEST_SUITE_P(
             },
             {
                 .dividend        = { 0 },
-                .divisor         = std::vector<digit_type>(20, DIGIT_TYPE_MAX),
+                .divisor         = SmallVector<digit_type>(20, DIGIT_TYPE_MAX),
                 .expected_result = {
                     .quotient  = { 0 },
                     .remainder = { 0 }
@@ -248,11 +271,11 @@ INSTANTIATE_TEST_SUITE_P(
                 }
             },
             {
-                .dividend        = std::vector<digit_type>(999, DIGIT_TYPE_MAX),
-                .divisor         = std::vector<digit_type>(777, DIGIT_TYPE_MAX),
+                .dividend        = SmallVector<digit_type>(999, DIGIT_TYPE_MAX),
+                .divisor         = SmallVector<digit_type>(777, DIGIT_TYPE_MAX),
                 .expected_result =  {
                     .quotient  = digit_base_power(222),
-                    .remainder = std::vector<digit_type>(222, DIGIT_TYPE_MAX)
+                    .remainder = SmallVector<digit_type>(222, DIGIT_TYPE_MAX)
                 }
             },
             {
@@ -272,14 +295,14 @@ INSTANTIATE_TEST_SUITE_P(
                 }
             },
             {
-                .dividend        = std::vector<digit_type>(254, DIGIT_TYPE_MAX),
-                .divisor         = std::vector<digit_type>(62,  DIGIT_TYPE_MAX),
+                .dividend        = SmallVector<digit_type>(254, DIGIT_TYPE_MAX),
+                .divisor         = SmallVector<digit_type>(62,  DIGIT_TYPE_MAX),
                 .expected_result = {
                     .quotient  = digit_base_power(192)
                                + digit_base_power(130)
                                + digit_base_power( 68)
                                + digit_base_power(  6),
-                    .remainder = std::vector<digit_type>(6, DIGIT_TYPE_MAX)
+                    .remainder = SmallVector<digit_type>(6, DIGIT_TYPE_MAX)
                 }
             },
             {
@@ -297,10 +320,10 @@ INSTANTIATE_TEST_SUITE_P(
 
 TEST(DivideNormalized3n2nSplitTest, DividendHighEqualToDivisorHighTest)
 {
-    std::vector<digit_type> dividend = {
+    SmallVector<digit_type> dividend = {
         0, 0, DIGIT_TYPE_MAX
     };
-    std::vector<digit_type> divisor = {
+    SmallVector<digit_type> divisor = {
         DIGIT_TYPE_MAX, DIGIT_TYPE_MAX
     };
     DigitsDivisionResult expected_result = {
@@ -314,12 +337,12 @@ TEST(DivideNormalized3n2nSplitTest, DividendHighEqualToDivisorHighTest)
 
 TEST(DivideNormalized3n2nSplitTest, DividendHighGreaterThanDivisorHighTest)
 {
-    std::vector<digit_type> dividend = {
+    SmallVector<digit_type> dividend = {
         DIGIT_TYPE_MAX, DIGIT_TYPE_MAX,
         DIGIT_TYPE_MAX, DIGIT_TYPE_MAX,
         0,              (DIGIT_BASE / 2) + 1
     };
-    std::vector<digit_type> divisor = {
+    SmallVector<digit_type> divisor = {
         0, 0, 1, (DIGIT_BASE / 2) + 1
     };
     DigitsDivisionResult expected_result = {
@@ -334,10 +357,10 @@ TEST(DivideNormalized3n2nSplitTest, DividendHighGreaterThanDivisorHighTest)
 
 TEST(DivideNormalized3n2nSplitTest, EqualValue)
 {
-    std::vector<digit_type> dividend = {
+    SmallVector<digit_type> dividend = {
         0, 0, digit_type(1) << (DIGIT_TYPE_BITS - 1)
     };
-    std::vector<digit_type> divisor = dividend;
+    SmallVector<digit_type> divisor = dividend;
 
     DigitsDivisionResult expected_result = {
         .quotient = { 1 }, .remainder = { 0 }
@@ -350,10 +373,10 @@ TEST(DivideNormalized3n2nSplitTest, EqualValue)
 
 TEST(DivideNormalized3n2nSplitTest, UnevenSplits)
 {
-    std::vector<digit_type> dividend = {
+    SmallVector<digit_type> dividend = {
         0, 0, DIGIT_TYPE_MAX - 1, DIGIT_TYPE_MAX, DIGIT_TYPE_MAX
     };
-    std::vector<digit_type> divisor = {
+    SmallVector<digit_type> divisor = {
         0, DIGIT_TYPE_MAX, DIGIT_TYPE_MAX, DIGIT_TYPE_MAX
     };
 
@@ -369,10 +392,10 @@ TEST(DivideNormalized3n2nSplitTest, UnevenSplits)
 
 TEST(DivideNormalized2n1nSplitTest, FourDigitDiviend)
 {
-    std::vector<digit_type> dividend = {
+    SmallVector<digit_type> dividend = {
         0, 0, 0, 1
     };
-    std::vector<digit_type> divisor = {
+    SmallVector<digit_type> divisor = {
         0, digit_type(1) << (DIGIT_TYPE_BITS - 1)
     };
     DigitsDivisionResult expected_result = {
@@ -386,12 +409,12 @@ TEST(DivideNormalized2n1nSplitTest, FourDigitDiviend)
 
 TEST(DivideNormalized2n1nSplitTest, SixDigitDiviend)
 {
-    std::vector<digit_type> dividend = {
+    SmallVector<digit_type> dividend = {
         1, DIGIT_TYPE_MAX,
         2, DIGIT_TYPE_MAX,
         3, DIGIT_TYPE_MAX
     };
-    std::vector<digit_type> divisor = {
+    SmallVector<digit_type> divisor = {
         4, 0, DIGIT_TYPE_MAX
     };
     DigitsDivisionResult expected_result = {
@@ -406,10 +429,10 @@ TEST(DivideNormalized2n1nSplitTest, SixDigitDiviend)
 
 TEST(DivideNormalized2n1nSplitTest, EqualValue)
 {
-    std::vector<digit_type> dividend = {
+    SmallVector<digit_type> dividend = {
         0, 0, 0, digit_type(1) << (DIGIT_TYPE_BITS - 1)
     };
-    std::vector<digit_type> divisor = dividend;
+    SmallVector<digit_type> divisor = dividend;
 
     DigitsDivisionResult expected_result = {
         .quotient = { 1 }, .remainder = { 0 }
@@ -421,16 +444,161 @@ TEST(DivideNormalized2n1nSplitTest, EqualValue)
 }
 
 
+
+class NewtonDivideTest
+    : public ::testing::TestWithParam<
+      std::pair<SmallVector<digit_type>::size_type,
+                SmallVector<digit_type>::size_type>
+    >
+{}; // class NewtonDivideTest
+
+TEST_P(NewtonDivideTest, ConsistentWithDivideAndConquerDivide)
+{
+    auto [dividend_size, divisor_size] = GetParam();
+    auto dividend = make_arbitrary_digits(dividend_size, 0x9E3779B97F4A7C15);
+    auto divisor  = make_arbitrary_digits(divisor_size,  0x6A09E667F3BCC909);
+
+    auto expected_result = divide_and_conquer_divide(dividend, divisor);
+
+    expect_equal(expected_result, newton_divide(dividend, divisor));
+}
+
+TEST_P(NewtonDivideTest, MaximalDigitsDividedByMaximalDigits)
+{
+    auto [dividend_size, divisor_size] = GetParam();
+    SmallVector<digit_type> dividend(dividend_size, DIGIT_TYPE_MAX);
+    SmallVector<digit_type> divisor(divisor_size,   DIGIT_TYPE_MAX);
+
+    auto expected_result = divide_and_conquer_divide(dividend, divisor);
+
+    expect_equal(expected_result, newton_divide(dividend, divisor));
+}
+
+TEST_P(NewtonDivideTest, PowerOfDigitBaseDividedByPowerOfDigitBase)
+{
+    auto [dividend_size, divisor_size] = GetParam();
+    auto dividend = digit_base_power(dividend_size - 1) + std::uintmax_t(7);
+    auto divisor  = digit_base_power(divisor_size - 1);
+
+    DigitsDivisionResult expected_result = {
+        .quotient  = digit_base_power(dividend_size - divisor_size),
+        .remainder = { 7 }
+    };
+
+    expect_equal(expected_result, newton_divide(dividend, divisor));
+}
+
+TEST_P(NewtonDivideTest, RemainderAlgorithmsConsistentWithDivide)
+{
+    auto [dividend_size, divisor_size] = GetParam();
+    auto dividend = make_arbitrary_digits(dividend_size, 0x3C6EF372FE94F82B);
+    auto divisor  = make_arbitrary_digits(divisor_size,  0xA54FF53A5F1D36F1);
+
+    auto expected_remainder = divide(dividend, divisor).remainder;
+
+    EXPECT_EQ(expected_remainder, long_divide_remainder(dividend, divisor));
+    EXPECT_EQ(expected_remainder,
+              divide_and_conquer_divide_remainder(dividend, divisor));
+    EXPECT_EQ(expected_remainder, newton_divide_remainder(dividend, divisor));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    DigitsDivisionTest,
+    NewtonDivideTest,
+    ::testing::Values(
+        std::make_pair(2050, 2049),
+        std::make_pair(4098, 2049),
+        std::make_pair(9000, 2049),
+        std::make_pair(6001, 3001)
+    )
+);
+
+TEST(NewtonDivideThresholdTest, DivisorBeyondThresholdSatisfiesIdentity)
+{
+    // exceeds the untuned DIVIDE_AND_CONQUER_DIVIDE_THRESHOLD_DIVISOR_MAGNITUDE
+    auto dividend = make_arbitrary_digits(65600, 0x1F83D9ABFB41BD6B);
+    auto divisor  = make_arbitrary_digits(32800, 0x5BE0CD19137E2179);
+
+    auto result = newton_divide(dividend, divisor);
+
+    EXPECT_LT(result.remainder, divisor);
+    EXPECT_EQ(dividend, (result.quotient * divisor) + result.remainder);
+}
+
+TEST(SingleDigitDivisorTest, ConsistentWithLongDivide)
+{
+    for (auto divisor : { SmallVector<digit_type>{ 1 },
+                          SmallVector<digit_type>{ 10 },
+                          SmallVector<digit_type>{ DIGIT_TYPE_MAX },
+                          make_arbitrary_digits(1, 0xBB67AE8584CAA73B) }) {
+        for (std::size_t dividend_size : { 1, 2, 33, 2049 }) {
+            auto dividend = make_arbitrary_digits(dividend_size,
+                                                  0x510E527FADE682D1);
+
+            expect_equal(long_divide(dividend, divisor),
+                         divide(dividend, divisor));
+            EXPECT_EQ(long_divide_remainder(dividend, divisor),
+                      remainder(dividend, divisor));
+        }
+    }
+}
+
+class DigitsDivisorTest
+    : public ::testing::TestWithParam<SmallVector<digit_type>::size_type>
+{}; // class DigitsDivisorTest
+
+TEST_P(DigitsDivisorTest, ConsistentWithDivideForManyDividends)
+{
+    auto divisor_size = GetParam();
+    auto divisor = make_arbitrary_digits(divisor_size, 0x6A09E667F3BCC909);
+
+    DigitsDivisor digits_divisor(divisor);
+    EXPECT_EQ(divisor, digits_divisor.value());
+
+    for (auto dividend_size : { std::size_t(1),
+                                divisor_size,
+                                divisor_size + 1,
+                                (divisor_size * 3) + 5 }) {
+        auto dividend = make_arbitrary_digits(dividend_size,
+                                              0x9E3779B97F4A7C15);
+
+        auto expected_result = divide(dividend, divisor);
+
+        expect_equal(expected_result, digits_divisor.divide(dividend));
+        EXPECT_EQ(expected_result.remainder, digits_divisor.reduce(dividend));
+    }
+}
+
+TEST_P(DigitsDivisorTest, MaximalDigitsDividedByMaximalDigits)
+{
+    auto divisor_size = GetParam();
+    SmallVector<digit_type> dividend((divisor_size * 2) + 1, DIGIT_TYPE_MAX);
+    SmallVector<digit_type> divisor(divisor_size,            DIGIT_TYPE_MAX);
+
+    DigitsDivisor digits_divisor(divisor);
+
+    auto expected_result = divide(dividend, divisor);
+
+    expect_equal(expected_result, digits_divisor.divide(dividend));
+    EXPECT_EQ(expected_result.remainder, digits_divisor.reduce(dividend));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    DigitsDivisionTest,
+    DigitsDivisorTest,
+    ::testing::Values(1, 2, 33, 100, 2049)
+);
+
 class DigitsAndIntegralDivisionTest
     : public ::testing::TestWithParam<
-      std::tuple<std::vector<digit_type>, std::uintmax_t>
+      std::tuple<SmallVector<digit_type>, std::uintmax_t>
     >
 {}; // class DigitsAndIntegralDivisionTest
 
 TEST_P(DigitsAndIntegralDivisionTest,
        DigitsDividedByIntegralIsConsistentWithDigitsDividedByDigits)
 {
-    std::vector<digit_type> dividend = std::get<0>(GetParam());
+    SmallVector<digit_type> dividend = std::get<0>(GetParam());
     std::uintmax_t divisor           = std::get<1>(GetParam());
     auto expected_result             = divide(dividend,
                                               digits_from_integral(divisor));
@@ -452,14 +620,14 @@ INSTANTIATE_TEST_SUITE_P(
 
 class DigitsAndFloatingPointDivisionTest
     : public ::testing::TestWithParam<
-      std::tuple<std::vector<digit_type>, long double>
+      std::tuple<SmallVector<digit_type>, long double>
     >
 {}; // class DigitsAndFloatingPointDivisionTest
 
 TEST_P(DigitsAndFloatingPointDivisionTest,
        DigitsDividedByFloatingPointIsConsistentWithDigitsDividedByDigits)
 {
-    std::vector<digit_type> dividend = std::get<0>(GetParam());
+    SmallVector<digit_type> dividend = std::get<0>(GetParam());
     long double divisor              = std::get<1>(GetParam());
     auto expected_result             = divide(dividend,
                                               digits_from_floating_point(divisor));
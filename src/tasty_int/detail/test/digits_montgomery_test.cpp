@@ -0,0 +1,142 @@
+#include "tasty_int/detail/digits_montgomery.hpp"
+
+#include <cstdint>
+
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "tasty_int/detail/digits_comparison.hpp"
+#include "tasty_int/detail/digits_division.hpp"
+#include "tasty_int/detail/digits_multiplication.hpp"
+#include "tasty_int/detail/conversions/digits_from_integral.hpp"
+#include "tasty_int/detail/test/integer_test_common.hpp"
+
+
+namespace {
+
+using tasty_int::detail::DigitsMontgomeryContext;
+using tasty_int::detail::SmallVector;
+using tasty_int::detail::digit_type;
+using tasty_int::detail::DIGIT_TYPE_MAX;
+using tasty_int::detail::divide;
+using tasty_int::detail::operator*;
+using tasty_int::detail::operator>;
+using tasty_int::detail::make_arbitrary_digits;
+using tasty_int::detail::conversions::digits_from_integral;
+
+
+SmallVector<digit_type>
+make_arbitrary_modulus(SmallVector<digit_type>::size_type size,
+                       std::uint64_t                      seed)
+{
+    auto digits = make_arbitrary_digits(size, seed);
+    digits.front() |= 1;
+
+    return digits;
+}
+
+SmallVector<digit_type>
+reduce(const SmallVector<digit_type> &digits,
+       const SmallVector<digit_type> &modulus)
+{
+    return divide(digits, modulus).remainder;
+}
+
+
+class DigitsMontgomeryContextTest
+    : public ::testing::TestWithParam<SmallVector<digit_type>>
+{}; // class DigitsMontgomeryContextTest
+
+TEST_P(DigitsMontgomeryContextTest, MontgomeryFormRoundTrips)
+{
+    const auto &modulus = GetParam();
+    DigitsMontgomeryContext context(modulus);
+
+    EXPECT_EQ(modulus, context.value());
+
+    for (const auto &digits : { SmallVector<digit_type>{ 0 },
+                                SmallVector<digit_type>{ 1 },
+                                modulus,
+                                modulus * modulus,
+                                make_arbitrary_digits(modulus.size() * 3,
+                                                      0x9E3779B97F4A7C15) }) {
+        auto montgomery_form = context.to_montgomery(digits);
+
+        EXPECT_GT(modulus, montgomery_form);
+        EXPECT_EQ(reduce(digits, modulus),
+                  context.from_montgomery(montgomery_form));
+    }
+}
+
+TEST_P(DigitsMontgomeryContextTest, MultiplyAndSquareConsistentWithDivide)
+{
+    const auto &modulus = GetParam();
+    DigitsMontgomeryContext context(modulus);
+
+    auto lhs = reduce(make_arbitrary_digits(modulus.size(),
+                                            0x9E3779B97F4A7C15), modulus);
+    auto rhs = reduce(make_arbitrary_digits(modulus.size(),
+                                            0x6A09E667F3BCC909), modulus);
+    auto max = reduce(SmallVector<digit_type>(modulus.size(), DIGIT_TYPE_MAX),
+                      modulus);
+
+    for (const auto &[multiplicand, multiplier] :
+         { std::make_pair(lhs, rhs), std::make_pair(max, max) }) {
+        auto product = context.multiply(context.to_montgomery(multiplicand),
+                                        context.to_montgomery(multiplier));
+
+        EXPECT_EQ(reduce(multiplicand * multiplier, modulus),
+                  context.from_montgomery(product));
+    }
+
+    auto square = context.square(context.to_montgomery(lhs));
+
+    EXPECT_EQ(reduce(lhs * lhs, modulus), context.from_montgomery(square));
+}
+
+TEST_P(DigitsMontgomeryContextTest, PowModConsistentWithRepeatedMultiply)
+{
+    const auto &modulus = GetParam();
+    DigitsMontgomeryContext context(modulus);
+
+    auto base = make_arbitrary_digits(modulus.size() + 1, 0x510E527FADE682D1);
+
+    SmallVector<digit_type> expected_result = reduce({ 1 }, modulus);
+    for (std::uintmax_t exponent = 0; exponent < 40; ++exponent) {
+        EXPECT_EQ(expected_result,
+                  context.pow_mod(base, digits_from_integral(exponent)));
+
+        expected_result = reduce(expected_result * base, modulus);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    DigitsMontgomeryTest,
+    DigitsMontgomeryContextTest,
+    ::testing::Values(
+        SmallVector<digit_type>{ 1 },
+        SmallVector<digit_type>{ 3 },
+        SmallVector<digit_type>{ DIGIT_TYPE_MAX },
+        SmallVector<digit_type>{ 1, 1 },
+        SmallVector<digit_type>(5, DIGIT_TYPE_MAX),
+        make_arbitrary_modulus(2,  0xBB67AE8584CAA73B),
+        make_arbitrary_modulus(40, 0x3C6EF372FE94F82B)
+    )
+);
+
+TEST(DigitsMontgomeryTest, PowModSatisfiesFermatsLittleTheorem)
+{
+    // 2^61 - 1 is prime
+    auto prime = digits_from_integral((std::uintmax_t(1) << 61) - 1);
+    DigitsMontgomeryContext context(prime);
+
+    auto prime_less_one = digits_from_integral((std::uintmax_t(1) << 61) - 2);
+
+    for (std::uintmax_t base : { 2, 3, 1234567890 })
+        EXPECT_EQ(SmallVector<digit_type>{ 1 },
+                  context.pow_mod(digits_from_integral(base),
+                                  prime_less_one));
+}
+
+} // namespace
@@ -1,40 +1,58 @@
 #include "tasty_int/detail/digits_multiplication.hpp"
 
 #include <cmath>
+#include <cstdint>
 
+#include <algorithm>
 #include <limits>
+#include <utility>
 
 #include "gtest/gtest.h"
 
-#include "tasty_int/detail/integral_digits_view.hpp"
+#include "tasty_int/detail/digit_from_nonnegative_value.hpp"
 #include "tasty_int/detail/conversions/digits_from_string.hpp"
+#include "tasty_int/detail/test/integer_test_common.hpp"
 
 
 namespace {
 
 using tasty_int::detail::operator*=;
 using tasty_int::detail::operator*;
+using tasty_int::detail::long_multiply;
+using tasty_int::detail::karatsuba_multiply;
+using tasty_int::detail::toom_3_multiply;
+using tasty_int::detail::number_theoretic_transform_multiply;
+using tasty_int::detail::unbalanced_multiply;
+using tasty_int::detail::multiply_digits;
+using tasty_int::detail::long_square;
+using tasty_int::detail::karatsuba_square;
+using tasty_int::detail::toom_3_square;
+using tasty_int::detail::number_theoretic_transform_square;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
+using tasty_int::detail::digit_accumulator_type;
 using tasty_int::detail::DIGIT_TYPE_MAX;
 using tasty_int::detail::DIGIT_BASE;
-using tasty_int::detail::IntegralDigitsView;
+using tasty_int::detail::DIGIT_TYPE_BITS;
+using tasty_int::detail::digit_from_nonnegative_value;
+using tasty_int::detail::make_arbitrary_digits;
 using tasty_int::detail::conversions::digits_from_string;
 
 
 TEST(DigitsAndDigitsMultiplicationTest,
      DigitsTimesEqualsDigitsRegerenceReferenceToLhs)
 {
-    std::vector<digit_type> lhs = { 1, 2, 3 };
-    std::vector<digit_type> rhs = { 4, 5, 6 };
+    SmallVector<digit_type> lhs = { 1, 2, 3 };
+    SmallVector<digit_type> rhs = { 4, 5, 6 };
 
     EXPECT_EQ(&lhs, &(lhs *= rhs));
 }
 
 template<typename RhsType>
 void
-test_multiply_in_place(const std::vector<digit_type> &lhs,
+test_multiply_in_place(const SmallVector<digit_type> &lhs,
                        const RhsType                 &rhs,
-                       const std::vector<digit_type> &expected_result)
+                       const SmallVector<digit_type> &expected_result)
 {
     auto multiplicand = lhs;
 
@@ -48,7 +66,7 @@ template<typename LhsType,
 void
 test_multiply(const LhsType                 &lhs,
               const RhsType                 &rhs,
-              const std::vector<digit_type> &expected_result)
+              const SmallVector<digit_type> &expected_result)
 {
     auto result = lhs * rhs;
 
@@ -57,13 +75,13 @@ test_multiply(const LhsType                 &lhs,
 
 template<typename MultiplierType>
 void
-test_multiplication(const std::vector<digit_type> &digits,
+test_multiplication(const SmallVector<digit_type> &digits,
                     const MultiplierType          &multiplier,
-                    const std::vector<digit_type> &expected_result)
+                    const SmallVector<digit_type> &expected_result)
 {
     test_multiply_in_place(digits, multiplier, expected_result);
 
-    if constexpr (std::is_same_v<MultiplierType, std::vector<digit_type>>)
+    if constexpr (std::is_same_v<MultiplierType, SmallVector<digit_type>>)
         test_multiply_in_place(multiplier, digits, expected_result);
 
     test_multiply(digits, multiplier, expected_result);
@@ -72,58 +90,71 @@ test_multiplication(const std::vector<digit_type> &digits,
 }
 
 
+TEST(DigitsAndDigitsMultiplicationTest, MultiplyDigitsBorrowedOperands)
+{
+    const digit_type lhs[] = { DIGIT_TYPE_MAX, 3 };
+    const digit_type rhs[] = { 2 };
+
+    EXPECT_EQ((SmallVector<digit_type>{ DIGIT_TYPE_MAX - 1, 7 }),
+              multiply_digits(lhs, rhs));
+    EXPECT_EQ((SmallVector<digit_type>{ DIGIT_TYPE_MAX, 3 }
+             * SmallVector<digit_type>{ DIGIT_TYPE_MAX, 3 }),
+              multiply_digits(lhs, lhs));
+}
+
 TEST(DigitsAndDigitsMultiplicationTest, DigitsTimesOneEqualsOriginalValue)
 {
-    std::vector<digit_type> digits          = { 1, 2, 3 };
-    std::vector<digit_type> ONE             = { 1 };
-    std::vector<digit_type> expected_result = digits;
+    SmallVector<digit_type> digits          = { 1, 2, 3 };
+    SmallVector<digit_type> ONE             = { 1 };
+    SmallVector<digit_type> expected_result = digits;
 
     test_multiplication(digits, ONE, expected_result);
 }
 
 TEST(DigitsAndDigitsMultiplicationTest, ZeroTimesZeroEqualsZero)
 {
-    std::vector<digit_type> ZERO = { 0 };
+    SmallVector<digit_type> ZERO = { 0 };
 
     test_multiplication(ZERO, ZERO, ZERO);
 }
 
 TEST(DigitsAndDigitsMultiplicationTest, OneTimesZeroEqualsZero)
 {
-    std::vector<digit_type> ONE  = { 1 };
-    std::vector<digit_type> ZERO = { 0 };
+    SmallVector<digit_type> ONE  = { 1 };
+    SmallVector<digit_type> ZERO = { 0 };
 
     test_multiplication(ONE, ZERO, ZERO);
 }
 
 TEST(DigitsAndDigitsMultiplicationTest, DigitsTimesZeroEqualsZero)
 {
-    std::vector<digit_type> digits = { 1, 2, 3 };
-    std::vector<digit_type> ZERO   = { 0 };
+    SmallVector<digit_type> digits = { 1, 2, 3 };
+    SmallVector<digit_type> ZERO   = { 0 };
 
     test_multiplication(digits, ZERO, ZERO);
 }
 
 TEST(DigitsAndDigitsMultiplicationTest, DigitsTimesSingleDigitNoCarry)
 {
-    std::vector<digit_type> digits          = { 1, 2, 3 };
-    std::vector<digit_type> single_digit    = { 2 };
-    std::vector<digit_type> expected_result = { 2, 4, 6 };
+    SmallVector<digit_type> digits          = { 1, 2, 3 };
+    SmallVector<digit_type> single_digit    = { 2 };
+    SmallVector<digit_type> expected_result = { 2, 4, 6 };
 
     test_multiplication(digits, single_digit, expected_result);
 }
 
 TEST(DigitsAndDigitsMultiplicationTest, DigitsTimesSingleDigitCarry)
 {
-    std::vector<digit_type> digits = { 1, 2, 1 };
-    std::vector<digit_type> single_digit = { DIGIT_TYPE_MAX };
-    IntegralDigitsView carry1(DIGIT_TYPE_MAX * 2);
-    IntegralDigitsView carry2(carry1.high_digit() + DIGIT_TYPE_MAX);
-    std::vector<digit_type> expected_result = {
+    SmallVector<digit_type> digits = { 1, 2, 1 };
+    SmallVector<digit_type> single_digit = { DIGIT_TYPE_MAX };
+    digit_accumulator_type carry1 = DIGIT_TYPE_MAX * 2;
+    digit_accumulator_type carry2 = (carry1 >> DIGIT_TYPE_BITS)
+                                  + DIGIT_TYPE_MAX;
+    SmallVector<digit_type> expected_result = {
         DIGIT_TYPE_MAX,
-        carry1.low_digit(),
-        carry2.low_digit(),
-        carry2.high_digit()
+        digit_from_nonnegative_value(carry1),
+        digit_from_nonnegative_value(carry2),
+        digit_from_nonnegative_value(carry2 >> DIGIT_TYPE_BITS)
     };
 
     test_multiplication(digits, single_digit, expected_result);
@@ -143,7 +174,7 @@ TEST(DigitsAndDigitsMultiplicationTest, MultipleDigitsTimesMultipleDigits)
 
 TEST(DigitsAndDigitsMultiplicationTest, ZeroDigitsTimesManyDigits)
 {
-    std::vector<digit_type> ZERO = { 0 };
+    SmallVector<digit_type> ZERO = { 0 };
 
     auto many_digits = digits_from_string(
         "777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777777",
@@ -190,11 +221,11 @@ TEST(DigitsAndDigitsMultiplicationTest, ManyDigitsTimesManyDigits)
 
 TEST(DigitsAndDigitsMultiplicationTest, SparseManyDigitsTimeManyDigits)
 {
-    std::vector<digit_type> digits1(500);
+    SmallVector<digit_type> digits1(500);
     digits1.back() = 1;
-    std::vector<digit_type> digits2(1000);
+    SmallVector<digit_type> digits2(1000);
     digits2.back() = 1;
-    std::vector<digit_type> expected_result(digits1.size() + digits2.size() - 1);
+    SmallVector<digit_type> expected_result(digits1.size() + digits2.size() - 1);
     expected_result.back() = 1;
 
     test_multiplication(digits1, digits2, expected_result);
@@ -202,10 +233,10 @@ TEST(DigitsAndDigitsMultiplicationTest, SparseManyDigitsTimeManyDigits)
 
 TEST(DigitsAndDigitsMultiplicationTest, FewDigitsTimesSelfInPlace)
 {
-    std::vector<digit_type> digits = {
+    SmallVector<digit_type> digits = {
         4, 3, 2, 1
     };
-    std::vector<digit_type> expected_result = {
+    SmallVector<digit_type> expected_result = {
         16, 24, 25, 20, 10, 4, 1
     };
 
@@ -216,9 +247,9 @@ TEST(DigitsAndDigitsMultiplicationTest, FewDigitsTimesSelfInPlace)
 
 TEST(DigitsAndDigitsMultiplicationTest, ManyDigitsTimesSelfInPlace)
 {
-    std::vector<digit_type> digits(500);
+    SmallVector<digit_type> digits(500);
     digits.back() = 1;
-    std::vector<digit_type> expected_result((digits.size() * 2) - 1);
+    SmallVector<digit_type> expected_result((digits.size() * 2) - 1);
     expected_result.back() = 1;
 
     digits *= digits;
@@ -229,16 +260,16 @@ TEST(DigitsAndDigitsMultiplicationTest, ManyDigitsTimesSelfInPlace)
 
 TEST(DigitsAndIntegralMultiplicationTest, DigitsTimesOneEqualsOriginalValue)
 {
-    std::vector<digit_type> digits          = { 1, 2, 3 };
+    SmallVector<digit_type> digits          = { 1, 2, 3 };
     std::uintmax_t          ONE             = 1;
-    std::vector<digit_type> expected_result = digits;
+    SmallVector<digit_type> expected_result = digits;
 
     test_multiplication(digits, ONE, expected_result);
 }
 
 TEST(DigitsAndIntegralMultiplicationTest, ZeroTimesZeroEqualsZero)
 {
-    std::vector<digit_type> ZERO_DIGITS   = { 0 };
+    SmallVector<digit_type> ZERO_DIGITS   = { 0 };
     std::uintmax_t          ZERO_INTEGRAL = 0;
 
     test_multiplication(ZERO_DIGITS, ZERO_INTEGRAL, ZERO_DIGITS);
@@ -246,7 +277,7 @@ TEST(DigitsAndIntegralMultiplicationTest, ZeroTimesZeroEqualsZero)
 
 TEST(DigitsAndIntegralMultiplicationTest, ZeroTimesOneEqualsZero)
 {
-    std::vector<digit_type> ZERO_DIGITS  = { 0 };
+    SmallVector<digit_type> ZERO_DIGITS  = { 0 };
     std::uintmax_t          ONE_INTEGRAL = 1;
 
     test_multiplication(ZERO_DIGITS, ONE_INTEGRAL, ZERO_DIGITS);
@@ -254,7 +285,7 @@ TEST(DigitsAndIntegralMultiplicationTest, ZeroTimesOneEqualsZero)
 
 TEST(DigitsAndIntegralMultiplicationTest, ZeroTimesMaxIntegralEqualsZero)
 {
-    std::vector<digit_type> ZERO_DIGITS  = { 0 };
+    SmallVector<digit_type> ZERO_DIGITS  = { 0 };
     std::uintmax_t          MAX_INTEGRAL =
         std::numeric_limits<std::uintmax_t>::max();
 
@@ -263,42 +294,43 @@ TEST(DigitsAndIntegralMultiplicationTest, ZeroTimesMaxIntegralEqualsZero)
 
 TEST(DigitsAndIntegralMultiplicationTest, OneTimesZeroEqualsZero)
 {
-    std::vector<digit_type> ONE           = { 1 };
+    SmallVector<digit_type> ONE           = { 1 };
     std::uintmax_t          ZERO_INTEGRAL = 0;
-    std::vector<digit_type> ZERO_DIGITS   = { 0 };
+    SmallVector<digit_type> ZERO_DIGITS   = { 0 };
 
     test_multiplication(ONE, ZERO_INTEGRAL, ZERO_DIGITS);
 }
 
 TEST(DigitsAndIntegralMultiplicationTest, DigitsTimesZeroEqualsZero)
 {
-    std::vector<digit_type> digits = { 1, 2, 3 };
+    SmallVector<digit_type> digits = { 1, 2, 3 };
     std::uintmax_t          ZERO_INTEGRAL = 0;
-    std::vector<digit_type> ZERO_DIGITS   = { 0 };
+    SmallVector<digit_type> ZERO_DIGITS   = { 0 };
 
     test_multiplication(digits, ZERO_INTEGRAL, ZERO_DIGITS);
 }
 
 TEST(DigitsAndIntegralMultiplicationTest, DigitsTimesSingleDigitNoCarry)
 {
-    std::vector<digit_type> digits          = { 1, 2, 3 };
+    SmallVector<digit_type> digits          = { 1, 2, 3 };
     std::uintmax_t          single_digit    = 2;
-    std::vector<digit_type> expected_result = { 2, 4, 6 };
+    SmallVector<digit_type> expected_result = { 2, 4, 6 };
 
     test_multiplication(digits, single_digit, expected_result);
 }
 
 TEST(DigitsAndIntegralMultiplicationTest, DigitsTimesSingleDigitCarry)
 {
-    std::vector<digit_type> digits = { 1, 2, 1 };
+    SmallVector<digit_type> digits = { 1, 2, 1 };
     std::uintmax_t single_digit = DIGIT_TYPE_MAX;
-    IntegralDigitsView carry1(DIGIT_TYPE_MAX * 2);
-    IntegralDigitsView carry2(carry1.high_digit() + DIGIT_TYPE_MAX);
-    std::vector<digit_type> expected_result = {
+    digit_accumulator_type carry1 = DIGIT_TYPE_MAX * 2;
+    digit_accumulator_type carry2 = (carry1 >> DIGIT_TYPE_BITS)
+                                  + DIGIT_TYPE_MAX;
+    SmallVector<digit_type> expected_result = {
         DIGIT_TYPE_MAX,
-        carry1.low_digit(),
-        carry2.low_digit(),
-        carry2.high_digit()
+        digit_from_nonnegative_value(carry1),
+        digit_from_nonnegative_value(carry2),
+        digit_from_nonnegative_value(carry2 >> DIGIT_TYPE_BITS)
     };
 
     test_multiplication(digits, single_digit, expected_result);
@@ -306,12 +338,16 @@ TEST(DigitsAndIntegralMultiplicationTest, DigitsTimesSingleDigitCarry)
 
 TEST(DigitsAndIntegralMultiplicationTest, MultipleDigitsTimesMultipleDigits)
 {
-    std::vector<digit_type> digits = {
+    SmallVector<digit_type> digits = {
         DIGIT_TYPE_MAX, DIGIT_TYPE_MAX, DIGIT_TYPE_MAX
     };
     auto integral = std::numeric_limits<std::uintmax_t>::max();
-    std::vector<digit_type> expected_result = {
+    SmallVector<digit_type> expected_result = {
+#if TASTY_INT_HAVE_INT128_ACCUMULATOR
+        1, DIGIT_TYPE_MAX, DIGIT_TYPE_MAX, DIGIT_TYPE_MAX - 1
+#else
         1, 0, DIGIT_TYPE_MAX, DIGIT_TYPE_MAX - 1, DIGIT_TYPE_MAX
+#endif // if TASTY_INT_HAVE_INT128_ACCUMULATOR
     };
 
     test_multiplication(digits, integral, expected_result);
@@ -320,16 +356,16 @@ TEST(DigitsAndIntegralMultiplicationTest, MultipleDigitsTimesMultipleDigits)
 
 TEST(DigitsAndFloatingPointMultiplicationTest, DigitsTimesOneEqualsOriginalValue)
 {
-    std::vector<digit_type> digits = { 1, 2, 3 };
+    SmallVector<digit_type> digits = { 1, 2, 3 };
     long double             ONE    = 1.0;
-    std::vector<digit_type> expected_result = digits;
+    SmallVector<digit_type> expected_result = digits;
 
     test_multiplication(digits, ONE, expected_result);
 }
 
 TEST(DigitsAndFloatingPointMultiplicationTest, ZeroTimesZeroEqualsZero)
 {
-    std::vector<digit_type> ZERO_DIGITS = { 0 };
+    SmallVector<digit_type> ZERO_DIGITS = { 0 };
     long double ZERO_FLOATING_POINT     = 0.0;
 
     test_multiplication(ZERO_DIGITS, ZERO_FLOATING_POINT, ZERO_DIGITS);
@@ -337,42 +373,43 @@ TEST(DigitsAndFloatingPointMultiplicationTest, ZeroTimesZeroEqualsZero)
 
 TEST(DigitsAndFloatingPointMultiplicationTest, OneTimesZeroEqualsZero)
 {
-    std::vector<digit_type> ONE         = { 1 };
+    SmallVector<digit_type> ONE         = { 1 };
     long double ZERO_FLOATING_POINT     = 0.0;
-    std::vector<digit_type> ZERO_DIGITS = { 0 };
+    SmallVector<digit_type> ZERO_DIGITS = { 0 };
 
     test_multiplication(ONE, ZERO_FLOATING_POINT, ZERO_DIGITS);
 }
 
 TEST(DigitsAndFloatingPointMultiplicationTest, DigitsTimesZeroEqualsZero)
 {
-    std::vector<digit_type> digits      = { 1, 2, 3 };
+    SmallVector<digit_type> digits      = { 1, 2, 3 };
     long double ZERO_FLOATING_POINT     = 0.0;
-    std::vector<digit_type> ZERO_DIGITS = { 0 };
+    SmallVector<digit_type> ZERO_DIGITS = { 0 };
 
     test_multiplication(digits, ZERO_FLOATING_POINT, ZERO_DIGITS);
 }
 
 TEST(DigitsAndFloatingPointMultiplicationTest, DigitsTimesSingleDigitNoCarry)
 {
-    std::vector<digit_type> digits          = { 1, 2, 3 };
+    SmallVector<digit_type> digits          = { 1, 2, 3 };
     long double single_digit                = 2.0;
-    std::vector<digit_type> expected_result = { 2, 4, 6 };
+    SmallVector<digit_type> expected_result = { 2, 4, 6 };
 
     test_multiplication(digits, single_digit, expected_result);
 }
 
 TEST(DigitsAndFloatingPointMultiplicationTest, DigitsTimesSingleDigitCarry)
 {
-    std::vector<digit_type> digits = { 1, 2, 1 };
+    SmallVector<digit_type> digits = { 1, 2, 1 };
     long double single_digit = DIGIT_TYPE_MAX;
-    IntegralDigitsView carry1(DIGIT_TYPE_MAX * 2);
-    IntegralDigitsView carry2(carry1.high_digit() + DIGIT_TYPE_MAX);
-    std::vector<digit_type> expected_result = {
+    digit_accumulator_type carry1 = DIGIT_TYPE_MAX * 2;
+    digit_accumulator_type carry2 = (carry1 >> DIGIT_TYPE_BITS)
+                                  + DIGIT_TYPE_MAX;
+    SmallVector<digit_type> expected_result = {
         DIGIT_TYPE_MAX,
-        carry1.low_digit(),
-        carry2.low_digit(),
-        carry2.high_digit()
+        digit_from_nonnegative_value(carry1),
+        digit_from_nonnegative_value(carry2),
+        digit_from_nonnegative_value(carry2 >> DIGIT_TYPE_BITS)
     };
 
     test_multiplication(digits, single_digit, expected_result);
@@ -380,15 +417,227 @@ TEST(DigitsAndFloatingPointMultiplicationTest, DigitsTimesSingleDigitCarry)
 
 TEST(DigitsAndFloatingPointMultiplicationTest, MultipleDigitsTimesMultipleDigits)
 {
-    std::vector<digit_type> digits = {
+    SmallVector<digit_type> digits = {
         DIGIT_TYPE_MAX, DIGIT_TYPE_MAX
     };
     auto floating_point = std::pow(DIGIT_BASE, 10.0L);
-    std::vector<digit_type> expected_result(12);
+    SmallVector<digit_type> expected_result(12);
     expected_result[expected_result.size() - 2] = DIGIT_TYPE_MAX;
     expected_result.back()                      = DIGIT_TYPE_MAX;
 
     test_multiplication(digits, floating_point, expected_result);
 }
 
+
+SmallVector<digit_type>
+make_arbitrary_digits_with_zeros(SmallVector<digit_type>::size_type size,
+                                 std::uint64_t                      seed,
+                                 SmallVector<digit_type>::size_type zeros_begin,
+                                 SmallVector<digit_type>::size_type zeros_end)
+{
+    auto digits = make_arbitrary_digits(size, seed);
+
+    std::fill(digits.begin() + zeros_begin, digits.begin() + zeros_end, 0);
+
+    return digits;
+}
+
+struct DigitsMultiplicationAlgorithmTestParam
+{
+    SmallVector<digit_type> lhs;
+    SmallVector<digit_type> rhs;
+    SmallVector<digit_type> expected_result;
+    SmallVector<digit_type> expected_lhs_squared;
+}; // struct DigitsMultiplicationAlgorithmTestParam
+
+DigitsMultiplicationAlgorithmTestParam
+make_algorithm_test_param(SmallVector<digit_type> &&lhs,
+                          SmallVector<digit_type> &&rhs)
+{
+    auto expected_result      = long_multiply(lhs, rhs);
+    auto expected_lhs_squared = long_multiply(lhs, lhs);
+
+    return {
+        .lhs                  = std::move(lhs),
+        .rhs                  = std::move(rhs),
+        .expected_result      = std::move(expected_result),
+        .expected_lhs_squared = std::move(expected_lhs_squared)
+    };
+}
+
+class DigitsMultiplicationAlgorithmTest
+    : public ::testing::TestWithParam<DigitsMultiplicationAlgorithmTestParam>
+{}; // class DigitsMultiplicationAlgorithmTest
+
+TEST_P(DigitsMultiplicationAlgorithmTest, KaratsubaMultiplyEqualsLongMultiply)
+{
+    const auto &lhs             = GetParam().lhs;
+    const auto &rhs             = GetParam().rhs;
+    const auto &expected_result = GetParam().expected_result;
+
+    EXPECT_EQ(expected_result, karatsuba_multiply(lhs, rhs));
+    EXPECT_EQ(expected_result, karatsuba_multiply(rhs, lhs));
+}
+
+TEST_P(DigitsMultiplicationAlgorithmTest, Toom3MultiplyEqualsLongMultiply)
+{
+    const auto &lhs             = GetParam().lhs;
+    const auto &rhs             = GetParam().rhs;
+    const auto &expected_result = GetParam().expected_result;
+
+    EXPECT_EQ(expected_result, toom_3_multiply(lhs, rhs));
+    EXPECT_EQ(expected_result, toom_3_multiply(rhs, lhs));
+}
+
+TEST_P(DigitsMultiplicationAlgorithmTest,
+       NumberTheoreticTransformMultiplyEqualsLongMultiply)
+{
+    const auto &lhs             = GetParam().lhs;
+    const auto &rhs             = GetParam().rhs;
+    const auto &expected_result = GetParam().expected_result;
+
+    EXPECT_EQ(expected_result, number_theoretic_transform_multiply(lhs, rhs));
+    EXPECT_EQ(expected_result, number_theoretic_transform_multiply(rhs, lhs));
+}
+
+TEST_P(DigitsMultiplicationAlgorithmTest, UnbalancedMultiplyEqualsLongMultiply)
+{
+    const auto &lhs             = GetParam().lhs;
+    const auto &rhs             = GetParam().rhs;
+    const auto &expected_result = GetParam().expected_result;
+
+    EXPECT_EQ(expected_result, unbalanced_multiply(lhs, rhs));
+    EXPECT_EQ(expected_result, unbalanced_multiply(rhs, lhs));
+}
+
+TEST_P(DigitsMultiplicationAlgorithmTest, LongSquareEqualsLongMultiply)
+{
+    const auto &lhs                  = GetParam().lhs;
+    const auto &expected_lhs_squared = GetParam().expected_lhs_squared;
+
+    EXPECT_EQ(expected_lhs_squared, long_square(lhs));
+}
+
+TEST_P(DigitsMultiplicationAlgorithmTest, KaratsubaSquareEqualsLongMultiply)
+{
+    const auto &lhs                  = GetParam().lhs;
+    const auto &expected_lhs_squared = GetParam().expected_lhs_squared;
+
+    EXPECT_EQ(expected_lhs_squared, karatsuba_square(lhs));
+}
+
+TEST_P(DigitsMultiplicationAlgorithmTest, Toom3SquareEqualsLongMultiply)
+{
+    const auto &lhs                  = GetParam().lhs;
+    const auto &expected_lhs_squared = GetParam().expected_lhs_squared;
+
+    EXPECT_EQ(expected_lhs_squared, toom_3_square(lhs));
+}
+
+TEST_P(DigitsMultiplicationAlgorithmTest,
+       NumberTheoreticTransformSquareEqualsLongMultiply)
+{
+    const auto &lhs                  = GetParam().lhs;
+    const auto &expected_lhs_squared = GetParam().expected_lhs_squared;
+
+    EXPECT_EQ(expected_lhs_squared, number_theoretic_transform_square(lhs));
+}
+
+TEST_P(DigitsMultiplicationAlgorithmTest, EqualOperandsProductEqualsSquare)
+{
+    const auto &lhs                  = GetParam().lhs;
+    const auto &expected_lhs_squared = GetParam().expected_lhs_squared;
+
+    auto lhs_copy = lhs;
+
+    EXPECT_EQ(expected_lhs_squared, lhs * lhs);
+    EXPECT_EQ(expected_lhs_squared, lhs * lhs_copy);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    DigitsMultiplicationTest,
+    DigitsMultiplicationAlgorithmTest,
+    ::testing::ValuesIn(
+        std::vector<DigitsMultiplicationAlgorithmTestParam> {
+            make_algorithm_test_param(
+                SmallVector<digit_type>{ 0 },
+                make_arbitrary_digits(3, 0)
+            ),
+            make_algorithm_test_param(
+                SmallVector<digit_type>{ DIGIT_TYPE_MAX },
+                SmallVector<digit_type>{ DIGIT_TYPE_MAX, DIGIT_TYPE_MAX }
+            ),
+            make_algorithm_test_param(
+                make_arbitrary_digits(101, 12),
+                make_arbitrary_digits(57,  13)
+            ),
+            make_algorithm_test_param(
+                make_arbitrary_digits(301, 1),
+                make_arbitrary_digits(301, 2)
+            ),
+            make_algorithm_test_param(
+                make_arbitrary_digits(500, 3),
+                make_arbitrary_digits(401, 4)
+            ),
+            make_algorithm_test_param(
+                make_arbitrary_digits(1500, 10),
+                make_arbitrary_digits(1500, 11)
+            ),
+            make_algorithm_test_param(
+                make_arbitrary_digits(1000, 5),
+                make_arbitrary_digits(100,  6)
+            ),
+            make_algorithm_test_param(
+                make_arbitrary_digits(5000, 14),
+                make_arbitrary_digits(7,    15)
+            ),
+            make_algorithm_test_param(
+                make_arbitrary_digits(7,    15),
+                make_arbitrary_digits(5000, 14)
+            ),
+            make_algorithm_test_param(
+                make_arbitrary_digits(401,  17),
+                make_arbitrary_digits(3000, 16)
+            ),
+            make_algorithm_test_param(
+                make_arbitrary_digits(301, 19),
+                make_arbitrary_digits_with_zeros(1700, 18, 300, 1300)
+            ),
+            make_algorithm_test_param(
+                make_arbitrary_digits(2222, 7),
+                make_arbitrary_digits(1999, 8)
+            ),
+            make_algorithm_test_param(
+                SmallVector<digit_type>(1500, DIGIT_TYPE_MAX),
+                SmallVector<digit_type>(1500, DIGIT_TYPE_MAX)
+            ),
+            make_algorithm_test_param(
+                SmallVector<digit_type>(1200, DIGIT_TYPE_MAX),
+                make_arbitrary_digits(1000, 9)
+            ),
+        }
+    )
+);
+
+TEST(NumberTheoreticTransformMultiplyTest, LargeOperandsEqualToom3Multiply)
+{
+    // operands exceed the transform threshold; toom_3_multiply() is checked
+    // against long_multiply() above at sizes that are practical to test
+    auto lhs = make_arbitrary_digits(8193, 10);
+    auto rhs = make_arbitrary_digits(8200, 11);
+
+    EXPECT_EQ(toom_3_multiply(lhs, rhs),
+              number_theoretic_transform_multiply(lhs, rhs));
+}
+
+TEST(NumberTheoreticTransformMultiplyTest, LargeOperandSquaredEqualsToom3Square)
+{
+    SmallVector<digit_type> digits(8193, DIGIT_TYPE_MAX);
+
+    auto expected_result = toom_3_square(digits);
+
+    EXPECT_EQ(expected_result, number_theoretic_transform_square(digits));
+    EXPECT_EQ(expected_result, digits * digits);
+}
+
 } // namespace
@@ -16,6 +16,7 @@ namespace {
 
 using tasty_int::detail::subtract;
 using tasty_int::detail::subtract_in_place;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 using tasty_int::detail::Integer;
 using tasty_int::detail::Sign;
@@ -26,7 +27,7 @@ using tasty_int_test::NONNEGATIVE_ARITHMETIC_VALUES;
 
 template<typename SubtrahendType>
 Integer
-subtract_from_digits(const std::vector<digit_type> &minuend,
+subtract_from_digits(const SmallVector<digit_type> &minuend,
                      SubtrahendType                 subtrahend)
 {
     auto result_digits = minuend;
@@ -41,7 +42,7 @@ subtract_from_digits(const std::vector<digit_type> &minuend,
 template<typename MinuendType>
 Integer
 subtract_from_arithmetic(MinuendType                    minuend,
-                         const std::vector<digit_type> &subtrahend)
+                         const SmallVector<digit_type> &subtrahend)
     requires std::is_arithmetic_v<MinuendType>
 {
     auto [result_sign, result_digits] = subtract(minuend, subtrahend);
@@ -23,6 +23,7 @@ using tasty_int::detail::DIGIT_BASE;
 using tasty_int::detail::DIGIT_TYPE_MAX;
 using tasty_int::detail::Integer;
 using tasty_int::detail::Sign;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 using tasty_int::detail::sign_from_signed_arithmetic;
 using tasty_int::detail::sign_from_unsigned_arithmetic;
@@ -35,11 +36,11 @@ using binary_digits_operation_test_common::convert_to;
 
 template<typename SubtrahendType>
 void
-test_subtract_in_place(const std::vector<digit_type> &minuend,
+test_subtract_in_place(const SmallVector<digit_type> &minuend,
                        const SubtrahendType          &subtrahend,
                        const Integer                 &expected_result)
 {
-    std::vector<digit_type> result_digits = minuend;
+    SmallVector<digit_type> result_digits = minuend;
 
     Sign result_sign = subtract_in_place(subtrahend, result_digits);
 
@@ -61,13 +62,13 @@ test_subtract(const MinuendType    &minuend,
 
 template<typename SubtrahendType>
 void
-test_subtract_from_digits(const std::vector<digit_type> &minuend,
+test_subtract_from_digits(const SmallVector<digit_type> &minuend,
                           const SubtrahendType          &subtrahend,
                           const Integer                 &expected_result)
 {
     test_subtract_in_place(minuend, subtrahend, expected_result);
 
-    if constexpr (std::is_same_v<SubtrahendType, std::vector<digit_type>>)
+    if constexpr (std::is_same_v<SubtrahendType, SmallVector<digit_type>>)
         test_subtract(minuend, subtrahend, expected_result);
 }
 
@@ -78,9 +79,9 @@ test_subtract_from_digits(
     Sign                                                  expected_sign
 )
 {
-    const std::vector<digit_type> &minuend         = test_param.digits_operand;
+    const SmallVector<digit_type> &minuend         = test_param.digits_operand;
     const SubtrahendType          &subtrahend      = test_param.other_operand;
-    const std::vector<digit_type> &expected_digits = test_param.expected_result;
+    const SmallVector<digit_type> &expected_digits = test_param.expected_result;
     Integer expected_result = {
         .sign   = expected_sign,
         .digits = expected_digits
@@ -98,8 +99,8 @@ test_subtract_from_arithmetic(
     requires std::is_arithmetic_v<MinuendType>
 {
     MinuendType                    minuend         = test_param.other_operand;
-    const std::vector<digit_type> &subtrahend      = test_param.digits_operand;
-    const std::vector<digit_type> &expected_digits = test_param.expected_result;
+    const SmallVector<digit_type> &subtrahend      = test_param.digits_operand;
+    const SmallVector<digit_type> &expected_digits = test_param.expected_result;
     Integer expected_result = {
         .sign   = expected_sign,
         .digits = expected_digits
@@ -110,14 +111,14 @@ test_subtract_from_arithmetic(
 
 
 class DigitsSubtractionIdentitiesTest
-    : public ::testing::TestWithParam<std::vector<digit_type>>
+    : public ::testing::TestWithParam<SmallVector<digit_type>>
 {}; // class DigitsSubtractionIdentitiesTest
 
 TEST_P(DigitsSubtractionIdentitiesTest,
        DigitsValueMinusIdenticalDigitsValueEqualsZero)
 {
-    std::vector<digit_type> minuend    = GetParam();
-    std::vector<digit_type> subtrahend = minuend;
+    SmallVector<digit_type> minuend    = GetParam();
+    SmallVector<digit_type> subtrahend = minuend;
     Integer ZERO = { .sign = Sign::ZERO, .digits = { 0 } };
 
     test_subtract_from_digits(minuend, subtrahend, ZERO);
@@ -125,7 +126,7 @@ TEST_P(DigitsSubtractionIdentitiesTest,
 
 TEST_P(DigitsSubtractionIdentitiesTest, DigitsValueMinusSelfEqualsZero)
 {
-    std::vector<digit_type> digits = GetParam();
+    SmallVector<digit_type> digits = GetParam();
     Integer ZERO = { .sign = Sign::ZERO, .digits = { 0 } };
 
     auto sign = subtract_in_place(digits, digits);
@@ -137,8 +138,8 @@ TEST_P(DigitsSubtractionIdentitiesTest, DigitsValueMinusSelfEqualsZero)
 TEST_P(DigitsSubtractionIdentitiesTest,
        DigitsValueMinusZeroDigitsValueEqualsOriginalValue)
 {
-    std::vector<digit_type> minuend = GetParam();
-    std::vector<digit_type> ZERO    = { 0 };
+    SmallVector<digit_type> minuend = GetParam();
+    SmallVector<digit_type> ZERO    = { 0 };
     Integer original = {
         .sign   = sign_from_digits(minuend, Sign::POSITIVE),
         .digits = minuend
@@ -150,7 +151,7 @@ TEST_P(DigitsSubtractionIdentitiesTest,
 TEST_P(DigitsSubtractionIdentitiesTest,
        DigitsValueMinusZeroIntegralValueEqualsOriginalValue)
 {
-    std::vector<digit_type> minuend = GetParam();
+    SmallVector<digit_type> minuend = GetParam();
     std::uintmax_t          ZERO    = 0;
     Integer original = {
         .sign   = sign_from_digits(minuend, Sign::POSITIVE),
@@ -164,7 +165,7 @@ INSTANTIATE_TEST_SUITE_P(
     DigitsSubtractionTest,
     DigitsSubtractionIdentitiesTest,
     ::testing::ValuesIn(
-        std::vector<std::vector<digit_type>> {
+        std::vector<SmallVector<digit_type>> {
             { 0 },
             { 1 },
             { 2 },
@@ -189,7 +190,7 @@ INSTANTIATE_TEST_SUITE_P(
 
 class DigitsAndDigitsNonzeroResultSubtractionTest
     : public ::testing::TestWithParam<
-          BinaryDigitsOperationTestParam<std::vector<digit_type>>
+          BinaryDigitsOperationTestParam<SmallVector<digit_type>>
       >
 {}; // class DigitsAndDigitsNonzeroResultSubtractionTest
 
@@ -207,7 +208,7 @@ INSTANTIATE_TEST_SUITE_P(
     DigitsSubtractionTest,
     DigitsMinusDigitsPositiveResultSubtractionTest,
     ::testing::ValuesIn(
-        std::vector<BinaryDigitsOperationTestParam<std::vector<digit_type>>> {
+        std::vector<BinaryDigitsOperationTestParam<SmallVector<digit_type>>> {
             { { 3 }, { 2 }, { 1 } },
             { { DIGIT_TYPE_MAX }, { 7 }, { DIGIT_TYPE_MAX - 7 } },
 
@@ -259,7 +260,7 @@ INSTANTIATE_TEST_SUITE_P(
     DigitsSubtractionTest,
     DigitsMinusDigitsNegativeResultSubtractionTest,
     ::testing::ValuesIn(
-        std::vector<BinaryDigitsOperationTestParam<std::vector<digit_type>>> {
+        std::vector<BinaryDigitsOperationTestParam<SmallVector<digit_type>>> {
             { { 0 }, { 1 }, { 1 } },
             { { 0 }, { 2 }, { 2 } },
             { { 0 }, { DIGIT_TYPE_MAX }, { DIGIT_TYPE_MAX } },
@@ -301,7 +302,7 @@ TEST_P(IntegralSubtractionIdentitiesTest,
     Integer ZERO = { .sign = Sign::ZERO, .digits = { 0 } };
 
     std::uintmax_t          subtrahend = GetParam();
-    std::vector<digit_type> minuend    = digits_from_integral(subtrahend);
+    SmallVector<digit_type> minuend    = digits_from_integral(subtrahend);
 
     test_subtract_from_digits(minuend, subtrahend, ZERO);
 }
@@ -312,7 +313,7 @@ TEST_P(IntegralSubtractionIdentitiesTest,
     Integer ZERO = { .sign = Sign::ZERO, .digits = { 0 } };
 
     std::uintmax_t          minuend    = GetParam();
-    std::vector<digit_type> subtrahend = digits_from_integral(minuend);
+    SmallVector<digit_type> subtrahend = digits_from_integral(minuend);
 
     test_subtract(minuend, subtrahend, ZERO);
 }
@@ -321,7 +322,7 @@ TEST_P(IntegralSubtractionIdentitiesTest,
        IntegralValueMinusZeroDigitsValueEqualsOriginalValue)
 {
     std::uintmax_t          minuend = GetParam();
-    std::vector<digit_type> ZERO    = { 0 };
+    SmallVector<digit_type> ZERO    = { 0 };
     Integer original = {
         .sign   = sign_from_unsigned_arithmetic(minuend),
         .digits = digits_from_integral(minuend)
@@ -357,6 +358,7 @@ DigitsMinusIntegralPositiveResultSubtractionTest::BASE_TEST_PARAMS = {
     { { 3 }, 2, { 1 } },
     { { DIGIT_TYPE_MAX }, 7, { DIGIT_TYPE_MAX - 7 } },
 
+#if !TASTY_INT_HAVE_INT128_ACCUMULATOR
     { { 0, 3 }, DIGIT_BASE, { 0, 2 } },
     { { 5, 7 },  (DIGIT_TYPE_MAX * 2) + 3, { 4, 5 } },
 
@@ -365,12 +367,14 @@ DigitsMinusIntegralPositiveResultSubtractionTest::BASE_TEST_PARAMS = {
           DIGIT_TYPE_MAX + 2,
         { DIGIT_TYPE_MAX - 1, DIGIT_TYPE_MAX - 1 }
     },
+#endif // if !TASTY_INT_HAVE_INT128_ACCUMULATOR
 
     {
         {              0, 1 },
                        1,
         { DIGIT_TYPE_MAX    }
     },
+#if !TASTY_INT_HAVE_INT128_ACCUMULATOR
     {
         {          0,              0, 1 },
           DIGIT_BASE,
@@ -386,6 +390,7 @@ DigitsMinusIntegralPositiveResultSubtractionTest::BASE_TEST_PARAMS = {
         std::numeric_limits<std::uintmax_t>::max() - 2,
         { 2                              }
     },
+#endif // if !TASTY_INT_HAVE_INT128_ACCUMULATOR
     {
         {              0,              0,              0, 1 },
                        1,
@@ -401,11 +406,13 @@ DigitsMinusIntegralPositiveResultSubtractionTest::BASE_TEST_PARAMS = {
           DIGIT_TYPE_MAX,
         {              1, DIGIT_TYPE_MAX, DIGIT_TYPE_MAX }
     },
+#if !TASTY_INT_HAVE_INT128_ACCUMULATOR
     {
         {              0,              0, 1, 1 },
               DIGIT_BASE,
         {              0, DIGIT_TYPE_MAX, 0, 1 }
     }
+#endif // if !TASTY_INT_HAVE_INT128_ACCUMULATOR
 };
 
 TEST_P(DigitsMinusIntegralPositiveResultSubtractionTest,
@@ -439,6 +446,7 @@ DigitsMinusIntegralNegativeResultSubtractionTest::BASE_TEST_PARAMS = {
     { { 1 }, DIGIT_TYPE_MAX, { DIGIT_TYPE_MAX - 1 } },
     { { 2 }, 7, { 5 } },
     { { 2 }, DIGIT_TYPE_MAX, { DIGIT_TYPE_MAX - 2 } },
+#if !TASTY_INT_HAVE_INT128_ACCUMULATOR
     { { 0 }, DIGIT_BASE, { 0, 1 } },
     { { 1 }, DIGIT_BASE, { DIGIT_TYPE_MAX } },
     { { DIGIT_TYPE_MAX }, DIGIT_BASE, { 1 } },
@@ -457,6 +465,7 @@ DigitsMinusIntegralNegativeResultSubtractionTest::BASE_TEST_PARAMS = {
           std::numeric_limits<std::uintmax_t>::max(),
         {                                          0, DIGIT_TYPE_MAX }
     }
+#endif // if !TASTY_INT_HAVE_INT128_ACCUMULATOR
 };
 
 TEST_P(DigitsMinusIntegralNegativeResultSubtractionTest,
@@ -486,6 +495,7 @@ IntegralMinusDigitsPositiveResultSubtractionTest::BASE_TEST_PARAMS = {
     { { 2 }, 3, { 1 } },
     { { 7 }, DIGIT_TYPE_MAX, { DIGIT_TYPE_MAX - 7 } },
 
+#if !TASTY_INT_HAVE_INT128_ACCUMULATOR
     { { 0, 1 }, 3 * DIGIT_BASE, { 0, 2 } },
     { { 1, 2 }, (7 * DIGIT_BASE) + 5, { 4, 5 } },
 
@@ -499,6 +509,7 @@ IntegralMinusDigitsPositiveResultSubtractionTest::BASE_TEST_PARAMS = {
           std::numeric_limits<std::uintmax_t>::max(),
         {                                          0, DIGIT_TYPE_MAX }
     }
+#endif // if !TASTY_INT_HAVE_INT128_ACCUMULATOR
 };
 
 TEST_P(IntegralMinusDigitsPositiveResultSubtractionTest,
@@ -555,6 +566,7 @@ IntegralMinusDigitsNegativeResultSubtractionTest::BASE_TEST_PARAMS = {
           DIGIT_TYPE_MAX,
         {              0, DIGIT_TYPE_MAX }
     },
+#if !TASTY_INT_HAVE_INT128_ACCUMULATOR
     {
         { DIGIT_TYPE_MAX, 0, 1 },
           std::numeric_limits<std::uintmax_t>::max(),
@@ -565,6 +577,7 @@ IntegralMinusDigitsNegativeResultSubtractionTest::BASE_TEST_PARAMS = {
           std::numeric_limits<std::uintmax_t>::max(),
         {              0,              0, DIGIT_TYPE_MAX }
     }
+#endif // if !TASTY_INT_HAVE_INT128_ACCUMULATOR
 };
 
 TEST_P(IntegralMinusDigitsNegativeResultSubtractionTest,
@@ -592,7 +605,7 @@ TEST_P(FloatingPointSubtractionIdentitiesTest,
     Integer ZERO = { .sign = Sign::ZERO, .digits = { 0 } };
 
     long double             subtrahend = GetParam();
-    std::vector<digit_type> minuend    = digits_from_floating_point(subtrahend);
+    SmallVector<digit_type> minuend    = digits_from_floating_point(subtrahend);
 
     test_subtract_from_digits(minuend, subtrahend, ZERO);
 }
@@ -603,7 +616,7 @@ TEST_P(FloatingPointSubtractionIdentitiesTest,
     Integer ZERO = { .sign = Sign::ZERO, .digits = { 0 } };
 
     long double             minuend    = GetParam();
-    std::vector<digit_type> subtrahend = digits_from_floating_point(minuend);
+    SmallVector<digit_type> subtrahend = digits_from_floating_point(minuend);
 
     test_subtract(minuend, subtrahend, ZERO);
 }
@@ -612,7 +625,7 @@ TEST_P(FloatingPointSubtractionIdentitiesTest,
        FloatingPointValueMinusZeroDigitsValueEqualsOriginalValue)
 {
     long double             minuend = GetParam();
-    std::vector<digit_type> ZERO    = { 0 };
+    SmallVector<digit_type> ZERO    = { 0 };
     Integer original = {
         .sign   = sign_from_signed_arithmetic(minuend),
         .digits = digits_from_floating_point(minuend)
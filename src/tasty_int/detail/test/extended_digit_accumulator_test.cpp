@@ -15,6 +15,7 @@ using tasty_int::detail::ExtendedDigitAccumulator;
 using tasty_int::detail::IntegralDigitsView;
 using tasty_int::detail::digit_accumulator_type;
 using tasty_int::detail::digit_type;
+using tasty_int::detail::digit_from_nonnegative_value;
 using tasty_int::detail::DIGIT_TYPE_BITS;
 using tasty_int::detail::DIGIT_BASE;
 using tasty_int::detail::DIGIT_TYPE_MAX;
@@ -28,6 +29,26 @@ operator<<(std::ostream       &output,
     return output << view.value();
 }
 
+/**
+ * Prints a digit_accumulator_type as its high and low digits, since it may be
+ * an extended integer type lacking a stream insertion operator.
+ */
+struct AccumulatorPrinter
+{
+    digit_accumulator_type value;
+}; // struct AccumulatorPrinter
+
+std::ostream &
+operator<<(std::ostream       &output,
+           AccumulatorPrinter  printer)
+{
+    return output << digit_from_nonnegative_value(
+                         printer.value >> DIGIT_TYPE_BITS
+                     )
+                  << ':'
+                  << digit_from_nonnegative_value(printer.value);
+}
+
 std::ostream &
 operator<<(std::ostream             &output,
            ExtendedDigitAccumulator  accumulator)
@@ -36,8 +57,8 @@ operator<<(std::ostream             &output,
                   << ", " << accumulator.middle_digit()
                   << ", " << accumulator.high_digit()
                   << " }"
-                    "/{ " << accumulator.front()
-                  << ", " << accumulator.back()
+                    "/{ " << AccumulatorPrinter{ accumulator.front() }
+                  << ", " << AccumulatorPrinter{ accumulator.back() }
                   << " }";
 }
 
@@ -261,65 +282,69 @@ TEST_P(ExtendedDigitAccumulatorMultiplicationTest, TestMultiply)
     EXPECT_EQ(expected_result, multiplier * multiplicand);
 }
 
+const std::vector<ExtendedDigitAccumulatorMultiplicationTestParam>
+MULTIPLICATION_TEST_PARAMS = {
+    {
+        .multiplicand    = 0,
+        .multiplier      = 0,
+        .expected_result = {{ 0 }}
+    },
+    {
+        .multiplicand    = 0,
+        .multiplier      = DIGIT_TYPE_MAX,
+        .expected_result = {{ 0 }}
+    },
+    {
+        .multiplicand    = std::numeric_limits<std::uintmax_t>::max(),
+        .multiplier      = 0,
+        .expected_result = {{ 0 }}
+    },
+    {
+        .multiplicand    = 1,
+        .multiplier      = 1,
+        .expected_result = {{ 1 }}
+    },
+    {
+        .multiplicand    = 7,
+        .multiplier      = 3,
+        .expected_result = {{ 21 }}
+    },
+    {
+        .multiplicand    = DIGIT_TYPE_MAX,
+        .multiplier      = 1,
+        .expected_result = {{ DIGIT_TYPE_MAX }}
+    },
+    {
+        .multiplicand    = DIGIT_TYPE_MAX,
+        .multiplier      = DIGIT_TYPE_MAX,
+        .expected_result = {{ DIGIT_TYPE_MAX * DIGIT_TYPE_MAX }}
+    },
+#if !TASTY_INT_HAVE_INT128_ACCUMULATOR
+    // multiplicands spanning multiple digits
+    {
+        .multiplicand    = DIGIT_BASE * (DIGIT_BASE / 2),
+        .multiplier      = 2,
+        .expected_result = {{ 0, 1 }}
+    },
+    {
+        .multiplicand    = DIGIT_BASE * (DIGIT_BASE / 2) + 1,
+        .multiplier      = 4,
+        .expected_result = {{ 4, 2 }}
+    },
+    {
+        .multiplicand    = std::numeric_limits<std::uintmax_t>::max(),
+        .multiplier      = DIGIT_TYPE_MAX,
+        .expected_result = {{
+            1 + (DIGIT_TYPE_MAX << DIGIT_TYPE_BITS), DIGIT_TYPE_MAX - 1
+        }}
+    }
+#endif // if !TASTY_INT_HAVE_INT128_ACCUMULATOR
+};
+
 INSTANTIATE_TEST_SUITE_P(
     ExtendedDigitAccumulatorTest,
     ExtendedDigitAccumulatorMultiplicationTest,
-    ::testing::ValuesIn(
-        std::vector<ExtendedDigitAccumulatorMultiplicationTestParam> {
-            {
-                .multiplicand    = 0,
-                .multiplier      = 0,
-                .expected_result = {{ 0 }}
-            },
-            {
-                .multiplicand    = 0,
-                .multiplier      = DIGIT_TYPE_MAX,
-                .expected_result = {{ 0 }}
-            },
-            {
-                .multiplicand    = std::numeric_limits<std::uintmax_t>::max(),
-                .multiplier      = 0,
-                .expected_result = {{ 0 }}
-            },
-            {
-                .multiplicand    = 1,
-                .multiplier      = 1,
-                .expected_result = {{ 1 }}
-            },
-            {
-                .multiplicand    = 7,
-                .multiplier      = 3,
-                .expected_result = {{ 21 }}
-            },
-            {
-                .multiplicand    = DIGIT_TYPE_MAX,
-                .multiplier      = 1,
-                .expected_result = {{ DIGIT_TYPE_MAX }}
-            },
-            {
-                .multiplicand    = DIGIT_TYPE_MAX,
-                .multiplier      = DIGIT_TYPE_MAX,
-                .expected_result = {{ DIGIT_TYPE_MAX * DIGIT_TYPE_MAX }}
-            },
-            {
-                .multiplicand    = DIGIT_BASE * (DIGIT_BASE / 2),
-                .multiplier      = 2,
-                .expected_result = {{ 0, 1 }}
-            },
-            {
-                .multiplicand    = DIGIT_BASE * (DIGIT_BASE / 2) + 1,
-                .multiplier      = 4,
-                .expected_result = {{ 4, 2 }}
-            },
-            {
-                .multiplicand    = std::numeric_limits<std::uintmax_t>::max(),
-                .multiplier      = DIGIT_TYPE_MAX,
-                .expected_result = {{
-                    1 + (DIGIT_TYPE_MAX << DIGIT_TYPE_BITS), DIGIT_TYPE_MAX - 1
-                }}
-            }
-        }
-    )
+    ::testing::ValuesIn(MULTIPLICATION_TEST_PARAMS)
 );
 
 
@@ -406,7 +431,7 @@ INSTANTIATE_TEST_SUITE_P(
             },
             {
                 .subtrahend      = {{
-                    std::numeric_limits<std::uintmax_t>::max()
+                    std::numeric_limits<digit_accumulator_type>::max()
                 }},
                 .minuend         = {{ DIGIT_TYPE_MAX }},
                 .expected_result = {{ DIGIT_TYPE_MAX << DIGIT_TYPE_BITS }}
@@ -415,23 +440,23 @@ INSTANTIATE_TEST_SUITE_P(
                 .subtrahend      = {{ 0, 1 }},
                 .minuend         = {{ 1 }},
                 .expected_result = {{
-                    std::numeric_limits<std::uintmax_t>::max()
+                    std::numeric_limits<digit_accumulator_type>::max()
                 }}
             },
             {
                 .subtrahend      = {{ 0, 1 }},
                 .minuend         = {{
-                    std::numeric_limits<std::uintmax_t>::max()
+                    std::numeric_limits<digit_accumulator_type>::max()
                 }},
                 .expected_result = {{ 1 }}
             },
             {
                 .subtrahend      = {{
-                    std::numeric_limits<std::uintmax_t>::max(),
+                    std::numeric_limits<digit_accumulator_type>::max(),
                     DIGIT_TYPE_MAX
                 }},
                 .minuend         = {{
-                    std::numeric_limits<std::uintmax_t>::max()
+                    std::numeric_limits<digit_accumulator_type>::max()
                 }},
                 .expected_result = {{ 0, DIGIT_TYPE_MAX }}
             },
@@ -444,18 +469,18 @@ INSTANTIATE_TEST_SUITE_P(
                 .subtrahend      = {{ 1, DIGIT_TYPE_MAX }},
                 .minuend         = {{ DIGIT_TYPE_MAX, 1 }},
                 .expected_result = {{
-                    std::numeric_limits<std::uintmax_t>::max() - DIGIT_TYPE_MAX
+                    std::numeric_limits<digit_accumulator_type>::max() - DIGIT_TYPE_MAX
                         + 2,
                     DIGIT_TYPE_MAX - 2
                 }}
             },
             {
                 .subtrahend      = {{
-                    std::numeric_limits<std::uintmax_t>::max(),
+                    std::numeric_limits<digit_accumulator_type>::max(),
                     DIGIT_TYPE_MAX
                 }},
                 .minuend         = {{
-                    std::numeric_limits<std::uintmax_t>::max(),
+                    std::numeric_limits<digit_accumulator_type>::max(),
                     DIGIT_TYPE_MAX
                 }},
                 .expected_result = {{ 0 }}
@@ -482,67 +507,70 @@ TEST_P(ExtendedDigitAccumulatorAndIntegralDigitsViewSubtractionTest,
     EXPECT_EQ(expected_result, subtrahend);
 }
 
+const std::vector<
+    ExtendedDigitAccumulatorSubtractionTestParam<IntegralDigitsView>
+> INTEGRAL_DIGITS_VIEW_SUBTRACTION_TEST_PARAMS = {
+    {
+        .subtrahend      = {{ 0 }},
+        .minuend         =    0,
+        .expected_result = {{ 0 }}
+    },
+    {
+        .subtrahend      = {{ 1 }},
+        .minuend         =    1,
+        .expected_result = {{ 0 }}
+    },
+    {
+        .subtrahend      = {{ 1 }},
+        .minuend         =    0,
+        .expected_result = {{ 1 }}
+    },
+    {
+        .subtrahend      = {{ 2 }},
+        .minuend         =    1,
+        .expected_result = {{ 1 }}
+    },
+    {
+        .subtrahend      = {{ DIGIT_TYPE_MAX + 1 }},
+        .minuend         = DIGIT_TYPE_MAX,
+        .expected_result = {{ 1 }}
+    },
+    {
+        .subtrahend      = {{
+            std::numeric_limits<digit_accumulator_type>::max()
+        }},
+        .minuend         = DIGIT_TYPE_MAX,
+        .expected_result = {{ DIGIT_TYPE_MAX << DIGIT_TYPE_BITS }}
+    },
+    {
+        .subtrahend      = {{ 0, 1 }},
+        .minuend         = 1,
+        .expected_result = {{
+            std::numeric_limits<digit_accumulator_type>::max()
+        }}
+    },
+#if !TASTY_INT_HAVE_INT128_ACCUMULATOR
+    // minuends spanning multiple digits
+    {
+        .subtrahend      = {{ 0, 1 }},
+        .minuend         = std::numeric_limits<std::uintmax_t>::max(),
+        .expected_result = {{ 1 }}
+    },
+    {
+        .subtrahend      = {{
+            std::numeric_limits<digit_accumulator_type>::max(),
+            DIGIT_TYPE_MAX
+        }},
+        .minuend         = std::numeric_limits<std::uintmax_t>::max(),
+        .expected_result = {{ 0, DIGIT_TYPE_MAX }}
+    }
+#endif // if !TASTY_INT_HAVE_INT128_ACCUMULATOR
+};
+
 INSTANTIATE_TEST_SUITE_P(
     ExtendedDigitAccumulatorTest,
     ExtendedDigitAccumulatorAndIntegralDigitsViewSubtractionTest,
-    ::testing::ValuesIn(
-        std::vector<
-            ExtendedDigitAccumulatorSubtractionTestParam<IntegralDigitsView>
-        > {
-            {
-                .subtrahend      = {{ 0 }},
-                .minuend         =    0,
-                .expected_result = {{ 0 }}
-            },
-            {
-                .subtrahend      = {{ 1 }},
-                .minuend         =    1,
-                .expected_result = {{ 0 }}
-            },
-            {
-                .subtrahend      = {{ 1 }},
-                .minuend         =    0,
-                .expected_result = {{ 1 }}
-            },
-            {
-                .subtrahend      = {{ 2 }},
-                .minuend         =    1,
-                .expected_result = {{ 1 }}
-            },
-            {
-                .subtrahend      = {{ DIGIT_TYPE_MAX + 1 }},
-                .minuend         = DIGIT_TYPE_MAX,
-                .expected_result = {{ 1 }}
-            },
-            {
-                .subtrahend      = {{
-                    std::numeric_limits<std::uintmax_t>::max()
-                }},
-                .minuend         = DIGIT_TYPE_MAX,
-                .expected_result = {{ DIGIT_TYPE_MAX << DIGIT_TYPE_BITS }}
-            },
-            {
-                .subtrahend      = {{ 0, 1 }},
-                .minuend         = 1,
-                .expected_result = {{
-                    std::numeric_limits<std::uintmax_t>::max()
-                }}
-            },
-            {
-                .subtrahend      = {{ 0, 1 }},
-                .minuend         = std::numeric_limits<std::uintmax_t>::max(),
-                .expected_result = {{ 1 }}
-            },
-            {
-                .subtrahend      = {{
-                    std::numeric_limits<std::uintmax_t>::max(),
-                    DIGIT_TYPE_MAX
-                }},
-                .minuend         = std::numeric_limits<std::uintmax_t>::max(),
-                .expected_result = {{ 0, DIGIT_TYPE_MAX }}
-            }
-        }
-    )
+    ::testing::ValuesIn(INTEGRAL_DIGITS_VIEW_SUBTRACTION_TEST_PARAMS)
 );
 
 
@@ -618,11 +646,11 @@ TEST(ExtendedDigitAccumulatorTest,
      RightShiftNonzeroWithNonzeroBitOffsetWithMultipleBitsOverlap)
 {
     ExtendedDigitAccumulator accumulator = {{
-        std::numeric_limits<std::uintmax_t>::max() ^ top_bits(3),
+        std::numeric_limits<digit_accumulator_type>::max() ^ top_bits(3),
         DIGIT_TYPE_MAX
     }};
     ExtendedDigitAccumulator expected_result = {{
-        std::numeric_limits<std::uintmax_t>::max() ^ (top_bits(3) >> 5),
+        std::numeric_limits<digit_accumulator_type>::max() ^ (top_bits(3) >> 5),
         DIGIT_TYPE_MAX >> 5
 
     }};
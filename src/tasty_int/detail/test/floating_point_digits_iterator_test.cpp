@@ -170,23 +170,27 @@ TEST_P(FloatingPointDigitsIteratorTest,
 }
 
 TEST_P(FloatingPointDigitsIteratorTest,
-       RemainingValueInitiallyEqualsOriginalValue)
+       HasRemainingDigitsInitiallyIfValueIsAtLeastOne)
 {
     long double value = GetParam();
     FloatingPointDigitsIterator iter(value);
 
-    EXPECT_EQ(value, iter.remaining_value());
+    EXPECT_EQ(value >= 1.0L, iter.has_remaining_digits());
 }
 
 TEST_P(FloatingPointDigitsIteratorTest,
-       RemainingValueAfterIncrementEqualsOriginalValueDividedbyDigitBase)
+       HasRemainingDigitsUntilRemainingValueIsLessThanOne)
 {
     long double value = GetParam();
     FloatingPointDigitsIterator iter(value);
+    while (value >= 1.0L) {
+        ASSERT_TRUE(iter.has_remaining_digits());
 
-    ++iter;
+        value /= DIGIT_BASE;
+        ++iter;
+    }
 
-    EXPECT_EQ(value / DIGIT_BASE, iter.remaining_value());
+    EXPECT_FALSE(iter.has_remaining_digits());
 }
 
 TEST_P(FloatingPointDigitsIteratorTest, PreIncrementTraversal)
@@ -200,7 +200,11 @@ TEST(IntegerAdditionTest, PositiveIntegerAndPositiveUnsignedIntegralWithWrap)
     std::uintmax_t addend2  = std::numeric_limits<std::uintmax_t>::max();
     Integer expected_result = {
         .sign   = Sign::POSITIVE,
+#if TASTY_INT_HAVE_INT128_ACCUMULATOR
+        .digits = { DIGIT_TYPE_MAX - 1, 0, 0, 1 }
+#else
         .digits = { DIGIT_TYPE_MAX - 1, DIGIT_TYPE_MAX, 0, 1 }
+#endif // if TASTY_INT_HAVE_INT128_ACCUMULATOR
     };
 
     test_addition(addend1, addend2, expected_result);
@@ -245,7 +249,11 @@ TEST(IntegerAdditionTest, NegativeIntegerAndUnsignedIntegralWithWrap)
     std::uintmax_t addend2  = std::numeric_limits<std::uintmax_t>::max();
     Integer expected_result = {
         .sign   = Sign::NEGATIVE,
+#if TASTY_INT_HAVE_INT128_ACCUMULATOR
+        .digits = { 2, 1, DIGIT_TYPE_MAX }
+#else
         .digits = { 2, 2, DIGIT_TYPE_MAX - 1 }
+#endif // if TASTY_INT_HAVE_INT128_ACCUMULATOR
     };
 
     test_addition(addend1, addend2, expected_result);
@@ -360,7 +368,11 @@ TEST(IntegerAdditionTest, PositiveIntegerAndNegativeSignedIntegralWithWrap)
     std::intmax_t addend2   = std::numeric_limits<std::intmax_t>::lowest();
     Integer expected_result = {
         .sign   = Sign::POSITIVE,
+#if TASTY_INT_HAVE_INT128_ACCUMULATOR
+        .digits = { (DIGIT_TYPE_MAX / 2) - 7, DIGIT_TYPE_MAX / 2, 2 }
+#else
         .digits = { DIGIT_TYPE_MAX - 7, DIGIT_TYPE_MAX, 1 }
+#endif // if TASTY_INT_HAVE_INT128_ACCUMULATOR
     };
 
     test_addition(addend1, addend2, expected_result);
@@ -426,7 +438,11 @@ TEST(IntegerAdditionTest, NegativeIntegerAndNegativeSignedIntegralWithWrap)
     std::intmax_t addend2   = std::numeric_limits<std::intmax_t>::lowest();
     Integer expected_result = {
         .sign   = Sign::POSITIVE,
+#if TASTY_INT_HAVE_INT128_ACCUMULATOR
+        .digits = { (DIGIT_TYPE_MAX / 2) - 7, DIGIT_TYPE_MAX / 2, 2 }
+#else
         .digits = { DIGIT_TYPE_MAX - 7, DIGIT_TYPE_MAX, 1 }
+#endif // if TASTY_INT_HAVE_INT128_ACCUMULATOR
     };
 
     test_addition(addend1, addend2, expected_result);
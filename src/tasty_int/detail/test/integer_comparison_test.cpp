@@ -20,11 +20,14 @@
 
 namespace {
 
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 using tasty_int::detail::DIGIT_TYPE_MAX;
 using tasty_int::detail::DIGIT_BASE;
 using tasty_int::detail::Integer;
+using tasty_int::detail::IntegerView;
 using tasty_int::detail::Sign;
+using tasty_int::detail::compare;
 using tasty_int::detail::sign_from_digits;
 using tasty_int::detail::conversions::digits_from_integral;
 using tasty_int::detail::conversions::digits_from_floating_point;
@@ -73,7 +76,7 @@ INSTANTIATE_TEST_SUITE_P(
 );
 
 using UnequalDigitsTestParam = InequalityTestParam<
-    std::vector<digit_type>, std::vector<digit_type>
+    SmallVector<digit_type>, SmallVector<digit_type>
 >;
 
 class IntegerAndIntegerUnequalDigitsInequalityTest
@@ -144,7 +147,7 @@ INSTANTIATE_TEST_SUITE_P(
 );
 
 class IntegerAndIntegerEqualDigitsInequalityTest
-    : public ::testing::TestWithParam<std::vector<digit_type>>
+    : public ::testing::TestWithParam<SmallVector<digit_type>>
 {}; // class IntegerAndIntegerEqualDigitsInequalityTest
 
 TEST_P(IntegerAndIntegerEqualDigitsInequalityTest,
@@ -160,7 +163,7 @@ INSTANTIATE_TEST_SUITE_P(
     IntegerComparisonTest,
     IntegerAndIntegerEqualDigitsInequalityTest,
     ::testing::ValuesIn(
-        std::vector<std::vector<digit_type>> {
+        std::vector<SmallVector<digit_type>> {
             { 1 },
             { 0, 1 },
             { 0, 0, 1 },
@@ -213,7 +216,7 @@ INSTANTIATE_TEST_SUITE_P(
 );
 
 using DigitsSmallerThanUnsignedIntegralTestParam = InequalityTestParam<
-    std::vector<digit_type>, std::uintmax_t
+    SmallVector<digit_type>, std::uintmax_t
 >;
 
 class DigitsSmallerThanUnsignedIntegralTest
@@ -248,28 +251,41 @@ TEST_P(DigitsSmallerThanUnsignedIntegralTest,
     tasty_int_test::expect_unequal(lesser, greater);
 }
 
+const std::vector<DigitsSmallerThanUnsignedIntegralTestParam>
+DIGITS_SMALLER_THAN_UNSIGNED_INTEGRAL_TEST_PARAMS = {
+#if TASTY_INT_HAVE_INT128_ACCUMULATOR
+    { .smaller = { 0 }, .larger = 1 },
+    {
+        .smaller = { 1 },
+        .larger  = std::numeric_limits<std::uintmax_t>::max()
+    },
+    {
+        .smaller = { DIGIT_TYPE_MAX - 1 },
+        .larger  = std::numeric_limits<std::uintmax_t>::max()
+    }
+#else
+    { .smaller = { 0 },              .larger = 1 },
+    { .smaller = { 1 },              .larger = DIGIT_BASE },
+    { .smaller = { DIGIT_TYPE_MAX }, .larger = DIGIT_BASE },
+    {
+        .smaller = { 0, 1 },
+        .larger  = std::numeric_limits<std::uintmax_t>::max()
+    },
+    {
+        .smaller = { DIGIT_TYPE_MAX - 1, DIGIT_TYPE_MAX },
+        .larger  = std::numeric_limits<std::uintmax_t>::max()
+    }
+#endif // if TASTY_INT_HAVE_INT128_ACCUMULATOR
+};
+
 INSTANTIATE_TEST_SUITE_P(
     IntegerComparisonTest,
     DigitsSmallerThanUnsignedIntegralTest,
-    ::testing::ValuesIn(
-        std::vector<DigitsSmallerThanUnsignedIntegralTestParam> {
-            { .smaller = { 0 },              .larger = 1 },
-            { .smaller = { 1 },              .larger = DIGIT_BASE },
-            { .smaller = { DIGIT_TYPE_MAX }, .larger = DIGIT_BASE },
-            {
-                .smaller = { 0, 1 },
-                .larger  = std::numeric_limits<std::uintmax_t>::max()
-            },
-            {
-                .smaller = { DIGIT_TYPE_MAX - 1, DIGIT_TYPE_MAX },
-                .larger  = std::numeric_limits<std::uintmax_t>::max()
-            }
-        }
-    )
+    ::testing::ValuesIn(DIGITS_SMALLER_THAN_UNSIGNED_INTEGRAL_TEST_PARAMS)
 );
 
 using UnsignedIntegralSmallerThanDigitsTestParam = InequalityTestParam<
-    std::uintmax_t, std::vector<digit_type>
+    std::uintmax_t, SmallVector<digit_type>
 >;
 
 class UnsignedIntegralSmallerThanDigitsTest
@@ -294,20 +310,31 @@ TEST_P(UnsignedIntegralSmallerThanDigitsTest,
     tasty_int_test::expect_unequal(lesser, greater);
 }
 
+const std::vector<UnsignedIntegralSmallerThanDigitsTestParam>
+UNSIGNED_INTEGRAL_SMALLER_THAN_DIGITS_TEST_PARAMS = {
+#if TASTY_INT_HAVE_INT128_ACCUMULATOR
+    { .smaller = 0,              .larger = { 1 } },
+    { .smaller = 1,              .larger = { 0, 1 } },
+    { .smaller = DIGIT_TYPE_MAX, .larger = { 0, 1 } },
+    {
+        .smaller = std::numeric_limits<std::uintmax_t>::max() - 1,
+        .larger  = { DIGIT_TYPE_MAX }
+    }
+#else
+    { .smaller = 0,              .larger = { 1 } },
+    { .smaller = 1,              .larger = { 0, 1 } },
+    { .smaller = DIGIT_TYPE_MAX, .larger = { 0, 1 } },
+    {
+        .smaller = std::numeric_limits<std::uintmax_t>::max(),
+        .larger  = { 0, 0, 1 }
+    }
+#endif // if TASTY_INT_HAVE_INT128_ACCUMULATOR
+};
+
 INSTANTIATE_TEST_SUITE_P(
     IntegerComparisonTest,
     UnsignedIntegralSmallerThanDigitsTest,
-    ::testing::ValuesIn(
-        std::vector<UnsignedIntegralSmallerThanDigitsTestParam> {
-            { .smaller = 0,              .larger = { 1 } },
-            { .smaller = 1,              .larger = { 0, 1 } },
-            { .smaller = DIGIT_TYPE_MAX, .larger = { 0, 1 } },
-            {
-                .smaller = std::numeric_limits<std::uintmax_t>::max(),
-                .larger  = { 0, 0, 1 }
-            }
-        }
-    )
+    ::testing::ValuesIn(UNSIGNED_INTEGRAL_SMALLER_THAN_DIGITS_TEST_PARAMS)
 );
 
 
@@ -386,7 +413,7 @@ INSTANTIATE_TEST_SUITE_P(
 );
 
 using DigitsSmallerThanPositiveSignedIntegralTestParam = InequalityTestParam<
-    std::vector<digit_type>, std::intmax_t
+    SmallVector<digit_type>, std::intmax_t
 >;
 
 class DigitsSmallerThanPositiveSignedIntegralTest
@@ -421,28 +448,41 @@ TEST_P(DigitsSmallerThanPositiveSignedIntegralTest,
     tasty_int_test::expect_unequal(lesser, greater);
 }
 
+const std::vector<DigitsSmallerThanPositiveSignedIntegralTestParam>
+DIGITS_SMALLER_THAN_POSITIVE_SIGNED_INTEGRAL_TEST_PARAMS = {
+#if TASTY_INT_HAVE_INT128_ACCUMULATOR
+    { .smaller = { 0 }, .larger = 1 },
+    {
+        .smaller = { 1 },
+        .larger  = std::numeric_limits<std::intmax_t>::max()
+    },
+    {
+        .smaller = { std::numeric_limits<std::intmax_t>::max() - 1 },
+        .larger  = std::numeric_limits<std::intmax_t>::max()
+    }
+#else
+    { .smaller = { 0 },              .larger = 1 },
+    { .smaller = { 1 },              .larger = DIGIT_BASE },
+    { .smaller = { DIGIT_TYPE_MAX }, .larger = DIGIT_BASE },
+    {
+        .smaller = { 0, 1 },
+        .larger  = std::numeric_limits<std::intmax_t>::max()
+    },
+    {
+        .smaller = { DIGIT_TYPE_MAX, 1 },
+        .larger  = std::numeric_limits<std::intmax_t>::max()
+    }
+#endif // if TASTY_INT_HAVE_INT128_ACCUMULATOR
+};
+
 INSTANTIATE_TEST_SUITE_P(
     IntegerComparisonTest,
     DigitsSmallerThanPositiveSignedIntegralTest,
-    ::testing::ValuesIn(
-        std::vector<DigitsSmallerThanPositiveSignedIntegralTestParam> {
-            { .smaller = { 0 },              .larger = 1 },
-            { .smaller = { 1 },              .larger = DIGIT_BASE },
-            { .smaller = { DIGIT_TYPE_MAX }, .larger = DIGIT_BASE },
-            {
-                .smaller = { 0, 1 },
-                .larger  = std::numeric_limits<std::intmax_t>::max()
-            },
-            {
-                .smaller = { DIGIT_TYPE_MAX, 1 },
-                .larger  = std::numeric_limits<std::intmax_t>::max()
-            }
-        }
-    )
+    ::testing::ValuesIn(DIGITS_SMALLER_THAN_POSITIVE_SIGNED_INTEGRAL_TEST_PARAMS)
 );
 
 using DigitsSmallerThanNegativeSignedIntegralTestParam = InequalityTestParam<
-    std::vector<digit_type>, std::intmax_t
+    SmallVector<digit_type>, std::intmax_t
 >;
 
 class DigitsSmallerThanNegativeSignedIntegralTest
@@ -477,34 +517,47 @@ TEST_P(DigitsSmallerThanNegativeSignedIntegralTest,
     tasty_int_test::expect_unequal(lesser, greater);
 }
 
+const std::vector<DigitsSmallerThanNegativeSignedIntegralTestParam>
+DIGITS_SMALLER_THAN_NEGATIVE_SIGNED_INTEGRAL_TEST_PARAMS = {
+#if TASTY_INT_HAVE_INT128_ACCUMULATOR
+    { .smaller = { 0 }, .larger = -1 },
+    {
+        .smaller = { 1 },
+        .larger  = std::numeric_limits<std::intmax_t>::lowest()
+    },
+    {
+        .smaller = { std::numeric_limits<std::intmax_t>::max() },
+        .larger  = std::numeric_limits<std::intmax_t>::lowest()
+    }
+#else
+    { .smaller = { 0 }, .larger = -1 },
+    {
+        .smaller = { 1 },
+        .larger  = -static_cast<std::intmax_t>(DIGIT_BASE)
+    },
+    {
+        .smaller = { DIGIT_TYPE_MAX },
+        .larger  = -static_cast<std::intmax_t>(DIGIT_BASE)
+    },
+    {
+        .smaller = { 0, 1 },
+        .larger  = std::numeric_limits<std::intmax_t>::lowest()
+    },
+    {
+        .smaller = { DIGIT_TYPE_MAX, 1 },
+        .larger  = std::numeric_limits<std::intmax_t>::lowest()
+    }
+#endif // if TASTY_INT_HAVE_INT128_ACCUMULATOR
+};
+
 INSTANTIATE_TEST_SUITE_P(
     IntegerComparisonTest,
     DigitsSmallerThanNegativeSignedIntegralTest,
-    ::testing::ValuesIn(
-        std::vector<DigitsSmallerThanNegativeSignedIntegralTestParam> {
-            { .smaller = { 0 }, .larger = -1 },
-            {
-                .smaller = { 1 },
-                .larger  = -static_cast<std::intmax_t>(DIGIT_BASE)
-            },
-            {
-                .smaller = { DIGIT_TYPE_MAX },
-                .larger  = -static_cast<std::intmax_t>(DIGIT_BASE)
-            },
-            {
-                .smaller = { 0, 1 },
-                .larger  = std::numeric_limits<std::intmax_t>::lowest()
-            },
-            {
-                .smaller = { DIGIT_TYPE_MAX, 1 },
-                .larger  = std::numeric_limits<std::intmax_t>::lowest()
-            }
-        }
-    )
+    ::testing::ValuesIn(DIGITS_SMALLER_THAN_NEGATIVE_SIGNED_INTEGRAL_TEST_PARAMS)
 );
 
 using NonnegativeSignedIntegralSmallerThanDigitsTestParam = InequalityTestParam<
-    std::intmax_t, std::vector<digit_type>
+    std::intmax_t, SmallVector<digit_type>
 >;
 
 class NonnegativeSignedIntegralSmallerThanDigitsTest
@@ -531,28 +584,42 @@ TEST_P(NonnegativeSignedIntegralSmallerThanDigitsTest,
     tasty_int_test::expect_unequal(lesser, greater);
 }
 
+const std::vector<NonnegativeSignedIntegralSmallerThanDigitsTestParam>
+NONNEGATIVE_SIGNED_INTEGRAL_SMALLER_THAN_DIGITS_TEST_PARAMS = {
+#if TASTY_INT_HAVE_INT128_ACCUMULATOR
+    { .smaller = 0,              .larger = { 1 } },
+    { .smaller = 1,              .larger = { 0, 1 } },
+    {
+        .smaller = std::numeric_limits<std::intmax_t>::max(),
+        .larger  = { DIGIT_TYPE_MAX }
+    },
+    {
+        .smaller = std::numeric_limits<std::intmax_t>::max(),
+        .larger  = { 0, 1 }
+    }
+#else
+    { .smaller = 0,              .larger = { 1 } },
+    { .smaller = 1,              .larger = { 0, 1 } },
+    { .smaller = DIGIT_TYPE_MAX, .larger = { 0, 1 } },
+    {
+        .smaller = std::numeric_limits<std::intmax_t>::max(),
+        .larger  = { DIGIT_TYPE_MAX, DIGIT_TYPE_MAX }
+    },
+    {
+        .smaller = std::numeric_limits<std::intmax_t>::max(),
+        .larger  = { 0, 0, 1 }
+    }
+#endif // if TASTY_INT_HAVE_INT128_ACCUMULATOR
+};
+
 INSTANTIATE_TEST_SUITE_P(
     IntegerComparisonTest,
     NonnegativeSignedIntegralSmallerThanDigitsTest,
-    ::testing::ValuesIn(
-        std::vector<NonnegativeSignedIntegralSmallerThanDigitsTestParam> {
-            { .smaller = 0,              .larger = { 1 } },
-            { .smaller = 1,              .larger = { 0, 1 } },
-            { .smaller = DIGIT_TYPE_MAX, .larger = { 0, 1 } },
-            {
-                .smaller = std::numeric_limits<std::intmax_t>::max(),
-                .larger  = { DIGIT_TYPE_MAX, DIGIT_TYPE_MAX }
-            },
-            {
-                .smaller = std::numeric_limits<std::intmax_t>::max(),
-                .larger  = { 0, 0, 1 }
-            }
-        }
-    )
+    ::testing::ValuesIn(NONNEGATIVE_SIGNED_INTEGRAL_SMALLER_THAN_DIGITS_TEST_PARAMS)
 );
 
 using NonpositiveSignedIntegralSmallerThanDigitsTestParam = InequalityTestParam<
-    std::intmax_t, std::vector<digit_type> 
+    std::intmax_t, SmallVector<digit_type> 
 >;
 
 class NonpositiveSignedIntegralSmallerThanDigitsTest
@@ -585,30 +652,51 @@ TEST_P(NonpositiveSignedIntegralSmallerThanDigitsTest,
     tasty_int_test::expect_unequal(lesser, greater);
 }
 
+const std::vector<NonpositiveSignedIntegralSmallerThanDigitsTestParam>
+NONPOSITIVE_SIGNED_INTEGRAL_SMALLER_THAN_DIGITS_TEST_PARAMS = {
+#if TASTY_INT_HAVE_INT128_ACCUMULATOR
+    { .smaller = 0, .larger = { 1 } },
+    {
+        .smaller = -1,
+        .larger  = { DIGIT_TYPE_MAX }
+    },
+    {
+        .smaller = -std::numeric_limits<std::intmax_t>::max(),
+        .larger  = { DIGIT_TYPE_MAX }
+    },
+    {
+        .smaller = std::numeric_limits<std::intmax_t>::lowest(),
+        .larger  = { DIGIT_TYPE_MAX }
+    },
+    {
+        .smaller = std::numeric_limits<std::intmax_t>::lowest(),
+        .larger  = { 0, 1 }
+    }
+#else
+    { .smaller = 0, .larger = { 1 } },
+    {
+        .smaller = -1,
+        .larger  = { DIGIT_TYPE_MAX }
+    },
+    {
+        .smaller = -static_cast<std::intmax_t>(DIGIT_TYPE_MAX),
+        .larger  = { 0, 1 }
+    },
+    {
+        .smaller = -static_cast<std::intmax_t>(DIGIT_BASE),
+        .larger  = { 1 , 1 }
+    },
+    {
+        .smaller = std::numeric_limits<std::intmax_t>::lowest(),
+        .larger  = { 0, 0, 1 }
+    }
+#endif // if TASTY_INT_HAVE_INT128_ACCUMULATOR
+};
+
 INSTANTIATE_TEST_SUITE_P(
     IntegerComparisonTest,
     NonpositiveSignedIntegralSmallerThanDigitsTest,
-    ::testing::ValuesIn(
-        std::vector<NonpositiveSignedIntegralSmallerThanDigitsTestParam> {
-            { .smaller = 0, .larger = { 1 } },
-            {
-                .smaller = -1,
-                .larger  = { DIGIT_TYPE_MAX }
-            },
-            {
-                .smaller = -static_cast<std::intmax_t>(DIGIT_TYPE_MAX),
-                .larger  = { 0, 1 }
-            },
-            {
-                .smaller = -static_cast<std::intmax_t>(DIGIT_BASE),
-                .larger  = { 1 , 1 }
-            },
-            {
-                .smaller = std::numeric_limits<std::intmax_t>::lowest(),
-                .larger  = { 0, 0, 1 }
-            }
-        }
-    )
+    ::testing::ValuesIn(NONPOSITIVE_SIGNED_INTEGRAL_SMALLER_THAN_DIGITS_TEST_PARAMS)
 );
 
 
@@ -687,7 +775,7 @@ INSTANTIATE_TEST_SUITE_P(
 );
 
 using DigitsSmallerThanPositiveFloatingPointTestParam = InequalityTestParam<
-    std::vector<digit_type>, long double
+    SmallVector<digit_type>, long double
 >;
 
 class DigitsSmallerThanPositiveFloatingPointTest
@@ -732,7 +820,7 @@ INSTANTIATE_TEST_SUITE_P(
             { .smaller = { DIGIT_TYPE_MAX }, .larger = DIGIT_BASE },
             {
                 .smaller = { 0, 1 },
-                .larger  = DIGIT_BASE + 1.0L
+                .larger  = static_cast<long double>(DIGIT_BASE) * 2.0L
             },
             {
                 .smaller = { DIGIT_TYPE_MAX, 1 },
@@ -743,7 +831,7 @@ INSTANTIATE_TEST_SUITE_P(
 );
 
 using DigitsSmallerThanNegativeFloatingPointTestParam = InequalityTestParam<
-    std::vector<digit_type>, long double
+    SmallVector<digit_type>, long double
 >;
 
 class DigitsSmallerThanNegativeFloatingPointTest
@@ -794,7 +882,7 @@ INSTANTIATE_TEST_SUITE_P(
             },
             {
                 .smaller = { 0, 1 },
-                .larger  = -static_cast<long double>(DIGIT_BASE) - 1.0L
+                .larger  = -static_cast<long double>(DIGIT_BASE) * 2.0L
             },
             {
                 .smaller = { DIGIT_TYPE_MAX, DIGIT_TYPE_MAX },
@@ -805,7 +893,7 @@ INSTANTIATE_TEST_SUITE_P(
 );
 
 using NonnegativeFloatingPointSmallerThanDigitsTestParam = InequalityTestParam<
-    long double, std::vector<digit_type>
+    long double, SmallVector<digit_type>
 >;
 
 class NonnegativeFloatingPointSmallerThanDigitsTest
@@ -862,7 +950,7 @@ INSTANTIATE_TEST_SUITE_P(
 );
 
 using NonpositiveFloatingPointSmallerThanDigitsTestParam = InequalityTestParam<
-    long double, std::vector<digit_type> 
+    long double, SmallVector<digit_type> 
 >;
 
 class NonpositiveFloatingPointSmallerThanDigitsTest
@@ -921,4 +1009,33 @@ INSTANTIATE_TEST_SUITE_P(
     )
 );
 
+
+TEST(IntegerViewComparisonTest, CompareOrdersLikeOperators)
+{
+    std::vector<Integer> ascending = {
+        { .sign = Sign::NEGATIVE, .digits = { 0, 1 } },
+        { .sign = Sign::NEGATIVE, .digits = { DIGIT_TYPE_MAX } },
+        { .sign = Sign::NEGATIVE, .digits = { 1 } },
+        { .sign = Sign::ZERO,     .digits = { 0 } },
+        { .sign = Sign::POSITIVE, .digits = { 1 } },
+        { .sign = Sign::POSITIVE, .digits = { DIGIT_TYPE_MAX } },
+        { .sign = Sign::POSITIVE, .digits = { 0, 1 } },
+        { .sign = Sign::POSITIVE, .digits = { 1, 1 } }
+    };
+
+    for (std::size_t i = 0; i < ascending.size(); ++i)
+        for (std::size_t j = 0; j < ascending.size(); ++j)
+            EXPECT_EQ(i <=> j, compare(ascending[i], ascending[j]))
+                << "i=" << i << ", j=" << j;
+}
+
+TEST(IntegerViewComparisonTest, CompareBorrowedDigits)
+{
+    const digit_type digits[] = { 5, 7 };
+
+    EXPECT_EQ(std::strong_ordering::equal,
+              compare(IntegerView(Sign::POSITIVE, digits),
+                      Integer { .sign = Sign::POSITIVE, .digits = { 5, 7 } }));
+}
+
 } // namespace
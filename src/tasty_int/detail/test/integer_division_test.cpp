@@ -14,6 +14,7 @@ namespace {
 using tasty_int::detail::Integer;
 using tasty_int::detail::Sign;
 using tasty_int::detail::IntegerDivisionResult;
+using tasty_int::detail::IntegerDivisor;
 using tasty_int::detail::conversions::integer_from_string;
 using tasty_int_test::check_integer_result;
 
@@ -1121,4 +1122,54 @@ TEST(IntegerDivisionTest, SmallerNegativeFloatingPointAndLargerNegativeInteger)
     test_division(dividend, divisor, expected_result);
 }
 
+
+TEST(IntegerDivisorTest, ConsistentWithDivisionOperators)
+{
+    auto large_digits = integer_from_string(
+        "987654321098765432109876543210987654321098765432109876543210"
+        "987654321098765432109876543210987654321098765432109876543210"
+        "987654321098765432109876543210987654321098765432109876543210"
+        "987654321098765432109876543210987654321098765432109876543210"
+        "987654321098765432109876543210987654321098765432109876543210"
+        "987654321098765432109876543210987654321098765432109876543210"
+        "987654321098765432109876543210987654321098765432109876543210"
+        "987654321098765432109876543210987654321098765432109876543210"
+        "987654321098765432109876543210987654321098765432109876543210"
+        "987654321098765432109876543210987654321098765432109876543210"
+        "987654321098765432109876543210987654321098765432109876543210",
+        10
+    ).digits;
+    auto dividend_digits = large_digits;
+    dividend_digits.insert(dividend_digits.end(),
+                           large_digits.begin(), large_digits.end());
+
+    for (auto divisor_sign : { Sign::POSITIVE, Sign::NEGATIVE }) {
+        Integer divisor = { .sign = divisor_sign, .digits = large_digits };
+        divisor.digits.back() += 1;
+
+        IntegerDivisor integer_divisor(divisor);
+        EXPECT_EQ(divisor, integer_divisor.value());
+
+        for (auto dividend_sign : { Sign::POSITIVE, Sign::NEGATIVE }) {
+            for (const auto &digits : { large_digits, dividend_digits }) {
+                Integer dividend = { .sign = dividend_sign, .digits = digits };
+
+                auto expected_result = div(dividend, divisor);
+
+                EXPECT_EQ(expected_result.quotient,
+                          integer_divisor.divide(dividend));
+                EXPECT_EQ(expected_result.remainder,
+                          integer_divisor.reduce(dividend));
+
+                auto result = integer_divisor.div(dividend);
+                EXPECT_EQ(expected_result.quotient,  result.quotient);
+                EXPECT_EQ(expected_result.remainder, result.remainder);
+            }
+        }
+
+        EXPECT_EQ(ZERO_INTEGER, integer_divisor.divide(ZERO_INTEGER));
+        EXPECT_EQ(ZERO_INTEGER, integer_divisor.reduce(ZERO_INTEGER));
+    }
+}
+
 } // namespace
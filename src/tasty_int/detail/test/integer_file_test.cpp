@@ -0,0 +1,216 @@
+#include "tasty_int/detail/integer_file.hpp"
+
+#include <cstring>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tasty_int/detail/conversions/digits_from_integral.hpp"
+#include "tasty_int/detail/test/integer_test_common.hpp"
+
+
+namespace {
+
+using tasty_int::detail::INTEGER_FILE_HEADER_SIZE;
+using tasty_int::detail::Integer;
+using tasty_int::detail::IntegerView;
+using tasty_int::detail::MappedIntegerFile;
+using tasty_int::detail::Sign;
+using tasty_int::detail::SmallVector;
+using tasty_int::detail::digit_type;
+using tasty_int::detail::make_arbitrary_digits;
+using tasty_int::detail::write_integer_file;
+using tasty_int::detail::conversions::digits_from_integral;
+
+
+class IntegerFileTest : public ::testing::Test
+{
+protected:
+    IntegerFileTest()
+        : path(std::filesystem::temp_directory_path() / get_file_name())
+    {}
+
+    ~IntegerFileTest()
+    {
+        std::filesystem::remove(path);
+    }
+
+    static std::string
+    get_file_name()
+    {
+        std::string test_name =
+            ::testing::UnitTest::GetInstance()->current_test_info()->name();
+
+        // parameterized test names contain a '/'
+        std::replace(test_name.begin(), test_name.end(), '/', '_');
+
+        return "tasty_int_integer_file_test_" + test_name;
+    }
+
+    std::vector<char>
+    read_contents() const
+    {
+        std::ifstream file(path, std::ios_base::binary);
+
+        return std::vector<char>(std::istreambuf_iterator<char>(file),
+                                 std::istreambuf_iterator<char>());
+    }
+
+    void
+    write_contents(const std::vector<char> &contents) const
+    {
+        std::ofstream file(path, std::ios_base::binary);
+
+        file.write(contents.data(), contents.size());
+    }
+
+    const std::filesystem::path path;
+}; // class IntegerFileTest
+
+
+void
+expect_view_equals(const Integer &expected,
+                   IntegerView    actual)
+{
+    EXPECT_EQ(expected.sign, actual.sign);
+    EXPECT_EQ(std::vector<digit_type>(expected.digits.begin(),
+                                      expected.digits.end()),
+              std::vector<digit_type>(actual.digits.begin(),
+                                      actual.digits.end()));
+}
+
+TEST_F(IntegerFileTest, HeaderLayout)
+{
+    // magnitude bytes 0x01...0x08 then 0x2a, least significant first
+    Integer integer = {
+        .sign   = Sign::NEGATIVE,
+        .digits = digits_from_integral(0x0807060504030201)
+    };
+    integer.digits.push_back(0x2a);
+
+    write_integer_file(integer, path);
+
+    auto contents = read_contents();
+    ASSERT_EQ(INTEGER_FILE_HEADER_SIZE +
+              (integer.digits.size() * sizeof(digit_type)),
+              contents.size());
+    EXPECT_EQ(0, std::memcmp(contents.data(), "TASTYINT", 8));
+    EXPECT_EQ(1, contents[8]);
+    EXPECT_EQ(0, contents[9]);
+    EXPECT_EQ(-1, contents[12]);
+    EXPECT_EQ(sizeof(digit_type), static_cast<std::size_t>(contents[13]));
+    EXPECT_EQ(integer.digits.size(), static_cast<std::size_t>(contents[16]));
+    EXPECT_EQ(0, contents[17]);
+    EXPECT_EQ(0x01, contents[32]);
+    EXPECT_EQ(0x08, contents[39]);
+    EXPECT_EQ(0x2a, contents[40]);
+}
+
+TEST_F(IntegerFileTest, RoundTripZero)
+{
+    Integer zero = {
+        .sign   = Sign::ZERO,
+        .digits = SmallVector<digit_type>{ 0 }
+    };
+
+    write_integer_file(zero, path);
+    MappedIntegerFile mapped_file(path);
+
+    expect_view_equals(zero, mapped_file.view());
+}
+
+TEST_F(IntegerFileTest, RoundTripManyDigits)
+{
+    Integer integer = {
+        .sign   = Sign::POSITIVE,
+        .digits = make_arbitrary_digits(1000, 0)
+    };
+
+    write_integer_file(integer, path);
+    MappedIntegerFile mapped_file(path);
+
+    expect_view_equals(integer, mapped_file.view());
+}
+
+TEST_F(IntegerFileTest, MoveTransfersMapping)
+{
+    Integer integer = {
+        .sign   = Sign::NEGATIVE,
+        .digits = SmallVector<digit_type>{ 7, 8, 9 }
+    };
+
+    write_integer_file(integer, path);
+    MappedIntegerFile mapped_file(path);
+    MappedIntegerFile moved_file(std::move(mapped_file));
+
+    expect_view_equals(integer, moved_file.view());
+
+    mapped_file = std::move(moved_file);
+
+    expect_view_equals(integer, mapped_file.view());
+}
+
+TEST_F(IntegerFileTest, MissingFileThrowsSystemError)
+{
+    EXPECT_THROW(MappedIntegerFile(path / "missing"), std::system_error);
+}
+
+TEST_F(IntegerFileTest, TruncatedHeaderThrowsInvalidArgument)
+{
+    write_contents(std::vector<char>(INTEGER_FILE_HEADER_SIZE - 1));
+
+    EXPECT_THROW(MappedIntegerFile file(path), std::invalid_argument);
+}
+
+class IntegerFileCorruptionTest
+    : public IntegerFileTest
+    , public ::testing::WithParamInterface<std::pair<std::size_t, char>>
+{}; // class IntegerFileCorruptionTest
+
+TEST_P(IntegerFileCorruptionTest, CorruptFileThrowsInvalidArgument)
+{
+    auto [offset, value] = GetParam();
+    Integer integer = {
+        .sign   = Sign::POSITIVE,
+        .digits = SmallVector<digit_type>{ 1, 2 }
+    };
+    write_integer_file(integer, path);
+    auto contents = read_contents();
+
+    contents[offset] = value;
+    write_contents(contents);
+
+    EXPECT_THROW(MappedIntegerFile file(path), std::invalid_argument);
+}
+
+constexpr char WRONG_LIMB_WIDTH = 2 * sizeof(digit_type);
+
+// the second of the two limbs written by CorruptFileThrowsInvalidArgument
+constexpr std::size_t TOP_LIMB_OFFSET = INTEGER_FILE_HEADER_SIZE
+                                      + sizeof(digit_type);
+
+INSTANTIATE_TEST_SUITE_P(
+    IntegerFileTest,
+    IntegerFileCorruptionTest,
+    ::testing::Values(
+        std::make_pair(0,  'X'),              // magic
+        std::make_pair(8,  2),                // version
+        std::make_pair(12, 2),                // sign out of range
+        std::make_pair(12, 0),                // zero sign with nonzero limbs
+        std::make_pair(13, WRONG_LIMB_WIDTH), // limb width
+        std::make_pair(16, 3),                // limb count exceeds file size
+        std::make_pair(16, 0),                // no limbs
+        std::make_pair(TOP_LIMB_OFFSET, 0)    // most significant limb is zero
+    )
+);
+
+} // namespace
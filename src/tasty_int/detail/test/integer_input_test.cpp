@@ -2,15 +2,24 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
+#include <streambuf>
+#include <string>
+#include <string_view>
 
+#include "tasty_int/detail/conversions/integer_from_signed_integral.hpp"
 #include "tasty_int/detail/test/integer_test_common.hpp"
 
 
 namespace {
 
+using tasty_int::detail::DIGIT_TYPE_BITS;
+using tasty_int::detail::DIGIT_TYPE_MAX;
 using tasty_int::detail::Integer;
+using tasty_int::detail::Sign;
+using tasty_int::detail::conversions::integer_from_signed_integral;
 
 
 TEST(IntegerInputTest, InputReturnsReferenceToSelf)
@@ -179,4 +188,221 @@ TEST(IntegerInputTest, NegativeOct)
     EXPECT_EQ(std::intmax_t(-0777), integer);
 }
 
+TEST(IntegerInputTest, ConsecutiveWordsAreExtractedInTurn)
+{
+    std::istringstream input("  -12\t0x1f\n 017 0");
+    input.unsetf(std::ios_base::dec);
+    Integer first, second, third, fourth;
+
+    input >> first >> second >> third >> fourth;
+
+    EXPECT_FALSE(input.fail());
+    EXPECT_TRUE(input.eof());
+    EXPECT_EQ(std::intmax_t(-12),  first);
+    EXPECT_EQ(std::intmax_t(0x1f), second);
+    EXPECT_EQ(std::intmax_t(017),  third);
+    EXPECT_EQ(std::intmax_t(0),    fourth);
+}
+
+TEST(IntegerInputTest, InvalidWordIsConsumedAndValueIsUnmodified)
+{
+    std::istringstream input("12x4 56");
+    Integer integer = integer_from_signed_integral(7);
+
+    input >> integer;
+
+    EXPECT_TRUE(input.fail());
+    EXPECT_EQ(std::intmax_t(7), integer);
+
+    input.clear();
+    input >> integer;
+
+    EXPECT_FALSE(input.fail());
+    EXPECT_EQ(std::intmax_t(56), integer);
+}
+
+TEST(IntegerInputTest, PrefixWithoutTokensSetsFailbit)
+{
+    std::istringstream input("-0x");
+    input.unsetf(std::ios_base::dec);
+    Integer integer;
+
+    input >> integer;
+
+    EXPECT_TRUE(input.fail());
+}
+
+TEST(IntegerInputTest, EmptyInputSetsFailbitAndEofbit)
+{
+    std::istringstream input("   ");
+    Integer integer;
+
+    input >> integer;
+
+    EXPECT_TRUE(input.fail());
+    EXPECT_TRUE(input.eof());
+}
+
+TEST(IntegerInputTest, WidthLimitsExtractedCharacters)
+{
+    std::istringstream input("123456");
+    Integer integer;
+
+    input >> std::setw(4) >> integer;
+
+    EXPECT_EQ(std::intmax_t(1234), integer);
+    EXPECT_EQ(0, input.width());
+
+    input >> integer;
+
+    EXPECT_EQ(std::intmax_t(56), integer);
+}
+
+TEST(IntegerInputTest, LargeHexValue)
+{
+    std::string tokens(100000, 'f');
+    std::istringstream input("-" + tokens);
+    Integer integer;
+
+    input >> std::hex >> integer;
+
+    EXPECT_FALSE(input.fail());
+    EXPECT_EQ(Sign::NEGATIVE, integer.sign);
+    EXPECT_EQ(tokens.size() * 4 / DIGIT_TYPE_BITS, integer.digits.size());
+    for (auto digit : integer.digits)
+        EXPECT_EQ(DIGIT_TYPE_MAX, digit);
+}
+
+/**
+ * A streambuf that presents its source a few characters at a time through a
+ * single, reused get area, or with no get area at all if its capacity is
+ * zero.
+ */
+class SmallBufferStreambuf : public std::streambuf
+{
+public:
+    SmallBufferStreambuf(std::string_view input,
+                         std::size_t      buffer_capacity)
+        : source(input)
+        , capacity(buffer_capacity)
+    {}
+
+protected:
+    int_type
+    underflow() override
+    {
+        if (source.empty())
+            return traits_type::eof();
+
+        if (capacity == 0)
+            return traits_type::to_int_type(source.front());
+
+        auto count = std::min(capacity, source.size());
+        source.copy(buffer, count);
+        source.remove_prefix(count);
+        setg(buffer, buffer, buffer + count);
+
+        return traits_type::to_int_type(buffer[0]);
+    }
+
+    int_type
+    uflow() override
+    {
+        if (capacity > 0)
+            return std::streambuf::uflow();
+
+        if (source.empty())
+            return traits_type::eof();
+
+        char next = source.front();
+        source.remove_prefix(1);
+
+        return traits_type::to_int_type(next);
+    }
+
+private:
+    std::string_view source;
+    std::size_t      capacity;
+    char             buffer[4];
+}; // class SmallBufferStreambuf
+
+class SmallBufferInputTest : public ::testing::TestWithParam<std::size_t>
+{}; // class SmallBufferInputTest
+
+TEST_P(SmallBufferInputTest, WordsSpanningGetAreasAreExtracted)
+{
+    SmallBufferStreambuf streambuf("-0x1234567890abcdef 0b1 987654321",
+                                   GetParam());
+    std::istream input(&streambuf);
+    input.unsetf(std::ios_base::dec);
+    Integer first, second, third;
+
+    input >> first >> second >> third;
+
+    EXPECT_FALSE(input.fail());
+    EXPECT_EQ(std::intmax_t(-0x1234567890abcdef), first);
+    EXPECT_EQ(std::intmax_t(1),                   second);
+    EXPECT_EQ(std::intmax_t(987654321),           third);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    IntegerInputTest,
+    SmallBufferInputTest,
+    ::testing::Values(0, 1, 3, 4)
+);
+
+/**
+ * A streambuf that caps its first chunk at a single character, handed out
+ * without a get area, then presents the rest of its source in one get area.
+ * The word therefore continues in a further chunk while the get area still
+ * holds characters.
+ */
+class CappedFirstChunkStreambuf : public std::streambuf
+{
+public:
+    CappedFirstChunkStreambuf(std::string_view input)
+        : source(input)
+    {}
+
+protected:
+    int_type
+    underflow() override
+    {
+        return source.empty() ? traits_type::eof()
+                              : traits_type::to_int_type(source.front());
+    }
+
+    int_type
+    uflow() override
+    {
+        if (source.empty())
+            return traits_type::eof();
+
+        buffer.assign(source.substr(1));
+        setg(buffer.data(), buffer.data(), buffer.data() + buffer.size());
+
+        char next = source.front();
+        source = std::string_view();
+
+        return traits_type::to_int_type(next);
+    }
+
+private:
+    std::string_view source;
+    std::string      buffer;
+}; // class CappedFirstChunkStreambuf
+
+TEST(IntegerInputTest, WordContinuingPastCappedChunkIsExtracted)
+{
+    CappedFirstChunkStreambuf streambuf("123456789012345678 42");
+    std::istream input(&streambuf);
+    Integer first, second;
+
+    input >> first >> second;
+
+    EXPECT_FALSE(input.fail());
+    EXPECT_EQ(std::intmax_t(123456789012345678), first);
+    EXPECT_EQ(std::intmax_t(42), second);
+}
+
 } // namespace
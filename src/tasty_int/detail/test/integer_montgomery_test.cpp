@@ -0,0 +1,74 @@
+#include "tasty_int/detail/integer_montgomery.hpp"
+
+#include "gtest/gtest.h"
+
+#include "tasty_int/detail/conversions/integer_from_string.hpp"
+#include "tasty_int/detail/test/integer_test_common.hpp"
+
+
+namespace {
+
+using tasty_int::detail::Integer;
+using tasty_int::detail::IntegerMontgomeryContext;
+using tasty_int::detail::Sign;
+using tasty_int::detail::conversions::integer_from_string;
+
+
+const Integer MODULUS = integer_from_string("1000000007", 10);
+
+TEST(IntegerMontgomeryContextTest, ValueRoundTrips)
+{
+    EXPECT_EQ(MODULUS, IntegerMontgomeryContext(MODULUS).value());
+}
+
+TEST(IntegerMontgomeryContextTest, NegativeValuesReducedToLeastResidue)
+{
+    IntegerMontgomeryContext context(MODULUS);
+
+    auto montgomery_form = context.to_montgomery(
+        integer_from_string("-1000000008", 10)
+    );
+
+    EXPECT_EQ(integer_from_string("1000000006", 10),
+              context.from_montgomery(montgomery_form));
+}
+
+TEST(IntegerMontgomeryContextTest, ZeroResiduesAreZero)
+{
+    IntegerMontgomeryContext context(MODULUS);
+    Integer zero = { .sign = Sign::ZERO, .digits = { 0 } };
+
+    EXPECT_EQ(zero, context.to_montgomery(MODULUS));
+    EXPECT_EQ(zero, context.to_montgomery({ .sign   = Sign::NEGATIVE,
+                                            .digits = MODULUS.digits }));
+    EXPECT_EQ(zero, context.pow_mod(zero, MODULUS));
+}
+
+TEST(IntegerMontgomeryContextTest, MultiplyAndSquare)
+{
+    IntegerMontgomeryContext context(MODULUS);
+
+    auto lhs = context.to_montgomery(integer_from_string("123456789", 10));
+    auto rhs = context.to_montgomery(integer_from_string("-987654321", 10));
+
+    // 123456789 * -987654321 mod 1000000007
+    EXPECT_EQ(integer_from_string("740893148", 10),
+              context.from_montgomery(context.multiply(lhs, rhs)));
+    // 123456789^2 mod 1000000007
+    EXPECT_EQ(integer_from_string("643499475", 10),
+              context.from_montgomery(context.square(lhs)));
+}
+
+TEST(IntegerMontgomeryContextTest, PowModOfNegativeBase)
+{
+    IntegerMontgomeryContext context(MODULUS);
+
+    auto minus_two = integer_from_string("-2", 10);
+
+    EXPECT_EQ(integer_from_string("999999999", 10),
+              context.pow_mod(minus_two, integer_from_string("3", 10)));
+    EXPECT_EQ(integer_from_string("16", 10),
+              context.pow_mod(minus_two, integer_from_string("4", 10)));
+}
+
+} // namespace
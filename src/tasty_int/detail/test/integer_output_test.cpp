@@ -6,12 +6,17 @@
 #include <sstream>
 
 #include "tasty_int/detail/conversions/integer_from_signed_integral.hpp"
+#include "tasty_int/detail/conversions/string_from_integer.hpp"
 
 
 namespace {
 
 using tasty_int::detail::Integer;
+using tasty_int::detail::Sign;
+using tasty_int::detail::SmallVector;
+using tasty_int::detail::digit_type;
 using tasty_int::detail::conversions::integer_from_signed_integral;
+using tasty_int::detail::conversions::string_from_integer;
 
 
 TEST(IntegerOutputTest, OutputReturnsReferenceToSelf)
@@ -277,4 +282,36 @@ TEST(IntegerOutputTest, NegativeOctShowbaseShowpos)
     EXPECT_EQ("-0777", output.str());
 }
 
+class LargeIntegerOutputTest
+    : public ::testing::TestWithParam<std::ios_base::fmtflags>
+{}; // class LargeIntegerOutputTest
+
+TEST_P(LargeIntegerOutputTest, StreamedOutputMatchesStringFromInteger)
+{
+    std::ios_base::fmtflags basefield = GetParam();
+    unsigned int base = (basefield == std::ios_base::hex) ? 16
+                      : (basefield == std::ios_base::oct) ?  8
+                      :                                     10;
+
+    Integer integer = { .sign = Sign::NEGATIVE, .digits = {} };
+    digit_type state = 1;
+    for (unsigned int i = 0; i < 1000; ++i) {
+        state = (state * 6364136223846793005U) + 1442695040888963407U;
+        integer.digits.push_back(state);
+    }
+
+    std::ostringstream output;
+    output.setf(basefield, std::ios_base::basefield);
+    output << integer;
+
+    EXPECT_EQ(string_from_integer(integer, base), output.str());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    IntegerOutputTest,
+    LargeIntegerOutputTest,
+    ::testing::Values(std::ios_base::dec, std::ios_base::hex,
+                      std::ios_base::oct)
+);
+
 } // namespace
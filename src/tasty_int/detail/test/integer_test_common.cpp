@@ -1,5 +1,7 @@
 #include "tasty_int/detail/test/integer_test_common.hpp"
 
+#include <cassert>
+
 #include <ostream>
 
 #include "tasty_int/detail/integer.hpp"
@@ -10,7 +12,7 @@ namespace tasty_int {
 namespace detail {
 namespace {
 void
-PrintTo(const std::vector<digit_type> &digits,
+PrintTo(const SmallVector<digit_type> &digits,
         std::ostream                  *output)
 {
     const char *separator = "{ ";
@@ -36,5 +38,29 @@ PrintTo(const Integer &integer,
     *output << " }";
 }
 
+SmallVector<digit_type>
+make_arbitrary_digits(SmallVector<digit_type>::size_type size,
+                      std::uint64_t                      seed)
+{
+    assert(size > 0);
+
+    SmallVector<digit_type> digits(size);
+
+    std::uint64_t state = seed;
+    for (auto &digit : digits) {
+        state += 0x9E3779B97F4A7C15;
+
+        std::uint64_t mixed = state;
+        mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9;
+        mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EB;
+        mixed ^= mixed >> 31;
+
+        digit = static_cast<digit_type>(mixed & DIGIT_TYPE_MAX);
+    }
+    digits.back() |= 1;
+
+    return digits;
+}
+
 } // namespace detail
 } // namespace tasty_int
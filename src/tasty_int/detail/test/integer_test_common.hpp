@@ -1,9 +1,13 @@
 #ifndef TASTY_INT_TASTY_INT_DETAIL_TEST_INTEGER_TEST_COMMON_HPP
 #define TASTY_INT_TASTY_INT_DETAIL_TEST_INTEGER_TEST_COMMON_HPP
 
+#include <cstdint>
+
 #include <iosfwd>
 
 #include "tasty_int/detail/integer_comparison.hpp"
+#include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 
 
 namespace tasty_int {
@@ -25,6 +29,24 @@ void
 PrintTo(const Integer &integer,
         std::ostream  *output);
 
+/**
+ * @brief Generates an arbitrary sequence of digits for tests that need large
+ *     operands without caring about their values.
+ *
+ * @details Digits are drawn from the SplitMix64 generator, so any @p seed,
+ *     including small or zero seeds, yields well-mixed digits, and the same
+ *     @p seed always yields the same digits regardless of DIGIT_TYPE_BITS.
+ *
+ * @param[in] size the number of digits
+ * @param[in] seed the generator seed
+ * @return @p size digits with no leading zeros
+ *
+ * @pre `size > 0`
+ */
+SmallVector<digit_type>
+make_arbitrary_digits(SmallVector<digit_type>::size_type size,
+                      std::uint64_t                      seed);
+
 } // namespace detail
 } // namespace tasty_int
 
@@ -14,6 +14,7 @@ using tasty_int::detail::IntegralDigitsView;
 using tasty_int::detail::digit_from_nonnegative_value;
 using tasty_int::detail::DIGIT_TYPE_MAX;
 using tasty_int::detail::DIGIT_TYPE_BITS;
+using tasty_int::detail::digit_accumulator_type;
 
 
 class IntegralDigitsViewTest : public ::testing::TestWithParam<std::uintmax_t>
@@ -43,20 +44,23 @@ TEST_P(IntegralDigitsViewTest, HighDigit)
 
     IntegralDigitsView view(value);
 
-    EXPECT_EQ(digit_from_nonnegative_value(value >> DIGIT_TYPE_BITS),
+    EXPECT_EQ(digit_from_nonnegative_value(
+                  digit_accumulator_type(value) >> DIGIT_TYPE_BITS
+              ),
               view.high_digit());
 }
 
 TEST_P(IntegralDigitsViewTest, MostSignficantDigit)
 {
     std::uintmax_t value = GetParam();
-    auto expected_digit = value;
+    auto expected_digit = digit_accumulator_type(value);
     if (expected_digit > DIGIT_TYPE_MAX)
         expected_digit >>= DIGIT_TYPE_BITS;
 
     IntegralDigitsView view(value);
 
-    EXPECT_EQ(expected_digit, view.most_significant_digit());
+    EXPECT_EQ(digit_from_nonnegative_value(expected_digit),
+              view.most_significant_digit());
 }
 
 TEST_P(IntegralDigitsViewTest, DigitsSize)
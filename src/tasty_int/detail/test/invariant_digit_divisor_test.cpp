@@ -0,0 +1,96 @@
+#include "tasty_int/detail/invariant_digit_divisor.hpp"
+
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using tasty_int::detail::InvariantDigitDivisor;
+using tasty_int::detail::digit_type;
+using tasty_int::detail::digit_accumulator_type;
+using tasty_int::detail::DIGIT_TYPE_BITS;
+
+
+constexpr auto DIGIT_TYPE_MAX =
+    static_cast<digit_type>(tasty_int::detail::DIGIT_TYPE_MAX);
+
+
+void
+expect_consistent_with_hardware_division(
+    const InvariantDigitDivisor &divisor,
+    digit_type                   high,
+    digit_type                   low
+)
+{
+    digit_accumulator_type dividend = high;
+    dividend <<= DIGIT_TYPE_BITS;
+    dividend  |= low;
+
+    auto result = divisor.divide(high, low);
+
+    EXPECT_EQ(dividend / divisor.value(), result.quotient)
+        << "high = " << high << ", low = " << low;
+    EXPECT_EQ(dividend % divisor.value(), result.remainder)
+        << "high = " << high << ", low = " << low;
+}
+
+
+class InvariantDigitDivisorTest : public ::testing::TestWithParam<digit_type>
+{}; // class InvariantDigitDivisorTest
+
+TEST_P(InvariantDigitDivisorTest, ValueRoundTrips)
+{
+    EXPECT_EQ(GetParam(), InvariantDigitDivisor(GetParam()).value());
+}
+
+TEST_P(InvariantDigitDivisorTest, RestoredDivisorDividesAlike)
+{
+    InvariantDigitDivisor prepared(GetParam());
+    InvariantDigitDivisor restored(GetParam(),
+                                   prepared.normalized_reciprocal());
+
+    EXPECT_EQ(GetParam(), restored.value());
+    expect_consistent_with_hardware_division(restored, GetParam() - 1,
+                                             DIGIT_TYPE_MAX);
+}
+
+TEST_P(InvariantDigitDivisorTest, SingleDigitDividends)
+{
+    InvariantDigitDivisor divisor(GetParam());
+
+    for (digit_type low : { digit_type(0), digit_type(1), GetParam() - 1,
+                            GetParam(), DIGIT_TYPE_MAX - 1, DIGIT_TYPE_MAX })
+        expect_consistent_with_hardware_division(divisor, 0, low);
+}
+
+TEST_P(InvariantDigitDivisorTest, TwoDigitDividends)
+{
+    InvariantDigitDivisor divisor(GetParam());
+
+    digit_type max_high = GetParam() - 1;
+
+    for (digit_type high : { digit_type(0), max_high / 2, max_high })
+        for (digit_type low : { digit_type(0), digit_type(1),
+                                DIGIT_TYPE_MAX / 3, DIGIT_TYPE_MAX })
+            expect_consistent_with_hardware_division(divisor, high, low);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    InvariantDigitDivisorTest,
+    InvariantDigitDivisorTest,
+    ::testing::Values(
+        1,
+        2,
+        3,
+        7,
+        10,
+        1000000007,
+        digit_type(1) << (DIGIT_TYPE_BITS - 1),
+        (digit_type(1) << (DIGIT_TYPE_BITS - 1)) + 1,
+        DIGIT_TYPE_MAX / 10,
+        DIGIT_TYPE_MAX - 1,
+        DIGIT_TYPE_MAX
+    )
+);
+
+} // namespace
@@ -0,0 +1,147 @@
+#include "tasty_int/detail/number_theoretic_transform.hpp"
+
+#include <cstdint>
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using tasty_int::detail::convolve_residues;
+using tasty_int::detail::number_theoretic_transform_multiply_words;
+using tasty_int::detail::NumberTheoreticTransformPrime;
+using tasty_int::detail::NUMBER_THEORETIC_TRANSFORM_PRIMES;
+
+
+std::vector<std::uint32_t>
+make_arbitrary_words(std::size_t   size,
+                     std::uint64_t seed)
+{
+    std::vector<std::uint32_t> words(size);
+
+    std::uint64_t state = seed;
+    for (auto &word : words) {
+        state = (state * 6364136223846793005U) + 1442695040888963407U;
+        word  = static_cast<std::uint32_t>(state >> 32);
+    }
+
+    return words;
+}
+
+std::vector<std::uint32_t>
+long_multiply_words(const std::vector<std::uint32_t> &lhs,
+                    const std::vector<std::uint32_t> &rhs)
+{
+    std::vector<std::uint32_t> result(lhs.size() + rhs.size());
+
+    for (std::size_t rhs_index = 0; rhs_index < rhs.size(); ++rhs_index) {
+        std::uint64_t carry = 0;
+        for (std::size_t lhs_index = 0; lhs_index < lhs.size(); ++lhs_index) {
+            auto &result_word = result[lhs_index + rhs_index];
+
+            carry += std::uint64_t(lhs[lhs_index]) * rhs[rhs_index];
+            carry += result_word;
+
+            result_word   = static_cast<std::uint32_t>(carry);
+            carry       >>= 32;
+        }
+        result[lhs.size() + rhs_index] = static_cast<std::uint32_t>(carry);
+    }
+
+    return result;
+}
+
+
+class ConvolveResiduesTest
+    : public ::testing::TestWithParam<NumberTheoreticTransformPrime>
+{}; // class ConvolveResiduesTest
+
+TEST_P(ConvolveResiduesTest, ConvolutionOfSmallValuesIsExact)
+{
+    std::vector<std::uint32_t> lhs = { 1, 2, 3 };
+    std::vector<std::uint32_t> rhs = { 4, 5 };
+    std::vector<std::uint32_t> expected_result = { 4, 13, 22, 15 };
+
+    auto result = convolve_residues(GetParam(), lhs, rhs, 4);
+
+    EXPECT_EQ(expected_result, result);
+}
+
+TEST_P(ConvolveResiduesTest, ConvolutionWrapsAroundTransformSize)
+{
+    std::vector<std::uint32_t> lhs = { 0, 0, 0, 1 };
+    std::vector<std::uint32_t> rhs = { 0, 2 };
+    std::vector<std::uint32_t> expected_result = { 2, 0, 0, 0 };
+
+    auto result = convolve_residues(GetParam(), lhs, rhs, 4);
+
+    EXPECT_EQ(expected_result, result);
+}
+
+TEST_P(ConvolveResiduesTest, ResiduesAreReducedByModulus)
+{
+    auto modulus = GetParam().modulus;
+    std::vector<std::uint32_t> lhs = { modulus + 3 };
+    std::vector<std::uint32_t> rhs = { modulus - 1 };
+    std::vector<std::uint32_t> expected_result = { modulus - 3 };
+
+    auto result = convolve_residues(GetParam(), lhs, rhs, 1);
+
+    EXPECT_EQ(expected_result, result);
+}
+
+TEST_P(ConvolveResiduesTest, SquaredConvolutionEqualsProductConvolution)
+{
+    auto values = make_arbitrary_words(300, 1);
+    auto copy   = values;
+
+    EXPECT_EQ(convolve_residues(GetParam(), values, copy,   1024),
+              convolve_residues(GetParam(), values, values, 1024));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    NumberTheoreticTransformTest,
+    ConvolveResiduesTest,
+    ::testing::ValuesIn(NUMBER_THEORETIC_TRANSFORM_PRIMES)
+);
+
+
+TEST(NumberTheoreticTransformMultiplyWordsTest, SingleWordTimesSingleWord)
+{
+    std::vector<std::uint32_t> lhs = { UINT32_MAX };
+    std::vector<std::uint32_t> rhs = { UINT32_MAX };
+    std::vector<std::uint32_t> expected_result = { 1, UINT32_MAX - 1 };
+
+    EXPECT_EQ(expected_result,
+              number_theoretic_transform_multiply_words(lhs, rhs));
+}
+
+TEST(NumberTheoreticTransformMultiplyWordsTest, MaxWordsTimesMaxWords)
+{
+    std::vector<std::uint32_t> lhs(1000, UINT32_MAX);
+    std::vector<std::uint32_t> rhs(777,  UINT32_MAX);
+
+    EXPECT_EQ(long_multiply_words(lhs, rhs),
+              number_theoretic_transform_multiply_words(lhs, rhs));
+}
+
+TEST(NumberTheoreticTransformMultiplyWordsTest, ArbitraryWordsTimesArbitraryWords)
+{
+    auto lhs = make_arbitrary_words(1234, 2);
+    auto rhs = make_arbitrary_words(3210, 3);
+
+    EXPECT_EQ(long_multiply_words(lhs, rhs),
+              number_theoretic_transform_multiply_words(lhs, rhs));
+}
+
+TEST(NumberTheoreticTransformMultiplyWordsTest, ArbitraryWordsSquared)
+{
+    auto words = make_arbitrary_words(2048, 4);
+
+    EXPECT_EQ(long_multiply_words(words, words),
+              number_theoretic_transform_multiply_words(words, words));
+}
+
+} // namespace
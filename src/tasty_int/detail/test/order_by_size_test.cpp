@@ -6,13 +6,14 @@
 namespace {
 
 using tasty_int::detail::order_by_size;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 
 
 TEST(OrderBySizeTest, SmallerLhsAndLargerRhs)
 {
-    std::vector<digit_type> lhs = { 0 };
-    std::vector<digit_type> rhs = { 0, 1 };
+    SmallVector<digit_type> lhs = { 0 };
+    SmallVector<digit_type> rhs = { 0, 1 };
 
     auto &&[smaller, larger] = order_by_size(lhs, rhs);
 
@@ -22,8 +23,8 @@ TEST(OrderBySizeTest, SmallerLhsAndLargerRhs)
 
 TEST(OrderBySizeTest, LargerLhsAndSmallerRhs)
 {
-    std::vector<digit_type> lhs = { 0, 1 };
-    std::vector<digit_type> rhs = { 0 };
+    SmallVector<digit_type> lhs = { 0, 1 };
+    SmallVector<digit_type> rhs = { 0 };
 
     auto &&[smaller, larger] = order_by_size(lhs, rhs);
 
@@ -9,6 +9,7 @@ namespace {
 
 using tasty_int::detail::sign_from_digits;
 using tasty_int::detail::Sign;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 using tasty_int::detail::DIGIT_TYPE_MAX;
 
@@ -23,7 +24,7 @@ class SignFromZeroDigitsTest : public ::testing::TestWithParam<Sign>
 
 TEST_P(SignFromZeroDigitsTest, ReturnsZeroIfDigitsAreZero)
 {
-    std::vector<digit_type> ZERO = { 0 };
+    SmallVector<digit_type> ZERO = { 0 };
     Sign tentative_sign = GetParam();
 
     EXPECT_EQ(Sign::ZERO, sign_from_digits(ZERO, tentative_sign));
@@ -37,13 +38,13 @@ INSTANTIATE_TEST_SUITE_P(
 
 
 class SignFromNonzeroDigitsTest
-    : public ::testing::TestWithParam<std::tuple<Sign, std::vector<digit_type>>>
+    : public ::testing::TestWithParam<std::tuple<Sign, SmallVector<digit_type>>>
 {}; //  class SignFromNonzeroDigitsTest
 
 TEST_P(SignFromNonzeroDigitsTest, ReturnsTentativeSignIfDigitsAreNonzero)
 {
     Sign                           tentative_sign = std::get<0>(GetParam());
-    const std::vector<digit_type>& nonzero_digits = std::get<1>(GetParam());
+    const SmallVector<digit_type>& nonzero_digits = std::get<1>(GetParam());
 
     EXPECT_EQ(tentative_sign, sign_from_digits(nonzero_digits, tentative_sign));
 }
@@ -54,7 +55,7 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Combine(
         POSSIBLE_SIGNS,
         ::testing::ValuesIn(
-            std::vector<std::vector<digit_type>> {
+            std::vector<SmallVector<digit_type>> {
                 { 1 },
                 { 2 },
                 { DIGIT_TYPE_MAX },
@@ -0,0 +1,175 @@
+#include "tasty_int/detail/small_vector.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using tasty_int::detail::SmallVector;
+
+typedef SmallVector<int, 2> IntSmallVector;
+
+
+TEST(SmallVectorTest, DefaultConstructedIsEmptyAndInline)
+{
+    IntSmallVector values;
+
+    EXPECT_TRUE(values.empty());
+    EXPECT_EQ(0, values.size());
+    EXPECT_EQ(2, values.capacity());
+    EXPECT_TRUE(values.is_inline());
+}
+
+TEST(SmallVectorTest, ValuesWithinInlineCapacityAreStoredInline)
+{
+    IntSmallVector values = { 1, 2 };
+
+    EXPECT_TRUE(values.is_inline());
+    EXPECT_EQ((IntSmallVector { 1, 2 }), values);
+}
+
+TEST(SmallVectorTest, ValuesBeyondInlineCapacitySpillToHeap)
+{
+    IntSmallVector values = { 1, 2 };
+
+    values.push_back(3);
+
+    EXPECT_FALSE(values.is_inline());
+    EXPECT_LE(3, values.capacity());
+    EXPECT_EQ((IntSmallVector { 1, 2, 3 }), values);
+}
+
+TEST(SmallVectorTest, SizeConstructorValueInitializes)
+{
+    IntSmallVector values(4);
+
+    EXPECT_EQ((IntSmallVector { 0, 0, 0, 0 }), values);
+}
+
+TEST(SmallVectorTest, CopyOfHeapValuesIsDeep)
+{
+    IntSmallVector original = { 1, 2, 3 };
+
+    IntSmallVector copy = original;
+    copy.front() = 4;
+
+    EXPECT_NE(original.data(), copy.data());
+    EXPECT_EQ((IntSmallVector { 1, 2, 3 }), original);
+    EXPECT_EQ((IntSmallVector { 4, 2, 3 }), copy);
+}
+
+TEST(SmallVectorTest, MoveOfHeapValuesStealsStorage)
+{
+    IntSmallVector original = { 1, 2, 3 };
+    const int *original_data = original.data();
+
+    IntSmallVector moved = std::move(original);
+
+    EXPECT_EQ(original_data, moved.data());
+    EXPECT_EQ((IntSmallVector { 1, 2, 3 }), moved);
+    EXPECT_TRUE(original.empty());
+    EXPECT_TRUE(original.is_inline());
+}
+
+TEST(SmallVectorTest, MoveOfInlineValuesRemainsInline)
+{
+    IntSmallVector original = { 1, 2 };
+
+    IntSmallVector moved;
+    moved = std::move(original);
+
+    EXPECT_TRUE(moved.is_inline());
+    EXPECT_EQ((IntSmallVector { 1, 2 }), moved);
+    EXPECT_TRUE(original.empty());
+}
+
+TEST(SmallVectorTest, MoveAssignmentReleasesHeapStorage)
+{
+    IntSmallVector values = { 1, 2, 3 };
+
+    values = IntSmallVector { 4 };
+
+    EXPECT_TRUE(values.is_inline());
+    EXPECT_EQ((IntSmallVector { 4 }), values);
+}
+
+TEST(SmallVectorTest, InsertRangeInMiddle)
+{
+    IntSmallVector values = { 1, 4 };
+    IntSmallVector middle = { 2, 3 };
+
+    auto inserted = values.insert(values.begin() + 1,
+                                  middle.begin(), middle.end());
+
+    EXPECT_EQ(values.begin() + 1, inserted);
+    EXPECT_EQ((IntSmallVector { 1, 2, 3, 4 }), values);
+}
+
+TEST(SmallVectorTest, InsertCopiesAtEnd)
+{
+    IntSmallVector values = { 1 };
+
+    values.insert(values.end(), 3, 7);
+
+    EXPECT_EQ((IntSmallVector { 1, 7, 7, 7 }), values);
+}
+
+TEST(SmallVectorTest, EraseRange)
+{
+    IntSmallVector values = { 1, 2, 3, 4, 5 };
+
+    auto following = values.erase(values.begin() + 1, values.begin() + 3);
+
+    EXPECT_EQ(4, *following);
+    EXPECT_EQ((IntSmallVector { 1, 4, 5 }), values);
+}
+
+TEST(SmallVectorTest, ResizeFillsNewValues)
+{
+    IntSmallVector values = { 1 };
+
+    values.resize(3, 9);
+    EXPECT_EQ((IntSmallVector { 1, 9, 9 }), values);
+
+    values.resize(1);
+    EXPECT_EQ((IntSmallVector { 1 }), values);
+}
+
+TEST(SmallVectorTest, AssignReplacesValues)
+{
+    IntSmallVector values = { 1, 2, 3 };
+
+    values.assign(2, 5);
+
+    EXPECT_EQ((IntSmallVector { 5, 5 }), values);
+}
+
+TEST(SmallVectorTest, SwapInlineAndHeapValues)
+{
+    IntSmallVector inline_values = { 1 };
+    IntSmallVector heap_values   = { 2, 3, 4 };
+
+    swap(inline_values, heap_values);
+
+    EXPECT_EQ((IntSmallVector { 2, 3, 4 }), inline_values);
+    EXPECT_EQ((IntSmallVector { 1 }),       heap_values);
+    EXPECT_TRUE(heap_values.is_inline());
+}
+
+TEST(SmallVectorTest, AtThrowsOutOfRange)
+{
+    IntSmallVector values = { 1, 2 };
+
+    EXPECT_EQ(2, values.at(1));
+    EXPECT_THROW(values.at(2), std::out_of_range);
+}
+
+TEST(SmallVectorTest, SequencesOfDifferentSizesAreUnequal)
+{
+    EXPECT_NE((IntSmallVector { 1, 2 }), (IntSmallVector { 1, 2, 0 }));
+}
+
+} // namespace
@@ -6,14 +6,15 @@
 namespace {
 
 using tasty_int::detail::split_digits;
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 
 template<std::size_t COUNT_PIECES>
 struct SplitDigitsTestParam
 {
-    std::vector<digit_type>                           digits;
-    std::vector<digit_type>::size_type                split_size;
-    std::array<std::vector<digit_type>, COUNT_PIECES> expected_result;
+    SmallVector<digit_type>                           digits;
+    SmallVector<digit_type>::size_type                split_size;
+    std::array<SmallVector<digit_type>, COUNT_PIECES> expected_result;
 }; // struct SplitDigitsTestParam
 
 template<std::size_t COUNT_PIECES>
@@ -5,6 +5,7 @@
 
 namespace {
 
+using tasty_int::detail::SmallVector;
 using tasty_int::detail::digit_type;
 using tasty_int::detail::have_trailing_zero;
 using tasty_int::detail::trim_trailing_zero;
@@ -13,29 +14,29 @@ using tasty_int::detail::trim_trailing_zeros;
 
 TEST(HaveTrailingZeroTest, SingleZeroDoesNotHaveTrailingZero)
 {
-    std::vector<digit_type> zero = { 0 };
+    SmallVector<digit_type> zero = { 0 };
 
     EXPECT_FALSE(have_trailing_zero(zero));
 }
 
 TEST(HaveTrailingZeroTest, TrailingZeroHasTrailingZero)
 {
-    std::vector<digit_type> trailing_zero = { 0, 0 };
+    SmallVector<digit_type> trailing_zero = { 0, 0 };
 
     EXPECT_TRUE(have_trailing_zero(trailing_zero));
 }
 
 TEST(HaveTrailingZeroTest, TrailingNonzeroDoesNotHaveTrailingZero)
 {
-    std::vector<digit_type> trailing_nonzero = { 0, 1 };
+    SmallVector<digit_type> trailing_nonzero = { 0, 1 };
 
     EXPECT_FALSE(have_trailing_zero(trailing_nonzero));
 }
 
 TEST(TrimTrailingZeroTest, TrimTrailingZeroDoesNotTrimSingleZero)
 {
-    std::vector<digit_type> digits     = { 0 };
-    std::vector<digit_type> after_trim = { 0 };
+    SmallVector<digit_type> digits     = { 0 };
+    SmallVector<digit_type> after_trim = { 0 };
 
     trim_trailing_zero(digits);
 
@@ -44,8 +45,8 @@ TEST(TrimTrailingZeroTest, TrimTrailingZeroDoesNotTrimSingleZero)
 
 TEST(TrimTrailingZeroTest, TrimTrailingZeroTrimsTrailingZero)
 {
-    std::vector<digit_type> digits     = { 0, 0 };
-    std::vector<digit_type> after_trim = { 0 };
+    SmallVector<digit_type> digits     = { 0, 0 };
+    SmallVector<digit_type> after_trim = { 0 };
 
     trim_trailing_zero(digits);
 
@@ -54,8 +55,8 @@ TEST(TrimTrailingZeroTest, TrimTrailingZeroTrimsTrailingZero)
 
 TEST(TrimTrailingZeroTest, TrimTrailingZeroDoesNotTrimTrailingNonzero)
 {
-    std::vector<digit_type> digits     = { 0, 1 };
-    std::vector<digit_type> after_trim = { 0, 1 };
+    SmallVector<digit_type> digits     = { 0, 1 };
+    SmallVector<digit_type> after_trim = { 0, 1 };
 
     trim_trailing_zero(digits);
 
@@ -64,8 +65,8 @@ TEST(TrimTrailingZeroTest, TrimTrailingZeroDoesNotTrimTrailingNonzero)
 
 TEST(TrimTrailingZerosTest, TrimTrailingZerosDoesNotTrimSingleZeros)
 {
-    std::vector<digit_type> digits     = { 0 };
-    std::vector<digit_type> after_trim = { 0 };
+    SmallVector<digit_type> digits     = { 0 };
+    SmallVector<digit_type> after_trim = { 0 };
 
     trim_trailing_zeros(digits);
 
@@ -74,8 +75,8 @@ TEST(TrimTrailingZerosTest, TrimTrailingZerosDoesNotTrimSingleZeros)
 
 TEST(TrimTrailingZerosTest, TrimTrailingZerosTrimsSingleTrailingZero)
 {
-    std::vector<digit_type> digits     = { 0, 0 };
-    std::vector<digit_type> after_trim = { 0 };
+    SmallVector<digit_type> digits     = { 0, 0 };
+    SmallVector<digit_type> after_trim = { 0 };
 
     trim_trailing_zeros(digits);
 
@@ -84,8 +85,8 @@ TEST(TrimTrailingZerosTest, TrimTrailingZerosTrimsSingleTrailingZero)
 
 TEST(TrimTrailingZerosTest, TrimTrailingZerosTrimsMultipleTrailingZeros)
 {
-    std::vector<digit_type> digits     = { 0, 0, 0, 0, 0 };
-    std::vector<digit_type> after_trim = { 0 };
+    SmallVector<digit_type> digits     = { 0, 0, 0, 0, 0 };
+    SmallVector<digit_type> after_trim = { 0 };
 
     trim_trailing_zeros(digits);
 
@@ -94,8 +95,8 @@ TEST(TrimTrailingZerosTest, TrimTrailingZerosTrimsMultipleTrailingZeros)
 
 TEST(TrimTrailingZerosTest, TrimTrailingZerosDoesNotTrimTrailingNonzeros)
 {
-    std::vector<digit_type> digits     = { 0, 1 };
-    std::vector<digit_type> after_trim = { 0, 1 };
+    SmallVector<digit_type> digits     = { 0, 1 };
+    SmallVector<digit_type> after_trim = { 0, 1 };
 
     trim_trailing_zeros(digits);
 
@@ -1,9 +1,8 @@
 #ifndef TASTY_INT_TASTY_INT_DETAIL_TRAILING_ZERO_HPP
 #define TASTY_INT_TASTY_INT_DETAIL_TRAILING_ZERO_HPP
 
-#include <vector>
-
 #include "tasty_int/detail/digit_type.hpp"
+#include "tasty_int/detail/small_vector.hpp"
 
 
 namespace tasty_int {
@@ -16,7 +15,7 @@ namespace detail {
  * @return true if @p digits is multi-digit and ends with a zero
  */
 bool
-have_trailing_zero(const std::vector<digit_type> &digits);
+have_trailing_zero(const SmallVector<digit_type> &digits);
 
 /**
  * @brief Remove the most-significant digit from @p digits if it is zero.
@@ -28,7 +27,7 @@ have_trailing_zero(const std::vector<digit_type> &digits);
  * @param[in] digits a little-endian sequence of digits
  */
 void
-trim_trailing_zero(std::vector<digit_type> &digits);
+trim_trailing_zero(SmallVector<digit_type> &digits);
 
 /**
  * @brief Remove the most-significant digits from @p digits that are zeros.
@@ -36,7 +35,7 @@ trim_trailing_zero(std::vector<digit_type> &digits);
  * @param[in] digits a little-endian sequence of digits
  */
 void
-trim_trailing_zeros(std::vector<digit_type> &digits);
+trim_trailing_zeros(SmallVector<digit_type> &digits);
 
 } // namespace detail
 } // namespace tasty_int
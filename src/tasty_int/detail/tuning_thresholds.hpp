@@ -0,0 +1,39 @@
+#ifndef TASTY_INT_TASTY_INT_DETAIL_TUNING_THRESHOLDS_HPP
+#define TASTY_INT_TASTY_INT_DETAIL_TUNING_THRESHOLDS_HPP
+
+/**
+ * @file tuning_thresholds.hpp
+ * The operand sizes at or below which arithmetic algorithms delegate to their
+ * lower-tier counterparts.
+ *
+ * Ordinarily these are constants generated by
+ * code_generator/generate_tuning_thresholds.cpp.  If TASTY_INT_TUNE_THRESHOLDS
+ * is defined, the arithmetic is being built into the generator itself, and the
+ * thresholds are variables that it assigns while timing competing algorithms.
+ */
+#ifdef TASTY_INT_TUNE_THRESHOLDS
+#   include <cstddef>
+
+
+namespace tasty_int {
+namespace detail {
+namespace codegen {
+
+extern std::size_t LONG_MULTIPLY_THRESHOLD_MAGNITUDE;
+extern std::size_t LONG_SQUARE_THRESHOLD_MAGNITUDE;
+extern std::size_t KARATSUBA_MULTIPLY_THRESHOLD_MAGNITUDE;
+extern std::size_t KARATSUBA_SQUARE_THRESHOLD_MAGNITUDE;
+extern std::size_t TOOM_3_MULTIPLY_THRESHOLD_MAGNITUDE;
+extern std::size_t TOOM_3_SQUARE_THRESHOLD_MAGNITUDE;
+extern std::size_t LONG_DIVIDE_THRESHOLD_DIVISOR_MAGNITUDE;
+extern std::size_t DIVIDE_AND_CONQUER_DIVIDE_THRESHOLD_DIVISOR_MAGNITUDE;
+
+} // namespace codegen
+} // namespace detail
+} // namespace tasty_int
+
+#else
+#   include "tasty_int/detail/codegen/tuning_thresholds.hpp"
+#endif // ifdef TASTY_INT_TUNE_THRESHOLDS
+
+#endif // ifndef TASTY_INT_TASTY_INT_DETAIL_TUNING_THRESHOLDS_HPP
@@ -0,0 +1,103 @@
+#include "tasty_int/mapped_tasty_int.hpp"
+
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using tasty_int::MappedTastyInt;
+using tasty_int::TastyInt;
+using tasty_int::write_to_file;
+
+
+class MappedTastyIntTest : public ::testing::Test
+{
+protected:
+    MappedTastyIntTest()
+        : path(std::filesystem::temp_directory_path() /
+               ("tasty_int_mapped_tasty_int_test_" +
+                std::string(::testing::UnitTest::GetInstance()
+                                ->current_test_info()->name())))
+    {}
+
+    ~MappedTastyIntTest()
+    {
+        std::filesystem::remove(path);
+    }
+
+    MappedTastyInt
+    write_and_map(const TastyInt &value) const
+    {
+        write_to_file(value, path);
+
+        return MappedTastyInt(path);
+    }
+
+    const std::filesystem::path path;
+}; // class MappedTastyIntTest
+
+
+const TastyInt LARGE_VALUE(
+    "-123456789012345678901234567890123456789012345678901234567890"
+    "98765432109876543210987654321098765432109876543210"
+);
+
+TEST_F(MappedTastyIntTest, ToTastyIntRoundTrips)
+{
+    for (const auto &value : { TastyInt(0), TastyInt(1), TastyInt(-42),
+                               LARGE_VALUE })
+        EXPECT_EQ(value, write_and_map(value).to_tasty_int());
+}
+
+TEST_F(MappedTastyIntTest, ToStringMatchesTastyInt)
+{
+    auto mapped = write_and_map(LARGE_VALUE);
+
+    for (unsigned int base : { 2, 10, 16, 36, 64 })
+        EXPECT_EQ(LARGE_VALUE.to_string(base), mapped.to_string(base));
+}
+
+TEST_F(MappedTastyIntTest, ComparisonWithTastyInt)
+{
+    auto mapped = write_and_map(LARGE_VALUE);
+
+    EXPECT_TRUE(mapped == LARGE_VALUE);
+    EXPECT_TRUE(LARGE_VALUE == mapped);
+    EXPECT_FALSE(mapped != LARGE_VALUE);
+    EXPECT_TRUE(mapped < (LARGE_VALUE + 1));
+    EXPECT_TRUE(mapped > (LARGE_VALUE - 1));
+    EXPECT_TRUE(mapped < TastyInt(0));
+    EXPECT_TRUE(TastyInt(0) > mapped);
+    EXPECT_TRUE(mapped > (LARGE_VALUE * 2));
+}
+
+TEST_F(MappedTastyIntTest, ComparisonWithMappedTastyInt)
+{
+    auto mapped = write_and_map(LARGE_VALUE);
+
+    EXPECT_TRUE(mapped == mapped);
+    EXPECT_TRUE(mapped <= mapped);
+    EXPECT_FALSE(mapped < mapped);
+}
+
+TEST_F(MappedTastyIntTest, MultiplicationMatchesTastyInt)
+{
+    auto mapped = write_and_map(LARGE_VALUE);
+    TastyInt multiplier("-987654321987654321987654321");
+
+    EXPECT_EQ(LARGE_VALUE * multiplier, mapped * multiplier);
+    EXPECT_EQ(multiplier * LARGE_VALUE, multiplier * mapped);
+    EXPECT_EQ(LARGE_VALUE * LARGE_VALUE, mapped * mapped);
+}
+
+TEST_F(MappedTastyIntTest, MissingFileThrowsSystemError)
+{
+    EXPECT_THROW(MappedTastyInt(path / "missing"), std::system_error);
+}
+
+} // namespace
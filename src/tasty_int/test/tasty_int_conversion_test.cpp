@@ -2,9 +2,13 @@
 
 #include <cmath>
 
+#include <charconv>
 #include <iomanip>
 #include <sstream>
+#include <string>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -265,6 +269,99 @@ TEST_F(TastyIntStringConversionTest, ToStringBaseDefaultsToBase10)
 }
 
 
+TEST(TastyIntCharsConversionTest, ToCharsMatchesToString)
+{
+    TastyInt tasty_int("-1234567890123456789012345678901234567890");
+    std::string buffer(tasty_int.max_chars(36), '\0');
+
+    auto [end, error] = to_chars(buffer.data(),
+                                 buffer.data() + buffer.size(),
+                                 tasty_int, 36);
+
+    ASSERT_EQ(std::errc(), error);
+    buffer.resize(end - buffer.data());
+    EXPECT_EQ(tasty_int.to_string(36), buffer);
+}
+
+TEST(TastyIntCharsConversionTest, ToCharsTooSmallBufferReportsValueTooLarge)
+{
+    TastyInt tasty_int(1234);
+    char buffer[3];
+
+    auto [end, error] = to_chars(buffer, buffer + sizeof(buffer), tasty_int);
+
+    EXPECT_EQ(std::errc::value_too_large, error);
+    EXPECT_EQ(buffer + sizeof(buffer), end);
+}
+
+TEST(TastyIntCharsConversionTest, FromCharsRoundTripsToChars)
+{
+    TastyInt expected("-0x3a0c92075c0dbf3b8acbc5f96ce3f0ad2", 16);
+
+    for (unsigned int base : { 2, 10, 16, 36, 64 }) {
+        std::string buffer(expected.max_chars(base), '\0');
+        auto to_chars_result = to_chars(buffer.data(),
+                                        buffer.data() + buffer.size(),
+                                        expected, base);
+        ASSERT_EQ(std::errc(), to_chars_result.ec);
+
+        TastyInt result;
+        auto from_chars_result = from_chars(buffer.data(),
+                                            to_chars_result.ptr,
+                                            result, base);
+
+        EXPECT_EQ(std::errc(), from_chars_result.ec) << "base " << base;
+        EXPECT_EQ(to_chars_result.ptr, from_chars_result.ptr)
+            << "base " << base;
+        EXPECT_EQ(expected, result) << "base " << base;
+    }
+}
+
+TEST(TastyIntCharsConversionTest, FromCharsWithoutNumberLeavesValueUnmodified)
+{
+    std::string_view tokens = "xyz";
+    TastyInt tasty_int(7);
+
+    auto [end, error] = from_chars(tokens.data(),
+                                   tokens.data() + tokens.size(),
+                                   tasty_int);
+
+    EXPECT_EQ(std::errc::invalid_argument, error);
+    EXPECT_EQ(tokens.data(), end);
+    EXPECT_EQ(7, tasty_int);
+}
+
+
+TEST(TastyIntBinaryConversionTest, FromBinaryRoundTripsToBinary)
+{
+    TastyInt expected("-0x3a0c92075c0dbf3b8acbc5f96ce3f0ad2", 16);
+    tasty_int::BinaryFormat format = {
+        .word_size  = 4,
+        .word_order = tasty_int::WordOrder::MOST_SIGNIFICANT_FIRST,
+        .byte_order = std::endian::big
+    };
+
+    auto bytes = expected.to_binary(format);
+
+    EXPECT_EQ(expected.binary_size(format), bytes.size());
+    EXPECT_EQ(std::byte(0x01), bytes.front());
+    EXPECT_EQ(std::byte(0x00), bytes[1]);
+    EXPECT_EQ(std::byte(0x03), bytes[4]);
+    EXPECT_EQ(expected, TastyInt::from_binary(bytes, format));
+}
+
+TEST(TastyIntBinaryConversionTest, DefaultFormatIsCompact)
+{
+    TastyInt tasty_int(0xdeadbeef);
+    std::vector<std::byte> bytes(16);
+
+    EXPECT_EQ(9, tasty_int.to_binary(bytes));
+    EXPECT_EQ(tasty_int, TastyInt::from_binary(
+        std::span<const std::byte>(bytes).first(9)
+    ));
+}
+
+
 TEST(TastyIntInputTest, InputReturnsReferenceToSelf)
 {
     std::istringstream input("0");
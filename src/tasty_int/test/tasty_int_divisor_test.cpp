@@ -0,0 +1,52 @@
+#include "tasty_int/tasty_int_divisor.hpp"
+
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using tasty_int::TastyInt;
+using tasty_int::TastyIntDivisor;
+
+
+const TastyInt LARGE_VALUE(
+    "123456789012345678901234567890123456789012345678901234567890"
+    "123456789012345678901234567890123456789012345678901234567890"
+    "123456789012345678901234567890123456789012345678901234567890"
+    "123456789012345678901234567890123456789012345678901234567890"
+    "123456789012345678901234567890123456789012345678901234567890"
+    "123456789012345678901234567890123456789012345678901234567890"
+    "123456789012345678901234567890123456789012345678901234567890"
+    "123456789012345678901234567890123456789012345678901234567890"
+    "123456789012345678901234567890123456789012345678901234567890"
+    "123456789012345678901234567890123456789012345678901234567890"
+    "123456789012345678901234567890123456789012345678901234567891"
+);
+
+TEST(TastyIntDivisorTest, ValueRoundTrips)
+{
+    for (const auto &divisor : { TastyInt(1), TastyInt(-42), LARGE_VALUE })
+        EXPECT_EQ(divisor, TastyIntDivisor(divisor).value());
+}
+
+TEST(TastyIntDivisorTest, ConsistentWithDivisionOperators)
+{
+    for (const auto &divisor : { TastyInt(7), -LARGE_VALUE, LARGE_VALUE }) {
+        TastyIntDivisor tasty_int_divisor(divisor);
+
+        for (const auto &dividend : { TastyInt(0),
+                                      TastyInt(-1000),
+                                      LARGE_VALUE - 1,
+                                      LARGE_VALUE * LARGE_VALUE + 12345,
+                                      -(LARGE_VALUE * LARGE_VALUE) }) {
+            EXPECT_EQ(dividend / divisor, tasty_int_divisor.divide(dividend));
+            EXPECT_EQ(dividend % divisor, tasty_int_divisor.reduce(dividend));
+
+            auto result = tasty_int_divisor.div(dividend);
+            EXPECT_EQ(dividend / divisor, result.quotient);
+            EXPECT_EQ(dividend % divisor, result.remainder);
+        }
+    }
+}
+
+} // namespace
@@ -0,0 +1,55 @@
+#include "tasty_int/tasty_int_montgomery.hpp"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using tasty_int::TastyInt;
+using tasty_int::TastyIntMontgomeryContext;
+
+
+// 2^521 - 1 is prime
+const TastyInt MERSENNE_PRIME("1" + std::string(130, 'f'), 16);
+
+TEST(TastyIntMontgomeryContextTest, ValueRoundTrips)
+{
+    EXPECT_EQ(MERSENNE_PRIME,
+              TastyIntMontgomeryContext(MERSENNE_PRIME).value());
+}
+
+TEST(TastyIntMontgomeryContextTest, MultiplyConsistentWithDivisionOperators)
+{
+    TastyIntMontgomeryContext context(MERSENNE_PRIME);
+
+    TastyInt lhs("3" + std::string(120, '5'), 16);
+    TastyInt rhs("-7" + std::string(100, '9'), 16);
+
+    auto product = context.multiply(context.to_montgomery(lhs),
+                                    context.to_montgomery(rhs));
+    auto expected_product = (lhs * rhs) % MERSENNE_PRIME + MERSENNE_PRIME;
+
+    EXPECT_EQ(expected_product, context.from_montgomery(product));
+
+    auto square = context.square(context.to_montgomery(lhs));
+
+    EXPECT_EQ((lhs * lhs) % MERSENNE_PRIME, context.from_montgomery(square));
+}
+
+TEST(TastyIntMontgomeryContextTest, PowModSatisfiesFermatsLittleTheorem)
+{
+    TastyIntMontgomeryContext context(MERSENNE_PRIME);
+
+    for (const auto &base : { TastyInt(2), TastyInt(-3),
+                              TastyInt("1" + std::string(75, '0') + "1",
+                                       16) }) {
+        EXPECT_EQ(TastyInt(1), context.pow_mod(base, MERSENNE_PRIME - 1));
+        EXPECT_EQ(base % MERSENNE_PRIME
+                      + ((base < 0) ? MERSENNE_PRIME : TastyInt(0)),
+                  context.pow_mod(base, MERSENNE_PRIME));
+    }
+}
+
+} // namespace
@@ -0,0 +1,46 @@
+#include "tasty_int/tasty_int.hpp"
+#include "tasty_int/tasty_int_divisor.hpp"
+#include "tasty_int/tasty_int_montgomery.hpp"
+#include "tasty_int/mapped_tasty_int.hpp"
+
+#include <cstdint>
+
+#include <limits>
+
+#include "gtest/gtest.h"
+
+
+namespace {
+
+using tasty_int::TastyInt;
+using tasty_int::TastyIntDivisor;
+
+
+// This test is compiled without compiler extensions (e.g. `-std=c++20` rather
+// than `-std=gnu++20`) to check that the public headers remain usable in
+// strict ISO modes and agree with the library on the digit layout.
+TEST(TastyIntStrictIsoTest, ArithmeticAgreesWithLibrary)
+{
+    TastyInt value("123456789012345678901234567890");
+
+    EXPECT_EQ(TastyInt("15241578753238836750495351562536198787501905199875"
+                       "019052100"),
+              value * value);
+    EXPECT_EQ(TastyInt("17636684144620811271604938270"), value / 7);
+    EXPECT_EQ(0, value % 7);
+    EXPECT_EQ(TastyInt("26962218853528593831"),
+              TastyIntDivisor(TastyInt("100000000000000000039"))
+                  .reduce(value * value));
+    EXPECT_EQ("123456789012345678901234567890", value.to_string());
+}
+
+TEST(TastyIntStrictIsoTest, DigitBoundaryAgreesWithLibrary)
+{
+    TastyInt two_pow_64("18446744073709551616");
+
+    EXPECT_EQ(std::numeric_limits<std::uint64_t>::max(), two_pow_64 - 1);
+    EXPECT_EQ(two_pow_64,
+              TastyInt(std::numeric_limits<std::uint64_t>::max()) + 1);
+}
+
+} // namespace